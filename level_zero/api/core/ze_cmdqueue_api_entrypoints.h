@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/perf_profiler.h"
+
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
 #include "level_zero/core/source/context/context.h"
 #include <level_zero/ze_api.h>
@@ -30,12 +32,14 @@ ze_result_t zeCommandQueueExecuteCommandLists(
     uint32_t numCommandLists,
     ze_command_list_handle_t *phCommandLists,
     ze_fence_handle_t hFence) {
+    PERF_PROFILER_API_HISTOGRAM();
     return L0::CommandQueue::fromHandle(hCommandQueue)->executeCommandLists(numCommandLists, phCommandLists, hFence, true);
 }
 
 ze_result_t zeCommandQueueSynchronize(
     ze_command_queue_handle_t hCommandQueue,
     uint64_t timeout) {
+    PERF_PROFILER_API_HISTOGRAM();
     return L0::CommandQueue::fromHandle(hCommandQueue)->synchronize(timeout);
 }
 
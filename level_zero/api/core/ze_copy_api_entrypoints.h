@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/perf_profiler.h"
+
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include <level_zero/ze_api.h>
 
@@ -19,6 +21,7 @@ ze_result_t zeCommandListAppendMemoryCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
+    PERF_PROFILER_API_HISTOGRAM();
     return L0::CommandList::fromHandle(hCommandList)->appendMemoryCopy(dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, false);
 }
 
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/perf_profiler.h"
+
 #include "level_zero/core/source/event/event.h"
 #include <level_zero/ze_api.h>
 
@@ -76,6 +78,7 @@ ze_result_t zeEventHostSignal(
 ze_result_t zeEventHostSynchronize(
     ze_event_handle_t hEvent,
     uint64_t timeout) {
+    PERF_PROFILER_API_HISTOGRAM();
     return L0::Event::fromHandle(hEvent)->hostSynchronize(timeout);
 }
 
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/perf_profiler.h"
+
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/module/module.h"
@@ -146,6 +148,7 @@ ze_result_t zeCommandListAppendLaunchKernel(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
+    PERF_PROFILER_API_HISTOGRAM();
     L0::CmdListKernelLaunchParams launchParams = {};
     return L0::CommandList::fromHandle(hCommandList)->appendLaunchKernel(kernelHandle, launchKernelArgs, hSignalEvent, numWaitEvents, phWaitEvents, launchParams, false);
 }
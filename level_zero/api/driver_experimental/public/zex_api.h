@@ -20,8 +20,10 @@
 #include "level_zero/api/driver_experimental/public/zex_cmdlist.h"
 
 #include "zex_driver.h"
+#include "zex_event.h"
 #include "zex_memory.h"
 #include "zex_module.h"
+#include "zex_sysman_engine.h"
 #include "zex_sysman_memory.h"
 
 #endif // _ZEX_API_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,4 +52,80 @@ zexCommandListAppendWriteToMemory(
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListBeginCapture(
+    zex_command_list_handle_t hCommandList) {
+    try {
+        {
+            if (nullptr == hCommandList)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->beginCapture();
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListEndCapture(
+    zex_command_list_handle_t hCommandList) {
+    try {
+        {
+            if (nullptr == hCommandList)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->endCapture();
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListReplayCapture(
+    zex_command_list_handle_t hCommandList) {
+    try {
+        {
+            if (nullptr == hCommandList)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->replayCapture();
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListPatchCapturedKernelArgument(
+    zex_command_list_handle_t hCommandList,
+    uint32_t launchIndex,
+    uint32_t argIndex,
+    size_t argSize,
+    const void *pArgValue) {
+    try {
+        {
+            if (nullptr == hCommandList)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->patchCapturedKernelArgument(launchIndex, argIndex, argSize, pArgValue);
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
 } // namespace L0
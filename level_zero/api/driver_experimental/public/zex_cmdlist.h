@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,4 +24,20 @@ zexCommandListAppendWriteToMemory(
     zex_write_to_mem_desc_t *desc,
     void *ptr,
     uint64_t data);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListBeginCapture(
+    zex_command_list_handle_t hCommandList);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListEndCapture(
+    zex_command_list_handle_t hCommandList);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListReplayCapture(
+    zex_command_list_handle_t hCommandList);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListPatchCapturedKernelArgument(
+    zex_command_list_handle_t hCommandList,
+    uint32_t launchIndex,
+    uint32_t argIndex,
+    size_t argSize,
+    const void *pArgValue);
 } // namespace L0
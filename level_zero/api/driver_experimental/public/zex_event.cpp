@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+#include "level_zero/core/source/event/event.h"
+
+namespace L0 {
+
+ze_result_t ZE_APICALL
+zexEventHostResetBatch(
+    uint32_t numEvents,
+    zex_event_handle_t *phEvents) {
+    if (numEvents > 0 && phEvents == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    return L0::Event::hostResetEvents(numEvents, phEvents);
+}
+
+} // namespace L0
+
+extern "C" {
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostResetBatch(
+    uint32_t numEvents,
+    zex_event_handle_t *phEvents) {
+    return L0::zexEventHostResetBatch(numEvents, phEvents);
+}
+}
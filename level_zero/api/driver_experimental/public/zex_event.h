@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef _ZEX_EVENT_H
+#define _ZEX_EVENT_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+namespace L0 {
+ze_result_t ZE_APICALL
+zexEventHostResetBatch(
+    uint32_t numEvents,
+    zex_event_handle_t *phEvents);
+
+}
+
+#endif // _ZEX_EVENT_H
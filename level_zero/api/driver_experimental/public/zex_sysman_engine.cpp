@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/api/driver_experimental/public/zex_sysman_engine.h"
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+#include "level_zero/core/source/driver/driver.h"
+#include "level_zero/sysman/source/sysman_device.h"
+#include "level_zero/tools/source/sysman/sysman.h"
+
+#include <vector>
+
+namespace L0 {
+
+ze_result_t ZE_APICALL
+zexSysmanDeviceGetEngineActivity(
+    zes_device_handle_t hDevice,
+    uint32_t *pCount,
+    zes_engine_stats_t *pStats) {
+    if (nullptr == pCount) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if (L0::sysmanInitFromCore) {
+        return L0::SysmanDevice::engineGetActivity(hDevice, pCount, pStats);
+    }
+    auto result = L0::Sysman::SysmanDevice::engineGet(hDevice, pCount, nullptr);
+    if (result != ZE_RESULT_SUCCESS || nullptr == pStats) {
+        return result;
+    }
+    std::vector<zes_engine_handle_t> engines(*pCount);
+    result = L0::Sysman::SysmanDevice::engineGet(hDevice, pCount, engines.data());
+    for (uint32_t i = 0; i < *pCount && result == ZE_RESULT_SUCCESS; i++) {
+        result = L0::Sysman::Engine::fromHandle(engines[i])->engineGetActivity(&pStats[i]);
+    }
+    return result;
+}
+
+} // namespace L0
+
+extern "C" {
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexSysmanDeviceGetEngineActivity(
+    zes_device_handle_t hDevice,
+    uint32_t *pCount,
+    zes_engine_stats_t *pStats) {
+    return L0::zexSysmanDeviceGetEngineActivity(hDevice, pCount, pStats);
+}
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef _ZEX_SYSMAN_ENGINE_H
+#define _ZEX_SYSMAN_ENGINE_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+
+namespace L0 {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get activity stats of all engine groups of the device at once
+///
+/// @details
+///     - Stats are returned in the order of handles returned by ::zesDeviceEnumEngineGroups.
+///     - All stats are sampled at the same point in time, where the OS supports it.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_DEVICE_LOST
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `nullptr == hDevice`
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `nullptr == pCount`
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///     - ::ZE_RESULT_ERROR_INSUFFICIENT_PERMISSIONS
+///         + User does not have permissions to query this telemetry.
+ze_result_t ZE_APICALL
+zexSysmanDeviceGetEngineActivity(
+    zes_device_handle_t hDevice, ///< [in] Sysman handle of the device.
+    uint32_t *pCount,            ///< [in,out] pointer to the number of engine groups.
+                                 ///< if count is zero, then the driver shall update the value with the total number of engine groups.
+                                 ///< if count is greater than zero, stats of that many engine groups are returned.
+    zes_engine_stats_t *pStats   ///< [in,out][optional][range(0, *pCount)] array of engine group stats.
+);
+
+} // namespace L0
+#endif
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/builtin/builtin_binary_cache.h"
+
+#include "shared/source/helpers/hw_info.h"
+
+namespace L0 {
+
+BuiltinBinaryCache::KeyT BuiltinBinaryCache::createKey(const NEO::HardwareInfo &hwInfo, uint32_t builtinOp) {
+    return KeyT{static_cast<uint32_t>(hwInfo.platform.eProductFamily),
+                static_cast<uint32_t>(hwInfo.platform.usDeviceID),
+                static_cast<uint32_t>(hwInfo.platform.usRevId),
+                builtinOp};
+}
+
+std::shared_ptr<const BuiltinBinaryCache::BinaryT> BuiltinBinaryCache::get(const KeyT &key) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = binaries.find(key);
+    if (it == binaries.end()) {
+        return nullptr;
+    }
+    hitCount++;
+    return it->second;
+}
+
+void BuiltinBinaryCache::store(const KeyT &key, BinaryT &&binary) {
+    if (binary.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    binaries.emplace(key, std::make_shared<const BinaryT>(std::move(binary)));
+}
+
+size_t BuiltinBinaryCache::getStoredCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return binaries.size();
+}
+
+} // namespace L0
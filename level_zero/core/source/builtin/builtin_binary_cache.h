@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace NEO {
+struct HardwareInfo;
+} // namespace NEO
+
+namespace L0 {
+
+// Native builtin binaries compiled for one root device, reused by all root devices of the same product
+struct BuiltinBinaryCache {
+    using BinaryT = std::vector<uint8_t>;
+    using KeyT = std::tuple<uint32_t, uint32_t, uint32_t, uint32_t>; // product family, device id, revision id, builtin op
+
+    static KeyT createKey(const NEO::HardwareInfo &hwInfo, uint32_t builtinOp);
+
+    std::shared_ptr<const BinaryT> get(const KeyT &key);
+    void store(const KeyT &key, BinaryT &&binary);
+
+    size_t getHitCount() const { return hitCount; }
+    size_t getStoredCount();
+
+  protected:
+    std::mutex mtx;
+    std::map<KeyT, std::shared_ptr<const BinaryT>> binaries;
+    size_t hitCount = 0u;
+};
+
+} // namespace L0
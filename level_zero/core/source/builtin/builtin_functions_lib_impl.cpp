@@ -9,9 +9,11 @@
 
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
 #include "shared/source/os_interface/os_interface.h"
 
 #include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/kernel/kernel.h"
 
 namespace NEO {
@@ -31,7 +33,7 @@ std::unique_lock<BuiltinFunctionsLib::MutexType> BuiltinFunctionsLib::obtainUniq
     return std::unique_lock<BuiltinFunctionsLib::MutexType>(this->ownershipMutex);
 }
 
-void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
+BuiltinFunctionsLibImpl::BuiltinKernelDesc BuiltinFunctionsLibImpl::getBuiltinKernelDesc(Builtin func) {
     const char *builtinName = nullptr;
     NEO::EBuiltInOps::Type builtin;
 
@@ -120,11 +122,17 @@ void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
         UNRECOVERABLE_IF(true);
     };
 
+    return {builtin, builtinName};
+}
+
+void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
+    auto kernelDesc = getBuiltinKernelDesc(func);
+
     auto builtId = static_cast<uint32_t>(func);
-    builtins[builtId] = loadBuiltIn(builtin, builtinName);
+    builtins[builtId] = loadBuiltIn(kernelDesc.builtin, kernelDesc.kernelName);
 }
 
-void BuiltinFunctionsLibImpl::initBuiltinImageKernel(ImageBuiltin func) {
+BuiltinFunctionsLibImpl::BuiltinKernelDesc BuiltinFunctionsLibImpl::getImageBuiltinKernelDesc(ImageBuiltin func) {
     const char *builtinName = nullptr;
     NEO::EBuiltInOps::Type builtin;
 
@@ -177,17 +185,72 @@ void BuiltinFunctionsLibImpl::initBuiltinImageKernel(ImageBuiltin func) {
         UNRECOVERABLE_IF(true);
     };
 
+    return {builtin, builtinName};
+}
+
+void BuiltinFunctionsLibImpl::initBuiltinImageKernel(ImageBuiltin func) {
+    auto kernelDesc = getImageBuiltinKernelDesc(func);
+
     auto builtId = static_cast<uint32_t>(func);
-    imageBuiltins[builtId] = loadBuiltIn(builtin, builtinName);
+    imageBuiltins[builtId] = loadBuiltIn(kernelDesc.builtin, kernelDesc.kernelName);
 }
 
 BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *builtInsLib) : device(device), builtInsLib(builtInsLib) {
-    if (initBuiltinsAsyncEnabled(device)) {
+    if (NEO::DebugManager.flags.PreloadAllBuiltinsAsync.get() == 1) {
+        this->initAsyncComplete = false;
+        this->initAsync = std::async(std::launch::async, &BuiltinFunctionsLibImpl::preloadAllBuiltins, this);
+    } else if (initBuiltinsAsyncEnabled(device)) {
         this->initAsyncComplete = false;
         this->initAsync = std::async(std::launch::async, &BuiltinFunctionsLibImpl::initBuiltinKernel, this, Builtin::FillBufferImmediate);
     }
 }
 
+void BuiltinFunctionsLibImpl::preloadAllBuiltins() {
+    struct PreloadEntry {
+        const char *kernelName;
+        std::unique_ptr<BuiltinData> *target;
+    };
+    std::map<NEO::EBuiltInOps::Type, std::vector<PreloadEntry>> kernelsPerModule;
+
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
+        auto kernelDesc = getBuiltinKernelDesc(static_cast<Builtin>(builtId));
+        kernelsPerModule[kernelDesc.builtin].push_back({kernelDesc.kernelName, &builtins[builtId]});
+    }
+    if (device->getNEODevice()->getDeviceInfo().imageSupport) {
+        for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(ImageBuiltin::COUNT); builtId++) {
+            auto kernelDesc = getImageBuiltinKernelDesc(static_cast<ImageBuiltin>(builtId));
+            kernelsPerModule[kernelDesc.builtin].push_back({kernelDesc.kernelName, &imageBuiltins[builtId]});
+        }
+    }
+
+    // each task owns a single module slot, so modules vector must not be resized concurrently
+    this->modules.resize(kernelsPerModule.rbegin()->first + 1u);
+
+    std::vector<std::future<void>> moduleTasks;
+    moduleTasks.reserve(kernelsPerModule.size());
+    for (auto &moduleKernels : kernelsPerModule) {
+        moduleTasks.push_back(std::async(std::launch::async, [this, &moduleKernels]() {
+            for (auto &entry : moduleKernels.second) {
+                *entry.target = loadBuiltIn(moduleKernels.first, entry.kernelName);
+            }
+        }));
+    }
+    for (auto &task : moduleTasks) {
+        task.wait();
+    }
+}
+
+BuiltinBinaryCache *BuiltinFunctionsLibImpl::getBuiltinBinaryCache() {
+    if (NEO::DebugManager.flags.ShareBuiltinBinariesAcrossDevices.get() != 1) {
+        return nullptr;
+    }
+    auto driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
+    if (driverHandle == nullptr) {
+        return nullptr;
+    }
+    return &driverHandle->builtinBinaryCache;
+}
+
 Kernel *BuiltinFunctionsLibImpl::getFunction(Builtin func) {
     auto builtId = static_cast<uint32_t>(func);
 
@@ -217,43 +280,38 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
         return nullptr;
     }
 
-    StackVec<BuiltInCodeType, 2> supportedTypes{};
-    if (!NEO::DebugManager.flags.RebuildPrecompiledKernels.get()) {
-        supportedTypes.push_back(BuiltInCodeType::Binary);
-    }
-    supportedTypes.push_back(BuiltInCodeType::Intermediate);
-
-    NEO::BuiltinCode builtinCode{};
-
-    for (auto &builtinCodeType : supportedTypes) {
-        builtinCode = builtInsLib->getBuiltinsLib().getBuiltinCode(builtin, builtinCodeType, *device->getNEODevice());
-        if (!builtinCode.resource.empty()) {
-            break;
-        }
-    }
-
-    if (builtinCode.resource.empty() || !NEO::EmbeddedStorageRegistry::exists) {
-        return nullptr;
-    }
-
     [[maybe_unused]] ze_result_t res;
 
     if (this->modules.size() <= builtin) {
         this->modules.resize(builtin + 1u);
     }
 
+    auto binaryCache = getBuiltinBinaryCache();
+    if (this->modules[builtin].get() == nullptr && binaryCache != nullptr) {
+        auto sharedBinary = binaryCache->get(BuiltinBinaryCache::createKey(device->getHwInfo(), builtin));
+        if (sharedBinary) {
+            this->modules[builtin] = createBuiltinModule(ZE_MODULE_FORMAT_NATIVE, sharedBinary->data(), sharedBinary->size());
+        }
+    }
+
     if (this->modules[builtin].get() == nullptr) {
-        std::unique_ptr<Module> module;
-        ze_module_handle_t moduleHandle;
-        ze_module_desc_t moduleDesc = {};
-        moduleDesc.format = builtinCode.type == BuiltInCodeType::Binary ? ZE_MODULE_FORMAT_NATIVE : ZE_MODULE_FORMAT_IL_SPIRV;
-        moduleDesc.pInputModule = reinterpret_cast<uint8_t *>(&builtinCode.resource[0]);
-        moduleDesc.inputSize = builtinCode.resource.size();
-        res = device->createModule(&moduleDesc, &moduleHandle, nullptr, ModuleType::Builtin);
-        UNRECOVERABLE_IF(res != ZE_RESULT_SUCCESS);
-
-        module.reset(Module::fromHandle(moduleHandle));
-        this->modules[builtin] = std::move(module);
+        auto builtinCode = getBuiltinCode(builtin);
+        if (builtinCode.resource.empty() || !NEO::EmbeddedStorageRegistry::exists) {
+            return nullptr;
+        }
+
+        auto format = builtinCode.type == BuiltInCodeType::Binary ? ZE_MODULE_FORMAT_NATIVE : ZE_MODULE_FORMAT_IL_SPIRV;
+        this->modules[builtin] = createBuiltinModule(format, reinterpret_cast<uint8_t *>(&builtinCode.resource[0]), builtinCode.resource.size());
+
+        if (binaryCache != nullptr) {
+            size_t binarySize = 0u;
+            if (this->modules[builtin]->getNativeBinary(&binarySize, nullptr) == ZE_RESULT_SUCCESS && binarySize > 0u) {
+                BuiltinBinaryCache::BinaryT nativeBinary(binarySize);
+                if (this->modules[builtin]->getNativeBinary(&binarySize, nativeBinary.data()) == ZE_RESULT_SUCCESS) {
+                    binaryCache->store(BuiltinBinaryCache::createKey(device->getHwInfo(), builtin), std::move(nativeBinary));
+                }
+            }
+        }
     }
 
     std::unique_ptr<Kernel> kernel;
@@ -267,6 +325,39 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
     return std::unique_ptr<BuiltinData>(new BuiltinData{modules[builtin].get(), std::move(kernel)});
 }
 
+NEO::BuiltinCode BuiltinFunctionsLibImpl::getBuiltinCode(NEO::EBuiltInOps::Type builtin) {
+    using BuiltInCodeType = NEO::BuiltinCode::ECodeType;
+
+    StackVec<BuiltInCodeType, 2> supportedTypes{};
+    if (!NEO::DebugManager.flags.RebuildPrecompiledKernels.get()) {
+        supportedTypes.push_back(BuiltInCodeType::Binary);
+    }
+    supportedTypes.push_back(BuiltInCodeType::Intermediate);
+
+    NEO::BuiltinCode builtinCode{};
+
+    for (auto &builtinCodeType : supportedTypes) {
+        builtinCode = builtInsLib->getBuiltinsLib().getBuiltinCode(builtin, builtinCodeType, *device->getNEODevice());
+        if (!builtinCode.resource.empty()) {
+            break;
+        }
+    }
+
+    return builtinCode;
+}
+
+std::unique_ptr<Module> BuiltinFunctionsLibImpl::createBuiltinModule(ze_module_format_t format, const uint8_t *input, size_t inputSize) {
+    ze_module_handle_t moduleHandle;
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = format;
+    moduleDesc.pInputModule = input;
+    moduleDesc.inputSize = inputSize;
+    [[maybe_unused]] ze_result_t res = device->createModule(&moduleDesc, &moduleHandle, nullptr, ModuleType::Builtin);
+    UNRECOVERABLE_IF(res != ZE_RESULT_SUCCESS);
+
+    return std::unique_ptr<Module>(Module::fromHandle(moduleHandle));
+}
+
 void BuiltinFunctionsLibImpl::ensureInitCompletion() {
     if (!this->initAsyncComplete) {
         this->initAsync.wait();
@@ -6,25 +6,26 @@
  */
 
 #pragma once
+#include "shared/source/built_ins/built_ins.h"
+
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/module/module.h"
 
 #include <future>
+#include <map>
 #include <vector>
 
-namespace NEO {
-namespace EBuiltInOps {
-using Type = uint32_t;
-}
-class BuiltIns;
-} // namespace NEO
-
 namespace L0 {
 struct Kernel;
 struct Device;
+struct BuiltinBinaryCache;
 
 struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     struct BuiltinData;
+    struct BuiltinKernelDesc {
+        NEO::EBuiltInOps::Type builtin;
+        const char *kernelName;
+    };
     BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *builtInsLib);
     ~BuiltinFunctionsLibImpl() override {
         builtins->reset();
@@ -41,6 +42,13 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     static bool initBuiltinsAsyncEnabled(Device *device);
 
   protected:
+    static BuiltinKernelDesc getBuiltinKernelDesc(Builtin func);
+    static BuiltinKernelDesc getImageBuiltinKernelDesc(ImageBuiltin func);
+    void preloadAllBuiltins();
+    NEO::BuiltinCode getBuiltinCode(NEO::EBuiltInOps::Type builtin);
+    std::unique_ptr<Module> createBuiltinModule(ze_module_format_t format, const uint8_t *input, size_t inputSize);
+    MOCKABLE_VIRTUAL BuiltinBinaryCache *getBuiltinBinaryCache();
+
     std::vector<std::unique_ptr<Module>> modules = {};
     std::unique_ptr<BuiltinData> builtins[static_cast<uint32_t>(Builtin::COUNT)];
     std::unique_ptr<BuiltinData> imageBuiltins[static_cast<uint32_t>(ImageBuiltin::COUNT)];
@@ -25,6 +25,10 @@
 
 struct _ze_command_list_handle_t {};
 
+namespace NEO {
+class CopyThresholdCalibrator;
+} // namespace NEO
+
 namespace L0 {
 struct Device;
 struct EventPool;
@@ -148,6 +152,14 @@ struct CommandList : _ze_command_list_handle_t {
 
     virtual void *asMutable() { return nullptr; };
 
+    // Capture records kernel launches and memory copies into a template, which is replayed without re-encoding.
+    virtual ze_result_t beginCapture() { return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE; }
+    virtual ze_result_t endCapture() { return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE; }
+    virtual ze_result_t replayCapture() { return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE; }
+    virtual ze_result_t patchCapturedKernelArgument(uint32_t launchIndex, uint32_t argIndex, size_t argSize, const void *pArgValue) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
     virtual ze_result_t reserveSpace(size_t size, void **ptr) = 0;
     virtual ze_result_t reset() = 0;
 
@@ -423,6 +435,7 @@ struct CommandList : _ze_command_list_handle_t {
     bool kernelWithAssertAppended = false;
     bool dispatchCmdListBatchBufferAsPrimary = false;
     bool copyThroughLockedPtrEnabled = false;
+    NEO::CopyThresholdCalibrator *copyThresholdCalibrator = nullptr;
 };
 
 using CommandListAllocatorFn = CommandList *(*)(uint32_t);
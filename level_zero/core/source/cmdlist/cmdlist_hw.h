@@ -21,6 +21,7 @@ namespace NEO {
 enum class MemoryPool;
 enum class ImageType;
 class LogicalStateHelper;
+struct EncodeDispatchKernelArgs;
 } // namespace NEO
 
 namespace L0 {
@@ -64,6 +65,29 @@ struct CmdListEventOperation {
     bool workPartitionOperation = false;
 };
 
+struct CmdListEventResetRange {
+    std::vector<CmdListEventOperation> operations;
+    std::vector<uint64_t> completionAddresses;
+    EventPool *eventPool = nullptr;
+    NEO::GraphicsAllocation *eventAllocation = nullptr;
+    NEO::GraphicsAllocation *cmdBufferAllocation = nullptr;
+    uint64_t startAddress = 0;
+    uint64_t endAddress = 0;
+    size_t cmdBufferStartOffset = 0;
+    size_t cmdBufferEndOffset = 0;
+    uint32_t timestampSizeInDw = 0;
+    bool pipeControlWithPostSync = false;
+    bool signalScope = false;
+};
+
+struct CapturedKernelLaunch {
+    Kernel *kernel = nullptr;
+    std::vector<uint8_t> crossThreadData;
+    void *encodedCrossThreadData = nullptr;
+    void *encodedInlineData = nullptr;
+    uint32_t encodedInlineDataSize = 0u;
+};
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 struct CommandListCoreFamily : CommandListImp {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
@@ -186,6 +210,9 @@ struct CommandListCoreFamily : CommandListImp {
     ze_result_t executeCommandListImmediate(bool performMigration) override;
     ze_result_t executeCommandListImmediateImpl(bool performMigration, L0::CommandQueue *cmdQImmediate);
     size_t getReserveSshSize();
+    void recordCapturedKernelLaunch(Kernel *kernel, const NEO::EncodeDispatchKernelArgs &dispatchKernelArgs);
+
+    std::vector<CapturedKernelLaunch> *capturedKernelLaunches = nullptr;
 
   protected:
     MOCKABLE_VIRTUAL ze_result_t appendMemoryCopyKernelWithGA(void *dstPtr, NEO::GraphicsAllocation *dstPtrAlloc,
@@ -312,6 +339,11 @@ struct CommandListCoreFamily : CommandListImp {
     void dispatchPostSyncCommands(const CmdListEventOperation &eventOperations, uint64_t gpuAddress, uint32_t value, bool useLastPipeControl, bool signalScope);
     void dispatchEventRemainingPacketsPostSyncOperation(Event *event);
     void dispatchEventPostSyncOperation(Event *event, uint32_t value, bool omitFirstOperation, bool useMax, bool useLastPipeControl);
+    bool isEventResetRangeExtendable(Event *event);
+    bool isEventResetRangeFillAllowed();
+    size_t estimateEventResetRangeSize();
+    void addEventToResetRange(Event *event, uint32_t packets, bool appendPipeControlWithPostSync);
+    void appendEventResetRange();
     bool isKernelUncachedMocsRequired(bool kernelState) {
         this->containsStatelessUncachedResource |= kernelState;
         if (this->stateBaseAddressTracking) {
@@ -322,6 +354,8 @@ struct CommandListCoreFamily : CommandListImp {
     void postInitComputeSetup();
     NEO::PreemptionMode obtainKernelPreemptionMode(Kernel *kernel);
     void obtainNewTimestampPacketNode();
+
+    CmdListEventResetRange eventResetRange;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
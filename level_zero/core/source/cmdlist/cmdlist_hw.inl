@@ -132,6 +132,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     }
     this->ownedPrivateAllocations.clear();
     cmdListCurrentStartOffset = 0;
+    eventResetRange = {};
 
     return ZE_RESULT_SUCCESS;
 }
@@ -450,16 +451,44 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventReset(ze_event_hand
 
     // default state of event is single packet, handle case when reset is used 1st, launchkernel 2nd - just reset all packets then, use max
     bool useMaxPackets = event->isEventTimestampFlagSet() || (event->getPacketsInUse() < this->partitionCount);
+    uint32_t packets = event->getPacketsInUse();
+    if (this->signalAllEventPackets || useMaxPackets) {
+        packets = event->getMaxPacketsCount();
+    }
 
     bool appendPipeControlWithPostSync = (!isCopyOnly()) && (event->isSignalScope() || event->isEventTimestampFlagSet());
-    dispatchEventPostSyncOperation(event, Event::STATE_CLEARED, false, useMaxPackets, appendPipeControlWithPostSync);
 
-    if (!isCopyOnly()) {
-        if (this->partitionCount > 1) {
-            appendMultiTileBarrier(*neoDevice);
-        }
+    auto commandStream = commandContainer.getCommandStream();
+    bool extendRange = isEventResetRangeExtendable(event);
+    if (extendRange) {
+        addEventToResetRange(event, packets, appendPipeControlWithPostSync);
+        auto requiredSpace = eventResetRange.cmdBufferStartOffset + estimateEventResetRangeSize() + neoDevice->getGfxCoreHelper().getBatchBufferStartSize();
+        extendRange = requiredSpace <= commandStream->getMaxAvailableSpace();
     }
 
+    if (extendRange) {
+        // reset of the previous event is the last command in the stream, dispatch it again together with this event
+        commandStream->replaceBuffer(commandStream->getCpuBase(), commandStream->getMaxAvailableSpace());
+        commandStream->getSpace(eventResetRange.cmdBufferStartOffset);
+    } else {
+        eventResetRange = {};
+        eventResetRange.eventPool = event->getEventPool();
+        eventResetRange.eventAllocation = &event->getAllocation(this->device);
+        eventResetRange.startAddress = event->getGpuAddress(this->device);
+        eventResetRange.timestampSizeInDw = event->getTimestampSizeInDw();
+        eventResetRange.cmdBufferAllocation = commandStream->getGraphicsAllocation();
+        eventResetRange.cmdBufferStartOffset = commandStream->getUsed();
+        addEventToResetRange(event, packets, appendPipeControlWithPostSync);
+    }
+
+    appendEventResetRange();
+
+    if (commandStream->getGraphicsAllocation() != eventResetRange.cmdBufferAllocation) {
+        // range was split by command buffer chaining and can not be dispatched again
+        eventResetRange.cmdBufferAllocation = nullptr;
+    }
+    eventResetRange.cmdBufferEndOffset = commandStream->getUsed();
+
     if (NEO::DebugManager.flags.EnableSWTags.get()) {
         neoDevice->getRootDeviceEnvironment().tagsManager->insertTag<GfxFamily, NEO::SWTags::CallNameEndTag>(
             *commandContainer.getCommandStream(),
@@ -2723,6 +2752,21 @@ void CommandListCoreFamily<gfxCoreFamily>::clearCommandsToPatch() {
     commandsToPatch.clear();
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::recordCapturedKernelLaunch(Kernel *kernel, const NEO::EncodeDispatchKernelArgs &dispatchKernelArgs) {
+    if (this->capturedKernelLaunches == nullptr) {
+        return;
+    }
+
+    CapturedKernelLaunch kernelLaunch;
+    kernelLaunch.kernel = kernel;
+    kernelLaunch.crossThreadData.assign(kernel->getCrossThreadData(), kernel->getCrossThreadData() + kernel->getCrossThreadDataSize());
+    kernelLaunch.encodedCrossThreadData = dispatchKernelArgs.outCrossThreadDataPtr;
+    kernelLaunch.encodedInlineData = dispatchKernelArgs.outInlineDataPtr;
+    kernelLaunch.encodedInlineDataSize = dispatchKernelArgs.outInlineDataSize;
+    this->capturedKernelLaunches->push_back(std::move(kernelLaunch));
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 inline size_t CommandListCoreFamily<gfxCoreFamily>::getTotalSizeForCopyRegion(const ze_copy_region_t *region, uint32_t pitch, uint32_t slicePitch) {
     if (region->depth > 1) {
@@ -3115,6 +3159,89 @@ void CommandListCoreFamily<gfxCoreFamily>::dispatchEventPostSyncOperation(Event
     dispatchPostSyncCommands(eventPostSync, gpuAddress, value, useLastPipeControl, event->isSignalScope());
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isEventResetRangeExtendable(Event *event) {
+    auto commandStream = commandContainer.getCommandStream();
+    return this->cmdListType == CommandList::CommandListType::TYPE_REGULAR &&
+           !NEO::DebugManager.flags.EnableSWTags.get() &&
+           eventResetRange.cmdBufferAllocation != nullptr &&
+           eventResetRange.cmdBufferAllocation == commandStream->getGraphicsAllocation() &&
+           eventResetRange.cmdBufferEndOffset == commandStream->getUsed() &&
+           eventResetRange.eventPool == event->getEventPool() &&
+           eventResetRange.endAddress == event->getGpuAddress(this->device);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isEventResetRangeFillAllowed() {
+    auto tagSize = eventResetRange.timestampSizeInDw * sizeof(uint32_t);
+    return isCopyOnly() &&
+           eventResetRange.operations.size() > 1 &&
+           device->getNEODevice()->getGfxCoreHelper().getMaxFillPaternSizeForCopyEngine() >= tagSize;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+size_t CommandListCoreFamily<gfxCoreFamily>::estimateEventResetRangeSize() {
+    auto &rootDeviceEnvironment = device->getNEODevice()->getRootDeviceEnvironment();
+
+    if (isEventResetRangeFillAllowed()) {
+        // fill of the range takes one full blit and one remainder blit at most
+        return 2 * sizeof(typename GfxFamily::XY_COLOR_BLT) + NEO::EncodeMiFlushDW<GfxFamily>::getCommandSizeWithWa(this->dummyBlitWa);
+    }
+
+    size_t operationSize = isCopyOnly() ? NEO::EncodeMiFlushDW<GfxFamily>::getCommandSizeWithWa(this->dummyBlitWa) : NEO::EncodeStoreMemory<GfxFamily>::getStoreDataImmSize();
+    size_t size = 0;
+    for (auto &operation : eventResetRange.operations) {
+        size += operation.operationCount * operationSize;
+    }
+    if (eventResetRange.pipeControlWithPostSync) {
+        size += NEO::MemorySynchronizationCommands<GfxFamily>::getSizeForBarrierWithPostSyncOperation(rootDeviceEnvironment, false);
+    }
+    if (!isCopyOnly() && this->partitionCount > 1) {
+        size += estimateBufferSizeMultiTileBarrier(rootDeviceEnvironment);
+    }
+    return size;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::addEventToResetRange(Event *event, uint32_t packets, bool appendPipeControlWithPostSync) {
+    eventResetRange.operations.push_back(estimateEventPostSync(event, packets));
+    eventResetRange.completionAddresses.push_back(event->getCompletionFieldGpuAddress(this->device));
+    eventResetRange.endAddress = event->getGpuAddress(this->device) + event->getTotalEventSize();
+    eventResetRange.pipeControlWithPostSync |= appendPipeControlWithPostSync;
+    eventResetRange.signalScope |= event->isSignalScope();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::appendEventResetRange() {
+    if (isEventResetRangeFillAllowed()) {
+        // every field of the events is cleared with one fill, the same as on host reset
+        auto allocation = eventResetRange.eventAllocation;
+        auto tagSize = eventResetRange.timestampSizeInDw * sizeof(uint32_t);
+        uint32_t patternToCommand[4] = {Event::STATE_CLEARED, 0u, 0u, 0u};
+        NEO::BlitCommandsHelper<GfxFamily>::dispatchBlitMemoryColorFill(allocation, eventResetRange.startAddress - allocation->getGpuAddress(), patternToCommand, tagSize,
+                                                                        *commandContainer.getCommandStream(),
+                                                                        static_cast<size_t>(eventResetRange.endAddress - eventResetRange.startAddress),
+                                                                        this->dummyBlitWa);
+        NEO::MiFlushArgs miFlushArgs{this->dummyBlitWa};
+        NEO::EncodeMiFlushDW<GfxFamily>::programWithWa(*commandContainer.getCommandStream(), 0, 0, miFlushArgs);
+        makeResidentDummyAllocation();
+        return;
+    }
+
+    auto operationsCount = eventResetRange.operations.size();
+    for (size_t i = 0; i < operationsCount; i++) {
+        // a single barrier after the last store makes all resets of the range visible
+        bool useLastPipeControl = eventResetRange.pipeControlWithPostSync && (i + 1 == operationsCount);
+        dispatchPostSyncCommands(eventResetRange.operations[i], eventResetRange.completionAddresses[i], Event::STATE_CLEARED, useLastPipeControl, eventResetRange.signalScope);
+    }
+
+    if (!isCopyOnly()) {
+        if (this->partitionCount > 1) {
+            appendMultiTileBarrier(*device->getNEODevice());
+        }
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamily<gfxCoreFamily>::dispatchEventRemainingPacketsPostSyncOperation(Event *event) {
     if (this->signalAllEventPackets && event->getPacketsInUse() < event->getMaxPacketsCount()) {
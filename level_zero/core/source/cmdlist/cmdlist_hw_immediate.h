@@ -31,6 +31,8 @@ struct CpuMemCopyInfo {
     const size_t size;
     NEO::SvmAllocationData *dstAllocData{nullptr};
     NEO::SvmAllocationData *srcAllocData{nullptr};
+    TransferType transferType = TRANSFER_TYPE_UNKNOWN;
+    bool latencySampleRequired = false;
 
     CpuMemCopyInfo(void *dstPtr, const void *srcPtr, size_t size) : dstPtr(dstPtr), srcPtr(srcPtr), size(size) {}
 };
@@ -45,6 +47,8 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     using BaseClass::isCopyOnly;
     using BaseClass::isInOrderExecutionEnabled;
 
+    ~CommandListCoreFamilyImmediate() override;
+
     ze_result_t appendLaunchKernel(ze_kernel_handle_t kernelHandle,
                                    const ze_group_count_t *threadGroupDimensions,
                                    ze_event_handle_t hEvent, uint32_t numWaitEvents,
@@ -145,6 +149,11 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
 
     ze_result_t hostSynchronize(uint64_t timeout) override;
 
+    ze_result_t beginCapture() override;
+    ze_result_t endCapture() override;
+    ze_result_t replayCapture() override;
+    ze_result_t patchCapturedKernelArgument(uint32_t launchIndex, uint32_t argIndex, size_t argSize, const void *pArgValue) override;
+
     MOCKABLE_VIRTUAL ze_result_t executeCommandListImmediateWithFlushTask(bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies);
     ze_result_t executeCommandListImmediateWithFlushTaskImpl(bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, CommandQueue *cmdQ);
 
@@ -169,6 +178,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     void checkWaitEventsState(uint32_t numWaitEvents, ze_event_handle_t *waitEventList);
     TransferType getTransferType(NEO::SvmAllocationData *dstAlloc, NEO::SvmAllocationData *srcAlloc);
     size_t getTransferThreshold(TransferType transferType);
+    bool isCopyThresholdCalibrationAllowed(TransferType transferType) const;
     bool isBarrierRequired();
     bool isRelaxedOrderingDispatchAllowed(uint32_t numWaitEvents) const;
 
@@ -182,7 +192,17 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     ze_result_t synchronizeInOrderExecution(uint64_t timeout) const;
 
     MOCKABLE_VIRTUAL void checkAssert();
+    ze_result_t releaseCapture();
+
     std::atomic<bool> dependenciesPresent{false};
+
+    // Appends made between beginCapture and endCapture are encoded once into a regular command list,
+    // which replayCapture submits to the immediate queue. Only kernel arguments can be patched between replays;
+    // other appends are rejected while capture is in progress, so they are never reordered around the template.
+    CommandList *captureCommandList = nullptr;
+    std::vector<std::vector<CapturedKernelLaunch>> capturedLaunches;
+    bool captureInProgress = false;
+    bool captureReplayPending = false;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
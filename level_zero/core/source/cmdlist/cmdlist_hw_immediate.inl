@@ -13,6 +13,7 @@
 #include "shared/source/command_stream/scratch_space_controller.h"
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/debugger/debugger_l0.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/completion_stamp.h"
@@ -20,6 +21,8 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/copy_threshold_calibrator.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
 #include "shared/source/utilities/wait_util.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
@@ -29,6 +32,8 @@
 
 #include "encode_surface_state_args.h"
 
+#include <chrono>
+
 namespace L0 {
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -328,6 +333,18 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
     const CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
 
+    if (this->captureInProgress) {
+        auto captureCommandListHw = static_cast<CommandListCoreFamily<gfxCoreFamily> *>(this->captureCommandList);
+        capturedLaunches.emplace_back();
+        captureCommandListHw->capturedKernelLaunches = &capturedLaunches.back();
+        auto ret = captureCommandListHw->appendLaunchKernel(kernelHandle, threadGroupDimensions, hSignalEvent, numWaitEvents, phWaitEvents, launchParams, false);
+        captureCommandListHw->capturedKernelLaunches = nullptr;
+        if (ret != ZE_RESULT_SUCCESS) {
+            capturedLaunches.pop_back();
+        }
+        return ret;
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -352,6 +369,9 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelIndirect(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t *pDispatchArgumentsBuffer,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -369,6 +389,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendBarrier(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -389,6 +412,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->captureInProgress) {
+        return this->captureCommandList->appendMemoryCopy(dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -400,8 +427,16 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     CpuMemCopyInfo cpuMemCopyInfo(dstptr, srcptr, size);
     this->device->getDriverHandle()->findAllocationDataForRange(const_cast<void *>(srcptr), size, &cpuMemCopyInfo.srcAllocData);
     this->device->getDriverHandle()->findAllocationDataForRange(dstptr, size, &cpuMemCopyInfo.dstAllocData);
+    std::chrono::steady_clock::time_point copyStartTime{};
+    if (this->copyThresholdCalibrator) {
+        copyStartTime = std::chrono::steady_clock::now();
+    }
     if (preferCopyThroughLockedPtr(cpuMemCopyInfo, numWaitEvents, phWaitEvents)) {
         ret = performCpuMemcpy(cpuMemCopyInfo, hSignalEvent, numWaitEvents, phWaitEvents);
+        if (ret == ZE_RESULT_SUCCESS && cpuMemCopyInfo.latencySampleRequired) {
+            auto copyTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - copyStartTime).count();
+            this->copyThresholdCalibrator->recordSample(cpuMemCopyInfo.transferType, NEO::CopyThresholdCalibrator::CopyPath::cpu, size, static_cast<uint64_t>(copyTime));
+        }
         if (ret == ZE_RESULT_SUCCESS || ret == ZE_RESULT_ERROR_DEVICE_LOST) {
             return ret;
         }
@@ -411,14 +446,21 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     auto isSplitNeeded = this->isAppendSplitNeeded(dstptr, srcptr, size, direction);
     if (isSplitNeeded) {
         relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(1); // split generates more than 1 event
-        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, void *, const void *>(this, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, [&](void *dstptrParam, const void *srcptrParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
+        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, void *, const void *>(this, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, MemoryConstants::pageSize64k, 1u, [&](void *dstptrParam, const void *srcptrParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             return CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(dstptrParam, srcptrParam, sizeParam, hSignalEventParam, 0u, nullptr, relaxedOrderingDispatch);
         });
     } else {
         ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(dstptr, srcptr, size, hSignalEvent,
                                                                      numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
     }
-    return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
+    ret = flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
+
+    // GPU copy latency is observable only when the flush waits for completion
+    if (ret == ZE_RESULT_SUCCESS && cpuMemCopyInfo.latencySampleRequired && this->isSyncModeQueue) {
+        auto copyTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - copyStartTime).count();
+        this->copyThresholdCalibrator->recordSample(cpuMemCopyInfo.transferType, NEO::CopyThresholdCalibrator::CopyPath::gpu, size, static_cast<uint64_t>(copyTime));
+    }
+    return ret;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -434,6 +476,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -447,15 +492,35 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     auto isSplitNeeded = this->isAppendSplitNeeded(dstPtr, srcPtr, this->getTotalSizeForCopyRegion(dstRegion, dstPitch, dstSlicePitch), direction);
     if (isSplitNeeded) {
         relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(1); // split generates more than 1 event
-        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uint32_t, uint32_t>(this, dstRegion->originX, srcRegion->originX, dstRegion->width, hSignalEvent, numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, [&](uint32_t dstOriginXParam, uint32_t srcOriginXParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
+        auto &bcsSplit = static_cast<DeviceImp *>(this->device)->bcsSplit;
+        // with weighted split, region is split along its outermost dimension, so each engine copies whole rows or slices
+        const bool splitSlices = bcsSplit.weightedSplit && dstRegion->depth > 1;
+        const bool splitRows = bcsSplit.weightedSplit && !splitSlices && dstRegion->height > 1;
+        auto getSplitOrigin = [&](const ze_copy_region_t *region) { return splitSlices ? region->originZ : (splitRows ? region->originY : region->originX); };
+        auto splitExtent = splitSlices ? dstRegion->depth : (splitRows ? dstRegion->height : dstRegion->width);
+        // subcopy sizes feed the bytes per tick throughput model, so count bytes covered by each split unit
+        size_t bytesPerUnit = splitSlices ? dstSlicePitch : (splitRows ? dstPitch : static_cast<size_t>(dstRegion->height) * dstRegion->depth);
+        ret = bcsSplit.appendSplitCall<gfxCoreFamily, uint32_t, uint32_t>(this, getSplitOrigin(dstRegion), getSplitOrigin(srcRegion), splitExtent, hSignalEvent, numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, 1u, bytesPerUnit, [&](uint32_t dstOriginParam, uint32_t srcOriginParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             ze_copy_region_t dstRegionLocal = {};
             ze_copy_region_t srcRegionLocal = {};
             memcpy(&dstRegionLocal, dstRegion, sizeof(ze_copy_region_t));
             memcpy(&srcRegionLocal, srcRegion, sizeof(ze_copy_region_t));
-            dstRegionLocal.originX = dstOriginXParam;
-            dstRegionLocal.width = static_cast<uint32_t>(sizeParam);
-            srcRegionLocal.originX = srcOriginXParam;
-            srcRegionLocal.width = static_cast<uint32_t>(sizeParam);
+            if (splitSlices) {
+                dstRegionLocal.originZ = dstOriginParam;
+                dstRegionLocal.depth = static_cast<uint32_t>(sizeParam);
+                srcRegionLocal.originZ = srcOriginParam;
+                srcRegionLocal.depth = static_cast<uint32_t>(sizeParam);
+            } else if (splitRows) {
+                dstRegionLocal.originY = dstOriginParam;
+                dstRegionLocal.height = static_cast<uint32_t>(sizeParam);
+                srcRegionLocal.originY = srcOriginParam;
+                srcRegionLocal.height = static_cast<uint32_t>(sizeParam);
+            } else {
+                dstRegionLocal.originX = dstOriginParam;
+                dstRegionLocal.width = static_cast<uint32_t>(sizeParam);
+                srcRegionLocal.originX = srcOriginParam;
+                srcRegionLocal.width = static_cast<uint32_t>(sizeParam);
+            }
             return CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopyRegion(dstPtr, &dstRegionLocal, dstPitch, dstSlicePitch,
                                                                                 srcPtr, &srcRegionLocal, srcPitch, srcSlicePitch,
                                                                                 hSignalEventParam, 0u, nullptr, relaxedOrderingDispatch);
@@ -475,6 +540,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
                                                                             ze_event_handle_t hSignalEvent,
                                                                             uint32_t numWaitEvents,
                                                                             ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -490,6 +558,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_event_handle_t hSignalEvent) {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -502,6 +573,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_event_handle_t hSignalEvent) {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -531,7 +605,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
         relaxedOrdering = isRelaxedOrderingDispatchAllowed(1); // split generates more than 1 event
         uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress());
         uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
-        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uintptr_t, uintptr_t>(this, dstAddress, srcAddress, size, nullptr, 0u, nullptr, false, relaxedOrdering, direction, [&](uintptr_t dstAddressParam, uintptr_t srcAddressParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
+        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uintptr_t, uintptr_t>(this, dstAddress, srcAddress, size, nullptr, 0u, nullptr, false, relaxedOrdering, direction, MemoryConstants::pageSize64k, 1u, [&](uintptr_t dstAddressParam, uintptr_t srcAddressParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             this->appendMemoryCopyBlit(dstAddressParam, dstAllocation, 0u,
                                        srcAddressParam, srcAllocation, 0u,
                                        sizeParam);
@@ -545,6 +619,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingAllowed, bool trackDependencies, bool signalInOrderCompletion) {
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     bool allSignaled = true;
     for (auto i = 0u; i < numEvents; i++) {
         allSignaled &= (!this->dcFlushSupport && Event::fromHandle(phWaitEvents[i])->isAlreadyCompleted());
@@ -565,6 +642,9 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteGlobalTimestamp(
     uint64_t *dstptr, ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace(numWaitEvents, false);
@@ -602,6 +682,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyRegion
                                                                                  ze_event_handle_t hSignalEvent,
                                                                                  uint32_t numWaitEvents,
                                                                                  ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -622,6 +705,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -643,6 +729,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -663,6 +752,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
                                                                                      ze_event_handle_t hSignalEvent,
                                                                                      uint32_t numWaitEvents,
                                                                                      ze_event_handle_t *phWaitEvents) {
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace(numWaitEvents, false);
         checkWaitEventsState(numWaitEvents, phWaitEvents);
@@ -677,6 +769,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchCooperati
                                                                                          ze_event_handle_t hSignalEvent,
                                                                                          uint32_t numWaitEvents,
                                                                                          ze_event_handle_t *waitEventHandles, bool relaxedOrderingDispatch) {
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -688,6 +783,153 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchCooperati
     return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+CommandListCoreFamilyImmediate<gfxCoreFamily>::~CommandListCoreFamilyImmediate() {
+    releaseCapture();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::beginCapture() {
+    if (this->captureInProgress) {
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+    if (isInOrderExecutionEnabled()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto ret = releaseCapture();
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+
+    this->captureCommandList = CommandList::create(this->device->getHwInfo().platform.eProductFamily, this->device, this->engineGroupType, 0u, ret);
+    if (ret != ZE_RESULT_SUCCESS) {
+        this->captureCommandList = nullptr;
+        return ret;
+    }
+    this->captureInProgress = true;
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::endCapture() {
+    if (!this->captureInProgress) {
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+    this->captureInProgress = false;
+    return this->captureCommandList->close();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::replayCapture() {
+    if (this->captureCommandList == nullptr || this->captureInProgress) {
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+
+    auto hCaptureCommandList = this->captureCommandList->toHandle();
+    auto ret = this->cmdQImmediate->executeCommandLists(1, &hCaptureCommandList, nullptr, true);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+
+    if (this->isSyncModeQueue) {
+        return this->cmdQImmediate->synchronize(std::numeric_limits<uint64_t>::max());
+    }
+    this->captureReplayPending = true;
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::patchCapturedKernelArgument(uint32_t launchIndex, uint32_t argIndex, size_t argSize, const void *pArgValue) {
+    if (this->captureCommandList == nullptr || this->captureInProgress) {
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+    if (launchIndex >= capturedLaunches.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    // encoded data may be patched only when no replay is in flight
+    if (this->captureReplayPending) {
+        auto ret = this->cmdQImmediate->synchronize(std::numeric_limits<uint64_t>::max());
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+        this->captureReplayPending = false;
+    }
+
+    for (auto &kernelLaunch : capturedLaunches[launchIndex]) {
+        const auto &explicitArgs = kernelLaunch.kernel->getKernelDescriptor().payloadMappings.explicitArgs;
+        if (argIndex >= explicitArgs.size()) {
+            return ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+        }
+        if (kernelLaunch.encodedInlineDataSize > 0 && kernelLaunch.encodedInlineData == nullptr) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+
+        ArrayRef<uint8_t> crossThreadData(kernelLaunch.crossThreadData.data(), kernelLaunch.crossThreadData.size());
+        const auto &arg = explicitArgs[argIndex];
+        if (arg.is<NEO::ArgDescriptor::ArgTValue>()) {
+            for (const auto &element : arg.as<NEO::ArgDescValue>().elements) {
+                if (element.sourceOffset >= argSize || element.offset + element.size > crossThreadData.size()) {
+                    return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+                }
+                size_t bytesToCopy = std::min(static_cast<size_t>(element.size), argSize - element.sourceOffset);
+                auto pDst = ptrOffset(crossThreadData.begin(), element.offset);
+                if (pArgValue) {
+                    memcpy_s(pDst, element.size, ptrOffset(pArgValue, element.sourceOffset), bytesToCopy);
+                } else {
+                    memset(pDst, 0, bytesToCopy);
+                }
+            }
+        } else if (arg.is<NEO::ArgDescriptor::ArgTPointer>()) {
+            const auto &argAsPtr = arg.as<NEO::ArgDescPointer>();
+            // surface states are not part of the template, so only stateless pointers can be replaced
+            if (NEO::isValidOffset(argAsPtr.bindful) || NEO::isValidOffset(argAsPtr.bindless) || argSize != sizeof(void *)) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+            auto ptr = pArgValue ? *reinterpret_cast<void *const *>(pArgValue) : nullptr;
+            if (ptr) {
+                NEO::SvmAllocationData *allocData = nullptr;
+                if (!this->device->getDriverHandle()->findAllocationDataForRange(ptr, 1, &allocData)) {
+                    return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+                }
+                this->captureCommandList->getCmdContainer().addToResidencyContainer(allocData->gpuAllocations.getGraphicsAllocation(this->device->getRootDeviceIndex()));
+            }
+            NEO::patchPointer(crossThreadData, argAsPtr, reinterpret_cast<uintptr_t>(ptr));
+        } else {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+
+        auto inlineDataSize = std::min(static_cast<size_t>(kernelLaunch.encodedInlineDataSize), crossThreadData.size());
+        if (inlineDataSize > 0) {
+            memcpy_s(kernelLaunch.encodedInlineData, inlineDataSize, crossThreadData.begin(), inlineDataSize);
+        }
+        if (crossThreadData.size() > inlineDataSize) {
+            memcpy_s(kernelLaunch.encodedCrossThreadData, crossThreadData.size() - inlineDataSize,
+                     ptrOffset(crossThreadData.begin(), inlineDataSize), crossThreadData.size() - inlineDataSize);
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::releaseCapture() {
+    if (this->captureCommandList == nullptr) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    auto ret = ZE_RESULT_SUCCESS;
+    if (this->captureReplayPending) {
+        ret = this->cmdQImmediate->synchronize(std::numeric_limits<uint64_t>::max());
+    }
+    this->captureCommandList->destroy();
+    this->captureCommandList = nullptr;
+    this->capturedLaunches.clear();
+    this->captureInProgress = false;
+    this->captureReplayPending = false;
+    return ret;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint64_t timeout) {
     auto syncTaskCount = this->csr->peekTaskCount();
@@ -756,6 +998,7 @@ bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferCopyThroughLockedPtr(C
 
     const TransferType transferType = getTransferType(cpuMemCopyInfo.dstAllocData, cpuMemCopyInfo.srcAllocData);
     const size_t transferThreshold = getTransferThreshold(transferType);
+    cpuMemCopyInfo.transferType = transferType;
 
     bool cpuMemCopyEnabled = false;
 
@@ -785,7 +1028,19 @@ bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferCopyThroughLockedPtr(C
         break;
     }
 
-    return cpuMemCopyEnabled && cpuMemCopyInfo.size <= transferThreshold;
+    bool cpuMemCopyPreferred = cpuMemCopyInfo.size <= transferThreshold;
+    if (cpuMemCopyEnabled && numWaitEvents == 0 && isCopyThresholdCalibrationAllowed(transferType)) {
+        cpuMemCopyInfo.latencySampleRequired = true;
+
+        // GPU path can be explored only when its latency is observable
+        auto pathToExplore = cpuMemCopyPreferred ? NEO::CopyThresholdCalibrator::CopyPath::gpu : NEO::CopyThresholdCalibrator::CopyPath::cpu;
+        bool explorationAllowed = !cpuMemCopyPreferred || this->isSyncModeQueue;
+        if (explorationAllowed && this->copyThresholdCalibrator->isExplorationNeeded(transferType, pathToExplore, cpuMemCopyInfo.size, transferThreshold)) {
+            cpuMemCopyPreferred = !cpuMemCopyPreferred;
+        }
+    }
+
+    return cpuMemCopyEnabled && cpuMemCopyPreferred;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -872,7 +1127,8 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(cons
         signalEvent->setGpuStartTimestamp();
     }
 
-    memcpy_s(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+    auto cpuCopyEngine = this->device->getNEODevice()->getExecutionEnvironment()->getCpuCopyEngine();
+    cpuCopyEngine->copy(cpuMemcpyDstPtr, cpuMemcpySrcPtr, cpuMemCopyInfo.size, dstLockPointer != nullptr, srcLockPointer != nullptr);
 
     if (signalEvent) {
         signalEvent->setGpuEndTimestamp();
@@ -1038,9 +1294,27 @@ size_t CommandListCoreFamilyImmediate<gfxCoreFamily>::getTransferThreshold(Trans
         break;
     }
 
+    if (isCopyThresholdCalibrationAllowed(transferType)) {
+        retVal = this->copyThresholdCalibrator->getThreshold(transferType, retVal);
+    }
+
     return retVal;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isCopyThresholdCalibrationAllowed(TransferType transferType) const {
+    if (this->copyThresholdCalibrator == nullptr) {
+        return false;
+    }
+    if (transferType == HOST_NON_USM_TO_DEVICE_USM && NEO::DebugManager.flags.ExperimentalH2DCpuCopyThreshold.get() != -1) {
+        return false;
+    }
+    if (transferType == DEVICE_USM_TO_HOST_NON_USM && NEO::DebugManager.flags.ExperimentalD2HCpuCopyThreshold.get() != -1) {
+        return false;
+    }
+    return true;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isBarrierRequired() {
     return *this->csr->getBarrierCountTagAddress() < this->csr->peekBarrierCount();
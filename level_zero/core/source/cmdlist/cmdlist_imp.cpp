@@ -217,6 +217,9 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
         }
 
         commandList->copyThroughLockedPtrEnabled = gfxCoreHelper.copyThroughLockedPtrEnabled(hwInfo, device->getProductHelper());
+        if (commandList->copyThroughLockedPtrEnabled) {
+            commandList->copyThresholdCalibrator = deviceImp->copyThresholdCalibrator.get();
+        }
 
         return commandList;
     }
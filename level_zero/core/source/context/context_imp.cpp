@@ -12,6 +12,7 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -30,6 +31,7 @@
 namespace L0 {
 
 ze_result_t ContextImp::destroy() {
+    releaseUsmMemAllocPools();
     while (driverHandle->svmAllocsManager->getNumDeferFreeAllocs() > 0) {
         this->driverHandle->svmAllocsManager->freeSVMAllocDeferImpl();
     }
@@ -128,8 +130,14 @@ ze_result_t ContextImp::allocHostMem(const ze_host_mem_alloc_desc_t *hostDesc,
         unifiedMemoryProperties.allocationFlags.hostptr = reinterpret_cast<uintptr_t>(*ptr);
     }
 
-    auto usmPtr = this->driverHandle->svmAllocsManager->createHostUnifiedMemoryAllocation(size,
-                                                                                          unifiedMemoryProperties);
+    auto usmPtr = allocateFromUsmMemAllocPool(size, unifiedMemoryProperties);
+    if (usmPtr) {
+        *ptr = usmPtr;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    usmPtr = this->driverHandle->svmAllocsManager->createHostUnifiedMemoryAllocation(size,
+                                                                                     unifiedMemoryProperties);
     if (usmPtr == nullptr) {
         if (driverHandle->svmAllocsManager->getNumDeferFreeAllocs() > 0) {
             this->driverHandle->svmAllocsManager->freeSVMAllocDeferImpl();
@@ -148,6 +156,64 @@ ze_result_t ContextImp::allocHostMem(const ze_host_mem_alloc_desc_t *hostDesc,
     return ZE_RESULT_SUCCESS;
 }
 
+void *ContextImp::allocateFromUsmMemAllocPool(size_t size, const NEO::SVMAllocsManager::UnifiedMemoryProperties &memoryProperties) {
+    bool hostPool = memoryProperties.memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY;
+    auto poolSize = NEO::UsmMemAllocPool::getPoolSize(hostPool ? NEO::DebugManager.flags.EnableHostUsmAllocationPool.get()
+                                                               : NEO::DebugManager.flags.EnableDeviceUsmAllocationPool.get());
+    if (poolSize == 0u) {
+        return nullptr;
+    }
+
+    NEO::UsmMemAllocPool *pool = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(usmMemAllocPoolsMutex);
+        auto &poolEntry = hostPool ? usmHostMemAllocPool : usmDeviceMemAllocPools[memoryProperties.device];
+        if (poolEntry == nullptr) {
+            // pool is created with default properties, so only plain allocations are serviced from it
+            NEO::SVMAllocsManager::UnifiedMemoryProperties poolProperties(memoryProperties.memoryType,
+                                                                          MemoryConstants::pageSize64k,
+                                                                          memoryProperties.rootDeviceIndices,
+                                                                          memoryProperties.subdeviceBitfields);
+            poolProperties.device = memoryProperties.device;
+            poolEntry = std::make_unique<NEO::UsmMemAllocPool>();
+            poolEntry->initialize(this->driverHandle->svmAllocsManager, poolProperties, poolSize, NEO::UsmMemAllocPool::getMaxServicedSize());
+        }
+        pool = poolEntry.get();
+    }
+    return pool->createUnifiedMemoryAllocation(size, memoryProperties);
+}
+
+NEO::UsmMemAllocPool *ContextImp::getUsmMemAllocPool(const void *ptr) {
+    std::lock_guard<std::mutex> lock(usmMemAllocPoolsMutex);
+    if (usmHostMemAllocPool && usmHostMemAllocPool->isInPool(ptr)) {
+        return usmHostMemAllocPool.get();
+    }
+    for (auto &devicePool : usmDeviceMemAllocPools) {
+        if (devicePool.second->isInPool(ptr)) {
+            return devicePool.second.get();
+        }
+    }
+    return nullptr;
+}
+
+void ContextImp::releaseUsmMemAllocPools() {
+    std::lock_guard<std::mutex> lock(usmMemAllocPoolsMutex);
+    auto releasePool = [this](NEO::UsmMemAllocPool &pool) {
+        if (pool.isInitialized()) {
+            for (auto pairDevice : this->devices) {
+                this->freePeerAllocations(pool.getPoolAddress(), true, Device::fromHandle(pairDevice.second));
+            }
+            pool.cleanup();
+        }
+    };
+    if (usmHostMemAllocPool) {
+        releasePool(*usmHostMemAllocPool);
+    }
+    for (auto &devicePool : usmDeviceMemAllocPools) {
+        releasePool(*devicePool.second);
+    }
+}
+
 bool ContextImp::isDeviceDefinedForThisContext(Device *inDevice) {
     uint32_t deviceIndex = inDevice->getRootDeviceIndex();
     return (this->getDevices().find(deviceIndex) != this->getDevices().end());
@@ -235,8 +301,13 @@ ze_result_t ContextImp::allocDeviceMem(ze_device_handle_t hDevice,
         unifiedMemoryProperties.allocationFlags.flags.resource48Bit = productHelper.is48bResourceNeededForRayTracing();
     }
 
-    void *usmPtr =
-        this->driverHandle->svmAllocsManager->createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    void *usmPtr = allocateFromUsmMemAllocPool(size, unifiedMemoryProperties);
+    if (usmPtr) {
+        *ptr = usmPtr;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    usmPtr = this->driverHandle->svmAllocsManager->createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
     if (usmPtr == nullptr) {
         if (driverHandle->svmAllocsManager->getNumDeferFreeAllocs() > 0) {
             this->driverHandle->svmAllocsManager->freeSVMAllocDeferImpl();
@@ -398,6 +469,11 @@ ze_result_t ContextImp::freeMem(const void *ptr) {
 }
 
 ze_result_t ContextImp::freeMem(const void *ptr, bool blocking) {
+    auto usmPool = getUsmMemAllocPool(ptr);
+    if (usmPool) {
+        return usmPool->freeSVMAlloc(ptr, blocking) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
     auto allocation = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocation == nullptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
@@ -429,6 +505,10 @@ ze_result_t ContextImp::freeMemExt(const ze_memory_free_ext_desc_t *pMemFreeDesc
         return this->freeMem(ptr, true);
     }
     if (pMemFreeDesc->freePolicy == ZE_DRIVER_MEMORY_FREE_POLICY_EXT_FLAG_DEFER_FREE) {
+        if (getUsmMemAllocPool(ptr)) {
+            return this->freeMem(ptr, false);
+        }
+
         auto allocation = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
         if (allocation == nullptr) {
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
@@ -515,6 +595,21 @@ ze_result_t ContextImp::evictImage(ze_device_handle_t hDevice, ze_image_handle_t
 ze_result_t ContextImp::getMemAddressRange(const void *ptr,
                                            void **pBase,
                                            size_t *pSize) {
+    auto usmPool = getUsmMemAllocPool(ptr);
+    if (usmPool) {
+        auto pooledBase = usmPool->getPooledAllocationBasePtr(ptr);
+        if (pooledBase == nullptr) {
+            return ZE_RESULT_ERROR_UNKNOWN;
+        }
+        if (pBase) {
+            *pBase = pooledBase;
+        }
+        if (pSize) {
+            *pSize = usmPool->getPooledAllocationSize(ptr);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
     NEO::SvmAllocationData *allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocData) {
         NEO::GraphicsAllocation *alloc;
@@ -577,6 +672,11 @@ void ContextImp::setIPCHandleData(NEO::GraphicsAllocation *graphicsAllocation, u
 
 ze_result_t ContextImp::getIpcMemHandle(const void *ptr,
                                         ze_ipc_mem_handle_t *pIpcHandle) {
+    // exported handle would share whole pool, not only the requested allocation
+    if (getUsmMemAllocPool(ptr)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
     NEO::SvmAllocationData *allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocData) {
         auto *memoryManager = driverHandle->getMemoryManager();
@@ -632,6 +732,10 @@ ze_result_t ContextImp::getFdFromIpcHandle(ze_ipc_mem_handle_t ipcHandle, uint64
 ze_result_t ContextImp::getIpcMemHandles(const void *ptr,
                                          uint32_t *numIpcHandles,
                                          ze_ipc_mem_handle_t *pIpcHandles) {
+    if (getUsmMemAllocPool(ptr)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
     NEO::SvmAllocationData *allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocData) {
         auto alloc = allocData->gpuAllocations.getDefaultGraphicsAllocation();
@@ -800,14 +904,15 @@ ze_result_t ContextImp::getMemAllocProperties(const void *ptr,
                                               ze_memory_allocation_properties_t *pMemAllocProperties,
                                               ze_device_handle_t *phDevice) {
     const auto alloc = driverHandle->svmAllocsManager->getSVMAlloc(ptr);
-    if (nullptr == alloc) {
+    auto usmPool = getUsmMemAllocPool(ptr);
+    if (nullptr == alloc || (usmPool && !usmPool->isPooledAllocation(ptr))) {
         pMemAllocProperties->type = ZE_MEMORY_TYPE_UNKNOWN;
         return ZE_RESULT_SUCCESS;
     }
 
     pMemAllocProperties->type = Context::parseUSMType(alloc->memoryType);
     pMemAllocProperties->pageSize = alloc->pageSizeForAlignment;
-    pMemAllocProperties->id = alloc->getAllocId();
+    pMemAllocProperties->id = usmPool ? usmPool->getPooledAllocationId(ptr) : alloc->getAllocId();
 
     if (phDevice != nullptr) {
         if (alloc->device == nullptr) {
@@ -821,6 +926,10 @@ ze_result_t ContextImp::getMemAllocProperties(const void *ptr,
     if (pMemAllocProperties->pNext == nullptr) {
         return ZE_RESULT_SUCCESS;
     }
+    if (usmPool) {
+        // extensions export or describe the whole pool allocation
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     return handleAllocationExtensions(alloc->gpuAllocations.getDefaultGraphicsAllocation(),
                                       pMemAllocProperties->type,
                                       pMemAllocProperties->pNext,
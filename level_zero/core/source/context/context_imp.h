@@ -8,11 +8,14 @@
 #pragma once
 
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/unified_memory_pooling.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "level_zero/core/source/context/context.h"
 
 #include <map>
+#include <memory>
+#include <mutex>
 
 namespace L0 {
 struct StructuresLookupTable;
@@ -186,7 +189,12 @@ struct ContextImp : Context {
     std::map<uint64_t, IpcHandleTracking *> &getIPCHandleMap() { return this->ipcHandles; };
     [[nodiscard]] std::unique_lock<std::mutex> lockIPCHandleMap() { return std::unique_lock<std::mutex>(this->ipcHandleMapMutex); };
 
+    NEO::UsmMemAllocPool *getUsmMemAllocPool(const void *ptr);
+    NEO::UsmMemAllocPool *getUsmHostMemAllocPool() { return usmHostMemAllocPool.get(); }
+
   protected:
+    void *allocateFromUsmMemAllocPool(size_t size, const NEO::SVMAllocsManager::UnifiedMemoryProperties &memoryProperties);
+    void releaseUsmMemAllocPools();
     void setIPCHandleData(NEO::GraphicsAllocation *graphicsAllocation, uint64_t handle, IpcMemoryData &ipcData, uint64_t ptrAddress, uint8_t type);
     bool isAllocationSuitableForCompression(const StructuresLookupTable &structuresLookupTable, Device &device, size_t allocSize);
     size_t getPageSizeRequired(size_t size);
@@ -197,6 +205,10 @@ struct ContextImp : Context {
     std::vector<ze_device_handle_t> deviceHandles;
     DriverHandleImp *driverHandle = nullptr;
     uint32_t numDevices = 0;
+
+    std::unique_ptr<NEO::UsmMemAllocPool> usmHostMemAllocPool;
+    std::map<NEO::Device *, std::unique_ptr<NEO::UsmMemAllocPool>> usmDeviceMemAllocPools;
+    std::mutex usmMemAllocPoolsMutex;
 };
 
 } // namespace L0
@@ -13,6 +13,8 @@
 
 #include "level_zero/core/source/device/device_imp.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr) {
@@ -66,6 +68,9 @@ bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_
         this->cmdQs.push_back(commandQueue);
     }
 
+    this->engineThroughput.assign(this->cmdQs.size(), 0u);
+    this->weightedSplit = NEO::DebugManager.flags.SplitBcsWeighted.get() == 1;
+
     if (NEO::DebugManager.flags.SplitBcsMaskH2D.get() > 0) {
         this->h2dEngines = NEO::DebugManager.flags.SplitBcsMaskH2D.get();
     }
@@ -100,6 +105,7 @@ void BcsSplit::releaseResources() {
         cmdQs.clear();
         d2hCmdQs.clear();
         h2dCmdQs.clear();
+        engineThroughput.clear();
         this->events.releaseResources();
     }
 }
@@ -114,11 +120,76 @@ std::vector<CommandQueue *> &BcsSplit::getCmdQsForSplit(NEO::TransferDirection d
     return this->cmdQs;
 }
 
+size_t BcsSplit::getEngineIndex(CommandQueue *cmdQ) const {
+    auto it = std::find(this->cmdQs.begin(), this->cmdQs.end(), cmdQ);
+    UNRECOVERABLE_IF(it == this->cmdQs.end());
+    return static_cast<size_t>(it - this->cmdQs.begin());
+}
+
+void BcsSplit::getChunkSizes(const std::vector<CommandQueue *> &cmdQsForSplit, size_t size, uint64_t dstAddress, size_t chunkAlignment, StackVec<size_t, 4> &chunkSizes) {
+    auto engineCount = cmdQsForSplit.size();
+    chunkSizes.clear();
+
+    if (!this->weightedSplit || size < engineCount) {
+        auto remainingSize = size;
+        for (size_t i = 0; i < engineCount; i++) {
+            auto localSize = remainingSize / (engineCount - i);
+            chunkSizes.push_back(localSize);
+            remainingSize -= localSize;
+        }
+        return;
+    }
+
+    StackVec<uint64_t, 4> weights;
+    uint64_t totalWeight = 0u;
+    {
+        std::lock_guard<std::mutex> lock(this->events.mtx);
+        for (auto &cmdQ : cmdQsForSplit) {
+            weights.push_back(this->engineThroughput[getEngineIndex(cmdQ)]);
+        }
+    }
+    for (auto &weight : weights) {
+        if (weight == 0u) {
+            // not all engines measured yet, split evenly
+            std::fill(weights.begin(), weights.end(), 1u);
+            break;
+        }
+    }
+    for (auto &weight : weights) {
+        totalWeight += weight;
+    }
+
+    // chunk boundaries are aligned relative to dstAddress, so an unaligned destination gets a shorter first chunk
+    size_t dstMisalignment = chunkAlignment > 1u ? static_cast<size_t>(dstAddress % chunkAlignment) : 0u;
+    if (chunkAlignment == 0u || size < chunkAlignment * engineCount + dstMisalignment) {
+        chunkAlignment = 1u;
+        dstMisalignment = 0u;
+    }
+
+    size_t chunkStart = dstMisalignment;
+    const size_t copyEnd = dstMisalignment + size;
+    for (size_t i = 0; i < engineCount; i++) {
+        auto enginesLeft = engineCount - i - 1;
+        size_t chunkEnd = copyEnd;
+        if (enginesLeft > 0u) {
+            chunkEnd = chunkStart + static_cast<size_t>(static_cast<double>(size) * weights[i] / totalWeight);
+            chunkEnd = alignDown(chunkEnd, chunkAlignment);
+            chunkEnd = std::max(chunkEnd, alignUp(chunkStart + 1u, chunkAlignment));
+            chunkEnd = std::min(chunkEnd, alignDown(copyEnd - enginesLeft * chunkAlignment, chunkAlignment));
+        }
+        chunkSizes.push_back(chunkEnd - chunkStart);
+        chunkStart = chunkEnd;
+    }
+}
+
 size_t BcsSplit::Events::obtainForSplit(Context *context, size_t maxEventCountInPool) {
     std::lock_guard<std::mutex> lock(this->mtx);
     for (size_t i = 0; i < this->marker.size(); i++) {
         auto ret = this->marker[i]->queryStatus();
         if (ret == ZE_RESULT_SUCCESS) {
+            if (this->bcsSplit.weightedSplit) {
+                this->collectSubcopyThroughput(i);
+            }
             this->marker[i]->reset();
             this->barrier[i]->reset();
             for (size_t j = 0; j < this->bcsSplit.cmdQs.size(); j++) {
@@ -145,6 +216,9 @@ size_t BcsSplit::Events::allocateNew(Context *context, size_t maxEventCountInPoo
         ze_event_pool_desc_t desc{};
         desc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
         desc.count = static_cast<uint32_t>(maxEventCountInPool);
+        if (this->bcsSplit.weightedSplit) {
+            desc.flags = ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+        }
         auto hDevice = this->bcsSplit.device.toHandle();
         auto pool = EventPool::create(this->bcsSplit.device.getDriverHandle(), context, 1, &hDevice, &desc, result);
         this->pools.push_back(pool);
@@ -175,11 +249,36 @@ size_t BcsSplit::Events::allocateNew(Context *context, size_t maxEventCountInPoo
             this->barrier.push_back(Event::fromHandle(hEvent));
         } else {
             this->subcopy.push_back(Event::fromHandle(hEvent));
+            this->subcopySize.push_back(0u);
+            this->subcopyEngine.push_back(0u);
         }
     }
 
     return this->marker.size() - 1;
 }
+
+void BcsSplit::Events::collectSubcopyThroughput(size_t markerIndex) {
+    auto engineCount = this->bcsSplit.cmdQs.size();
+    for (size_t j = 0; j < engineCount; j++) {
+        auto subcopyIndex = markerIndex * engineCount + j;
+        auto copiedSize = this->subcopySize[subcopyIndex];
+        this->subcopySize[subcopyIndex] = 0u;
+        if (copiedSize == 0u) {
+            continue;
+        }
+
+        ze_kernel_timestamp_result_t timestamp = {};
+        if (this->subcopy[subcopyIndex]->queryKernelTimestamp(&timestamp) != ZE_RESULT_SUCCESS ||
+            timestamp.context.kernelEnd <= timestamp.context.kernelStart) {
+            continue;
+        }
+
+        auto measuredThroughput = std::max(static_cast<uint64_t>(copiedSize / (timestamp.context.kernelEnd - timestamp.context.kernelStart)), static_cast<uint64_t>(1u));
+        auto &throughput = this->bcsSplit.engineThroughput[this->subcopyEngine[subcopyIndex]];
+        throughput = (throughput == 0u) ? measuredThroughput : (3 * throughput + measuredThroughput) / 4;
+    }
+}
+
 void BcsSplit::Events::releaseResources() {
     for (auto &markerEvent : this->marker) {
         markerEvent->destroy();
@@ -189,6 +288,8 @@ void BcsSplit::Events::releaseResources() {
         subcopyEvent->destroy();
     }
     subcopy.clear();
+    subcopySize.clear();
+    subcopyEngine.clear();
     for (auto &barrierEvent : this->barrier) {
         barrierEvent->destroy();
     }
@@ -18,6 +18,7 @@
 
 #include <functional>
 #include <mutex>
+#include <type_traits>
 #include <vector>
 
 namespace NEO {
@@ -42,10 +43,13 @@ struct BcsSplit {
         std::vector<Event *> barrier;
         std::vector<Event *> subcopy;
         std::vector<Event *> marker;
+        std::vector<size_t> subcopySize;
+        std::vector<size_t> subcopyEngine;
         size_t createdFromLatestPool = 0u;
 
         size_t obtainForSplit(Context *context, size_t maxEventCountInPool);
         size_t allocateNew(Context *context, size_t maxEventCountInPool);
+        void collectSubcopyThroughput(size_t markerIndex);
 
         void releaseResources();
 
@@ -60,6 +64,10 @@ struct BcsSplit {
     NEO::BcsInfoMask h2dEngines = NEO::EngineHelpers::h2dCopyEngineMask;
     NEO::BcsInfoMask d2hEngines = NEO::EngineHelpers::d2hCopyEngineMask;
 
+    // Bytes per timestamp tick measured for each engine in cmdQs, 0 until first measurement
+    std::vector<uint64_t> engineThroughput;
+    bool weightedSplit = false;
+
     template <GFXCORE_FAMILY gfxCoreFamily, typename T, typename K>
     ze_result_t appendSplitCall(CommandListCoreFamilyImmediate<gfxCoreFamily> *cmdList,
                                 T dstptr,
@@ -71,6 +79,8 @@ struct BcsSplit {
                                 bool performMigration,
                                 bool hasRelaxedOrderingDependencies,
                                 NEO::TransferDirection direction,
+                                size_t chunkAlignment,
+                                size_t bytesPerUnit,
                                 std::function<ze_result_t(T, K, size_t, ze_event_handle_t)> appendCall) {
         ze_result_t result = ZE_RESULT_SUCCESS;
 
@@ -86,25 +96,43 @@ struct BcsSplit {
 
         auto &cmdQsForSplit = this->getCmdQsForSplit(direction);
 
+        uint64_t dstAddress = 0u;
+        if constexpr (std::is_pointer_v<T>) {
+            dstAddress = castToUint64(dstptr);
+        } else {
+            dstAddress = static_cast<uint64_t>(dstptr);
+        }
+
+        StackVec<size_t, 4> chunkSizes;
+        this->getChunkSizes(cmdQsForSplit, size, dstAddress, chunkAlignment, chunkSizes);
+
         auto totalSize = size;
-        auto engineCount = cmdQsForSplit.size();
         for (size_t i = 0; i < cmdQsForSplit.size(); i++) {
+            auto localSize = chunkSizes[i];
+            if (localSize == 0u) {
+                continue;
+            }
+
             if (barrierRequired) {
                 auto barrierEventHandle = this->events.barrier[markerEventIndex]->toHandle();
                 cmdList->addEventsToCmdList(1u, &barrierEventHandle, hasRelaxedOrderingDependencies, false);
             }
 
             cmdList->addEventsToCmdList(numWaitEvents, phWaitEvents, hasRelaxedOrderingDependencies, false);
-            if (hSignalEvent && i == 0u) {
+            if (hSignalEvent && eventHandles.empty()) {
                 cmdList->appendEventForProfilingAllWalkers(Event::fromHandle(hSignalEvent), true, true);
             }
 
-            auto localSize = totalSize / engineCount;
             auto localDstPtr = ptrOffset(dstptr, size - totalSize);
             auto localSrcPtr = ptrOffset(srcptr, size - totalSize);
 
             auto eventHandle = this->events.subcopy[subcopyEventIndex + i]->toHandle();
             result = appendCall(localDstPtr, localSrcPtr, localSize, eventHandle);
+            {
+                std::lock_guard<std::mutex> lock(this->events.mtx);
+                this->events.subcopySize[subcopyEventIndex + i] = localSize * bytesPerUnit;
+                this->events.subcopyEngine[subcopyEventIndex + i] = this->getEngineIndex(cmdQsForSplit[i]);
+            }
 
             if (cmdList->flushTaskSubmissionEnabled()) {
                 cmdList->executeCommandListImmediateWithFlushTaskImpl(performMigration, false, hasRelaxedOrderingDependencies, cmdQsForSplit[i]);
@@ -115,14 +143,13 @@ struct BcsSplit {
             eventHandles.push_back(eventHandle);
 
             totalSize -= localSize;
-            engineCount--;
 
             if (hSignalEvent) {
                 Event::fromHandle(hSignalEvent)->appendAdditionalCsr(static_cast<CommandQueueImp *>(cmdQsForSplit[i])->getCsr());
             }
         }
 
-        cmdList->addEventsToCmdList(static_cast<uint32_t>(cmdQsForSplit.size()), eventHandles.data(), hasRelaxedOrderingDependencies, false);
+        cmdList->addEventsToCmdList(static_cast<uint32_t>(eventHandles.size()), eventHandles.data(), hasRelaxedOrderingDependencies, false);
         if (hSignalEvent) {
             cmdList->appendEventForProfilingAllWalkers(Event::fromHandle(hSignalEvent), false, true);
         }
@@ -134,6 +161,8 @@ struct BcsSplit {
     bool setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr);
     void releaseResources();
     std::vector<CommandQueue *> &getCmdQsForSplit(NEO::TransferDirection direction);
+    size_t getEngineIndex(CommandQueue *cmdQ) const;
+    void getChunkSizes(const std::vector<CommandQueue *> &cmdQsForSplit, size_t size, uint64_t dstAddress, size_t chunkAlignment, StackVec<size_t, 4> &chunkSizes);
 
     BcsSplit(DeviceImp &device) : device(device), events(*this){};
 };
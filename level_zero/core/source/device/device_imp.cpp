@@ -11,6 +11,7 @@
 #include "shared/source/built_ins/sip.h"
 #include "shared/source/command_container/implicit_scaling.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device/device_info.h"
@@ -35,6 +36,7 @@
 #include "shared/source/os_interface/os_time.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
+#include "shared/source/utilities/copy_threshold_calibrator.h"
 #include "shared/source/utilities/debug_settings_reader_creator.h"
 
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
@@ -56,7 +58,10 @@
 #include "level_zero/tools/source/metrics/metric.h"
 #include "level_zero/tools/source/sysman/sysman.h"
 
+#include "os_inc.h"
+
 #include <algorithm>
+#include <sstream>
 
 namespace NEO {
 bool releaseFP64Override();
@@ -1147,6 +1152,7 @@ Device *Device::create(DriverHandle *driverHandle, NEO::Device *neoDevice, bool
 
     auto osInterface = rootDeviceEnvironment.osInterface.get();
     device->driverInfo.reset(NEO::DriverInfo::create(&hwInfo, osInterface));
+    device->createCopyThresholdCalibrator();
 
     auto debugSurfaceSize = gfxCoreHelper.getSipKernelMaxDbgSurfaceSize(hwInfo);
     std::vector<char> stateSaveAreaHeader;
@@ -1253,6 +1259,7 @@ void DeviceImp::releaseResources() {
     UNRECOVERABLE_IF(neoDevice == nullptr);
 
     this->bcsSplit.releaseResources();
+    releaseCopyThresholdCalibrator();
 
     if (neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->debugger.get() &&
         !neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->debugger->isLegacy()) {
@@ -1304,6 +1311,37 @@ void DeviceImp::releaseResources() {
     resourcesReleased = true;
 }
 
+void DeviceImp::createCopyThresholdCalibrator() {
+    if (NEO::DebugManager.flags.EnableCopyThresholdCalibration.get() != 1) {
+        return;
+    }
+    copyThresholdCalibrator = std::make_unique<NEO::CopyThresholdCalibrator>();
+
+    auto cacheConfig = NEO::getDefaultCompilerCacheConfig();
+    if (cacheConfig.enabled) {
+        std::stringstream fileName;
+        fileName << cacheConfig.cacheDir << PATH_SEPARATOR << "copy_thresholds_" << std::hex
+                 << neoDevice->getHardwareInfo().platform.usDeviceID << "_"
+                 << neoDevice->getHardwareInfo().platform.usRevId << "_"
+                 << neoDevice->getRootDeviceIndex() << "_"
+                 << neoDevice->getDeviceBitfield().to_ulong() << ".txt";
+        copyThresholdCalibrationFile = fileName.str();
+        copyThresholdCalibrator->loadFromFile(copyThresholdCalibrationFile);
+    }
+}
+
+void DeviceImp::releaseCopyThresholdCalibrator() {
+    if (!copyThresholdCalibrator) {
+        return;
+    }
+    PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintCopyThresholdCalibration.get(), stdout, "Copy threshold calibration for root device %u, device bitfield 0x%lx:\n%s",
+                       neoDevice->getRootDeviceIndex(), neoDevice->getDeviceBitfield().to_ulong(), copyThresholdCalibrator->serialize().c_str());
+    if (!copyThresholdCalibrationFile.empty() && copyThresholdCalibrator->isDirty()) {
+        copyThresholdCalibrator->saveToFile(copyThresholdCalibrationFile);
+    }
+    copyThresholdCalibrator.reset();
+}
+
 DeviceImp::~DeviceImp() {
     releaseResources();
 
@@ -21,6 +21,7 @@
 
 namespace NEO {
 class AllocationsList;
+class CopyThresholdCalibrator;
 class DriverInfo;
 } // namespace NEO
 
@@ -129,6 +130,11 @@ struct DeviceImp : public Device {
 
     BcsSplit bcsSplit;
 
+    std::unique_ptr<NEO::CopyThresholdCalibrator> copyThresholdCalibrator;
+    std::string copyThresholdCalibrationFile;
+    void createCopyThresholdCalibrator();
+    void releaseCopyThresholdCalibrator();
+
     bool resourcesReleased = false;
     void releaseResources();
 
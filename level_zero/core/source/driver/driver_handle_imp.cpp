@@ -157,6 +157,7 @@ DriverHandleImp::~DriverHandleImp() {
         if (this->svmAllocsManager) {
             this->svmAllocsManager->trimUSMDeviceAllocCache();
         }
+        releaseRecycledEventPoolAllocations();
     }
 
     for (auto &device : this->devices) {
@@ -888,4 +889,49 @@ uint32_t DriverHandleImp::getEventMaxKernelCount(uint32_t numDevices, ze_device_
     return maxCount;
 }
 
+bool DriverHandleImp::recycleEventPoolAllocation(RecycledEventPoolAllocation &allocation) {
+    auto maxRecycledAllocations = NEO::DebugManager.flags.EnableEventPoolRecycling.get();
+    if (maxRecycledAllocations <= 0) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(recycledEventPoolAllocationsMutex);
+    if (recycledEventPoolAllocations.size() >= static_cast<size_t>(maxRecycledAllocations)) {
+        freeEventPoolAllocations(*recycledEventPoolAllocations.front().allocations);
+        recycledEventPoolAllocations.erase(recycledEventPoolAllocations.begin());
+    }
+    recycledEventPoolAllocations.push_back(std::move(allocation));
+    return true;
+}
+
+bool DriverHandleImp::obtainRecycledEventPoolAllocation(RecycledEventPoolAllocation &allocation) {
+    std::lock_guard<std::mutex> lock(recycledEventPoolAllocationsMutex);
+    for (auto it = recycledEventPoolAllocations.rbegin(); it != recycledEventPoolAllocations.rend(); it++) {
+        if (it->eventPoolSize == allocation.eventPoolSize &&
+            it->allocationType == allocation.allocationType &&
+            it->isDeviceEventPoolAllocation == allocation.isDeviceEventPoolAllocation &&
+            it->devices == allocation.devices) {
+            allocation.allocations = std::move(it->allocations);
+            allocation.eventPoolPtr = it->eventPoolPtr;
+            recycledEventPoolAllocations.erase(std::next(it).base());
+            return true;
+        }
+    }
+    return false;
+}
+
+void DriverHandleImp::releaseRecycledEventPoolAllocations() {
+    std::lock_guard<std::mutex> lock(recycledEventPoolAllocationsMutex);
+    for (auto &recycledAllocation : recycledEventPoolAllocations) {
+        freeEventPoolAllocations(*recycledAllocation.allocations);
+    }
+    recycledEventPoolAllocations.clear();
+}
+
+void DriverHandleImp::freeEventPoolAllocations(NEO::MultiGraphicsAllocation &allocations) {
+    for (auto graphicsAllocation : allocations.getGraphicsAllocations()) {
+        memoryManager->freeGraphicsMemory(graphicsAllocation);
+    }
+}
+
 } // namespace L0
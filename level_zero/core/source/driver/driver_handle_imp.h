@@ -9,8 +9,10 @@
 
 #include "shared/source/debugger/debugger.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/multi_graphics_allocation.h"
 
 #include "level_zero/api/extensions/public/ze_exp_ext.h"
+#include "level_zero/core/source/builtin/builtin_binary_cache.h"
 #include "level_zero/core/source/driver/driver_handle.h"
 #include "level_zero/core/source/get_extension_function_lookup_map.h"
 
@@ -23,6 +25,15 @@ struct FabricVertex;
 struct FabricEdge;
 struct Image;
 
+struct RecycledEventPoolAllocation {
+    std::vector<Device *> devices;
+    std::unique_ptr<NEO::MultiGraphicsAllocation> allocations;
+    void *eventPoolPtr = nullptr;
+    size_t eventPoolSize = 0u;
+    NEO::AllocationType allocationType = NEO::AllocationType::UNKNOWN;
+    bool isDeviceEventPoolAllocation = false;
+};
+
 struct DriverHandleImp : public DriverHandle {
     ~DriverHandleImp() override;
     DriverHandleImp();
@@ -92,13 +103,23 @@ struct DriverHandleImp : public DriverHandle {
     uint32_t getEventMaxPacketCount(uint32_t numDevices, ze_device_handle_t *deviceHandles) const override;
     uint32_t getEventMaxKernelCount(uint32_t numDevices, ze_device_handle_t *deviceHandles) const override;
 
+    bool recycleEventPoolAllocation(RecycledEventPoolAllocation &allocation);
+    bool obtainRecycledEventPoolAllocation(RecycledEventPoolAllocation &allocation);
+    void releaseRecycledEventPoolAllocations();
+    void freeEventPoolAllocations(NEO::MultiGraphicsAllocation &allocations);
+
     std::unique_ptr<HostPointerManager> hostPointerManager;
+    BuiltinBinaryCache builtinBinaryCache;
     // Experimental functions
     std::unordered_map<std::string, void *> extensionFunctionsLookupMap;
 
     std::mutex sharedMakeResidentAllocationsLock;
     std::map<void *, NEO::GraphicsAllocation *> sharedMakeResidentAllocations;
 
+    // allocations of destroyed event pools, most recently recycled last
+    std::mutex recycledEventPoolAllocationsMutex;
+    std::vector<RecycledEventPoolAllocation> recycledEventPoolAllocations;
+
     std::vector<Device *> devices;
     std::vector<FabricVertex *> fabricVertices;
     std::vector<FabricEdge *> fabricEdges;
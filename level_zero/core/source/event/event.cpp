@@ -16,6 +16,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -33,6 +34,7 @@
 #include "level_zero/core/source/event/event_impl.inl"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 
+#include <algorithm>
 #include <set>
 
 namespace L0 {
@@ -93,6 +95,21 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
     if (this->isDeviceEventPoolAllocation) {
         allocationType = NEO::AllocationType::GPU_TIMESTAMP_DEVICE_BUFFER;
     }
+    this->allocationType = allocationType;
+
+    if (isEventPoolAllocationRecyclable()) {
+        RecycledEventPoolAllocation recycledAllocation;
+        recycledAllocation.devices = devices;
+        recycledAllocation.eventPoolSize = eventPoolSize;
+        recycledAllocation.allocationType = allocationType;
+        recycledAllocation.isDeviceEventPoolAllocation = isDeviceEventPoolAllocation;
+        if (driverHandleImp->obtainRecycledEventPoolAllocation(recycledAllocation)) {
+            eventPoolAllocations = std::move(recycledAllocation.allocations);
+            eventPoolPtr = recycledAllocation.eventPoolPtr;
+            this->isHostVisibleEventPoolAllocation = this->isDeviceEventPoolAllocation ? !(isEventPoolDeviceAllocationFlagSet()) : true;
+            return ZE_RESULT_SUCCESS;
+        }
+    }
 
     eventPoolAllocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
 
@@ -138,6 +155,19 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
 }
 
 EventPool::~EventPool() {
+    if (eventPoolAllocations && eventPoolAllocations->getDefaultGraphicsAllocation() && isEventPoolAllocationRecyclable()) {
+        RecycledEventPoolAllocation recycledAllocation;
+        recycledAllocation.devices = devices;
+        recycledAllocation.allocations = std::move(eventPoolAllocations);
+        recycledAllocation.eventPoolPtr = eventPoolPtr;
+        recycledAllocation.eventPoolSize = eventPoolSize;
+        recycledAllocation.allocationType = allocationType;
+        recycledAllocation.isDeviceEventPoolAllocation = isDeviceEventPoolAllocation;
+        if (static_cast<DriverHandleImp *>(devices[0]->getDriverHandle())->recycleEventPoolAllocation(recycledAllocation)) {
+            return;
+        }
+        eventPoolAllocations = std::move(recycledAllocation.allocations);
+    }
     if (eventPoolAllocations) {
         auto graphicsAllocations = eventPoolAllocations->getGraphicsAllocations();
         auto memoryManager = devices[0]->getDriverHandle()->getMemoryManager();
@@ -200,6 +230,12 @@ EventPool *EventPool::create(DriverHandle *driver, Context *context, uint32_t nu
     return eventPool.release();
 }
 
+bool EventPool::isEventPoolAllocationRecyclable() const {
+    // allocations shared through IPC may still be used by other processes
+    return NEO::DebugManager.flags.EnableEventPoolRecycling.get() > 0 &&
+           !isImportedIpcPool && !(eventPoolFlags & ZE_EVENT_POOL_FLAG_IPC);
+}
+
 bool EventPool::isEventPoolTimestampFlagSet() const {
     if (NEO::DebugManager.flags.OverrideTimestampEvents.get() != -1) {
         auto timestampOverride = !!NEO::DebugManager.flags.OverrideTimestampEvents.get();
@@ -385,6 +421,61 @@ void Event::resetPackets(bool resetAllPackets) {
     this->csrs.push_back(this->device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
 }
 
+ze_result_t Event::hostResetEvents(uint32_t numEvents, ze_event_handle_t *phEvents) {
+    struct PacketsRange {
+        void *hostAddress;
+        size_t size;
+        size_t tagSize;
+    };
+
+    for (uint32_t i = 0; i < numEvents; i++) {
+        if (phEvents[i] == nullptr) {
+            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    std::vector<PacketsRange> packetsRanges;
+    packetsRanges.reserve(numEvents);
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto event = Event::fromHandle(phEvents[i]);
+        size_t tagSize = 0;
+        if (!event->prepareBatchedHostReset(tagSize)) {
+            auto result = event->reset();
+            if (result != ZE_RESULT_SUCCESS) {
+                return result;
+            }
+            continue;
+        }
+        packetsRanges.push_back({event->getHostAddress(), event->getTotalEventSize(), tagSize});
+    }
+
+    std::sort(packetsRanges.begin(), packetsRanges.end(), [](const PacketsRange &lhs, const PacketsRange &rhs) {
+        return lhs.hostAddress < rhs.hostAddress;
+    });
+
+    // events placed back to back in one pool are cleared with a single fill
+    for (size_t i = 0; i < packetsRanges.size();) {
+        auto hostAddress = packetsRanges[i].hostAddress;
+        auto size = packetsRanges[i].size;
+        auto tagSize = packetsRanges[i].tagSize;
+
+        auto next = i + 1;
+        while (next < packetsRanges.size() && packetsRanges[next].tagSize == tagSize &&
+               packetsRanges[next].hostAddress == ptrOffset(hostAddress, size)) {
+            size += packetsRanges[next].size;
+            next++;
+        }
+
+        if (tagSize == sizeof(uint64_t)) {
+            std::fill_n(static_cast<uint64_t *>(hostAddress), size / sizeof(uint64_t), static_cast<uint64_t>(Event::STATE_INITIAL));
+        } else {
+            std::fill_n(static_cast<uint32_t *>(hostAddress), size / sizeof(uint32_t), static_cast<uint32_t>(Event::STATE_INITIAL));
+        }
+        i = next;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 void Event::setIsCompleted() {
     if (this->isCompleted.load() == STATE_CLEARED) {
         this->isCompleted = STATE_SIGNALED;
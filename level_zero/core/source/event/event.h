@@ -81,6 +81,11 @@ struct Event : _ze_event_handle_t {
 
     static Event *fromHandle(ze_event_handle_t handle) { return static_cast<Event *>(handle); }
 
+    static ze_result_t hostResetEvents(uint32_t numEvents, ze_event_handle_t *phEvents);
+    // Resets host side state of the event, packets are then cleared by the caller together with packets of other events.
+    // Returns false when the event has to be reset with reset() instead.
+    virtual bool prepareBatchedHostReset(size_t &tagSize) { return false; }
+
     inline ze_event_handle_t toHandle() { return this; }
 
     MOCKABLE_VIRTUAL NEO::GraphicsAllocation &getAllocation(Device *device) const;
@@ -92,6 +97,8 @@ struct Event : _ze_event_handle_t {
     MOCKABLE_VIRTUAL void resetPackets(bool resetAllPackets);
     virtual void resetKernelCountAndPacketUsedCount() = 0;
     void *getHostAddress() const { return hostAddress; }
+    EventPool *getEventPool() const { return eventPool; }
+    uint32_t getTotalEventSize() const { return totalEventSize; }
     virtual void setPacketsInUse(uint32_t value) = 0;
     uint32_t getCurrKernelDataIndex() const { return kernelCount - 1; }
     MOCKABLE_VIRTUAL void setGpuStartTimestamp();
@@ -312,6 +319,8 @@ struct EventPool : _ze_event_pool_handle_t {
         return isImplicitScalingCapable;
     }
 
+    bool isEventPoolAllocationRecyclable() const;
+
   protected:
     EventPool() = default;
     EventPool(size_t numEvents) : numEvents(numEvents) {}
@@ -331,6 +340,7 @@ struct EventPool : _ze_event_pool_handle_t {
     uint32_t maxKernelCount = 0;
 
     ze_event_pool_flags_t eventPoolFlags;
+    NEO::AllocationType allocationType = NEO::AllocationType::UNKNOWN;
 
     bool isDeviceEventPoolAllocation = false;
     bool isHostVisibleEventPoolAllocation = false;
@@ -44,6 +44,7 @@ struct EventImp : public Event {
     ze_result_t queryStatus() override;
 
     ze_result_t reset() override;
+    bool prepareBatchedHostReset(size_t &tagSize) override;
 
     ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) override;
     ze_result_t queryTimestampsExp(Device *device, uint32_t *count, ze_kernel_timestamp_result_t *timestamps) override;
@@ -65,6 +66,7 @@ struct EventImp : public Event {
     ze_result_t queryStatusEventPackets();
     ze_result_t queryInOrderEventStatus();
     void handleSuccessfulHostSynchronization();
+    void resetHostState();
     MOCKABLE_VIRTUAL ze_result_t hostEventSetValue(TagSizeT eventValue);
     ze_result_t hostEventSetValueTimestamps(TagSizeT eventVal);
     MOCKABLE_VIRTUAL void assignKernelEventCompletionData(void *address);
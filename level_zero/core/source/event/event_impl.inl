@@ -376,18 +376,44 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
 }
 
 template <typename TagSizeT>
-ze_result_t EventImp<TagSizeT>::reset() {
+void EventImp<TagSizeT>::resetHostState() {
     if (inOrderExecEvent) {
         inOrderExecDataAllocation = nullptr;
         inOrderExecSignalValue = 0;
         inOrderExecEvent = false;
     }
     this->resetCompletionStatus();
-    this->resetDeviceCompletionData(false);
     this->l3FlushAppliedOnKernel.reset();
+}
+
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::reset() {
+    this->resetHostState();
+    this->resetDeviceCompletionData(false);
     return ZE_RESULT_SUCCESS;
 }
 
+template <typename TagSizeT>
+bool EventImp<TagSizeT>::prepareBatchedHostReset(size_t &tagSize) {
+    if (this->downloadAllocationRequired) {
+        return false;
+    }
+    this->resetHostState();
+
+    if (isEventTimestampFlagSet()) {
+        const auto dataSize = 4u * EventPacketsCount::maxKernelSplit * NEO::TimestampPacketSizeControl::preferredPacketCount;
+        TagSizeT tagValues[dataSize];
+        for (uint32_t index = 0u; index < dataSize; index++) {
+            tagValues[index] = Event::STATE_INITIAL;
+        }
+        assignKernelEventCompletionData(tagValues);
+    }
+    this->resetPackets(false);
+
+    tagSize = sizeof(TagSizeT);
+    return true;
+}
+
 template <typename TagSizeT>
 void EventImp<TagSizeT>::resetDeviceCompletionData(bool resetAllPackets) {
 
@@ -18,6 +18,8 @@ std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
     addToMap(lookupMap, zexDriverReleaseImportedPointer);
     addToMap(lookupMap, zexDriverGetHostPointerBaseAddress);
 
+    addToMap(lookupMap, zexEventHostResetBatch);
+
     addToMap(lookupMap, zexKernelGetBaseAddress);
 
     addToMap(lookupMap, zexMemGetIpcHandles);
@@ -25,7 +27,12 @@ std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
 
     addToMap(lookupMap, zexCommandListAppendWaitOnMemory);
     addToMap(lookupMap, zexCommandListAppendWriteToMemory);
+    addToMap(lookupMap, zexCommandListBeginCapture);
+    addToMap(lookupMap, zexCommandListEndCapture);
+    addToMap(lookupMap, zexCommandListReplayCapture);
+    addToMap(lookupMap, zexCommandListPatchCapturedKernelArgument);
     addToMap(lookupMap, zexSysmanMemoryGetBandwidth);
+    addToMap(lookupMap, zexSysmanDeviceGetEngineActivity);
 #undef addToMap
 
     return lookupMap;
@@ -48,7 +48,15 @@ struct KernelImmutableData {
     }
 
     uint32_t getIsaSize() const;
-    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const { return isaGraphicsAllocation.get(); }
+    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const {
+        return isaParentAllocation ? isaParentAllocation : isaGraphicsAllocation.get();
+    }
+    NEO::GraphicsAllocation *getIsaParentAllocation() const { return isaParentAllocation; }
+    uint64_t getIsaOffsetInParentAllocation() const { return isaOffsetInParentAllocation; }
+    void setIsaParentAllocation(NEO::GraphicsAllocation *allocation, uint64_t offset) {
+        isaParentAllocation = allocation;
+        isaOffsetInParentAllocation = offset;
+    }
 
     const uint8_t *getCrossThreadDataTemplate() const { return crossThreadDataTemplate.get(); }
 
@@ -80,6 +88,8 @@ struct KernelImmutableData {
     NEO::KernelInfo *kernelInfo = nullptr;
     NEO::KernelDescriptor *kernelDescriptor = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> isaGraphicsAllocation = nullptr;
+    NEO::GraphicsAllocation *isaParentAllocation = nullptr;
+    uint64_t isaOffsetInParentAllocation = 0u;
 
     uint32_t crossThreadDataSize = 0;
     std::unique_ptr<uint8_t[]> crossThreadDataTemplate = nullptr;
@@ -81,13 +81,15 @@ ze_result_t KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device
     UNRECOVERABLE_IF(!kernelInfo->heapInfo.pKernelHeap);
     const auto allocType = internalKernel ? NEO::AllocationType::KERNEL_ISA_INTERNAL : NEO::AllocationType::KERNEL_ISA;
 
-    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
-        {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
-    if (!allocation) {
-        return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
-    }
+    if (nullptr == isaParentAllocation) {
+        auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
+            {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
+        if (!allocation) {
+            return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        }
 
-    isaGraphicsAllocation.reset(allocation);
+        isaGraphicsAllocation.reset(allocation);
+    }
 
     if (neoDevice->getDebugger() && kernelInfo->kernelDescriptor.external.debugData.get()) {
         createRelocatedDebugData(globalConstBuffer, globalVarBuffer);
@@ -185,8 +187,8 @@ void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *glob
 
             memcpy_s(kernelInfo->kernelDescriptor.external.relocatedDebugData.get(), size, kernelInfo->kernelDescriptor.external.debugData->vIsa, kernelInfo->kernelDescriptor.external.debugData->vIsaSize);
 
-            NEO::Linker::SegmentInfo textSegment = {getIsaGraphicsAllocation()->getGpuAddress(),
-                                                    getIsaGraphicsAllocation()->getUnderlyingBufferSize()};
+            NEO::Linker::SegmentInfo textSegment = {getIsaGraphicsAllocation()->getGpuAddress() + getIsaOffsetInParentAllocation(),
+                                                    getIsaSize()};
 
             NEO::Linker::applyDebugDataRelocations(decodedElf, ArrayRef<uint8_t>(kernelInfo->kernelDescriptor.external.relocatedDebugData.get(), size),
                                                    textSegment, globalData, constData);
@@ -197,12 +199,15 @@ void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *glob
 ze_result_t KernelImp::getBaseAddress(uint64_t *baseAddress) {
     if (baseAddress) {
         auto gmmHelper = module->getDevice()->getNEODevice()->getGmmHelper();
-        *baseAddress = gmmHelper->decanonize(this->kernelImmData->getIsaGraphicsAllocation()->getGpuAddress());
+        *baseAddress = gmmHelper->decanonize(this->kernelImmData->getIsaGraphicsAllocation()->getGpuAddress() + this->kernelImmData->getIsaOffsetInParentAllocation());
     }
     return ZE_RESULT_SUCCESS;
 }
 
 uint32_t KernelImmutableData::getIsaSize() const {
+    if (isaParentAllocation) {
+        return static_cast<uint32_t>(kernelInfo->heapInfo.kernelHeapSize);
+    }
     return static_cast<uint32_t>(isaGraphicsAllocation->getUnderlyingBufferSize());
 }
 
@@ -1111,6 +1116,10 @@ NEO::GraphicsAllocation *KernelImp::getIsaAllocation() const {
     return getImmutableData()->getIsaGraphicsAllocation();
 }
 
+uint64_t KernelImp::getIsaOffsetInParentAllocation() const {
+    return getImmutableData()->getIsaOffsetInParentAllocation();
+}
+
 ze_result_t KernelImp::setSchedulingHintExp(ze_scheduling_hint_exp_desc_t *pHint) {
     auto &threadArbitrationPolicy = const_cast<NEO::ThreadArbitrationPolicy &>(getKernelDescriptor().kernelAttributes.threadArbitrationPolicy);
     if (pHint->flags == ZE_SCHEDULING_HINT_EXP_FLAG_OLDEST_FIRST) {
@@ -132,6 +132,7 @@ struct KernelImp : Kernel {
     }
 
     NEO::GraphicsAllocation *getIsaAllocation() const override;
+    uint64_t getIsaOffsetInParentAllocation() const override;
 
     uint32_t getRequiredWorkgroupOrder() const override { return requiredWorkgroupOrder; }
     bool requiresGenerationOfLocalIdsByRuntime() const override { return kernelRequiresGenerationOfLocalIdsByRuntime; }
@@ -171,6 +172,8 @@ struct KernelImp : Kernel {
 
     NEO::ImplicitArgs *getImplicitArgs() const override { return pImplicitArgs.get(); }
 
+    NEO::InterfaceDescriptorTemplate *getInterfaceDescriptorTemplate() const override { return &interfaceDescriptorTemplate; }
+
     KernelExt *getExtension(uint32_t extensionType);
 
     void getExtendedKernelProperties(ze_base_desc_t *pExtendedProperties);
@@ -236,6 +239,8 @@ struct KernelImp : Kernel {
 
     std::unique_ptr<KernelExt> pExtension;
     std::mutex printfLock;
+
+    mutable NEO::InterfaceDescriptorTemplate interfaceDescriptorTemplate;
 };
 
 } // namespace L0
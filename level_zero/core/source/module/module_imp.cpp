@@ -483,15 +483,24 @@ ModuleImp::ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType
 
 ModuleImp::~ModuleImp() {
     kernelImmDatas.clear();
+    for (auto &packedIsa : packedIsaAllocations) {
+        device->getNEODevice()->getMemoryManager()->freeGraphicsMemory(packedIsa.allocation);
+    }
 }
 
 NEO::Zebin::Debug::Segments ModuleImp::getZebinSegments() {
     std::vector<std::pair<std::string_view, NEO::GraphicsAllocation *>> kernels;
-    for (const auto &kernelImmData : kernelImmDatas)
-        kernels.push_back({kernelImmData->getDescriptor().kernelMetadata.kernelName, kernelImmData->getIsaGraphicsAllocation()});
     ArrayRef<const uint8_t> strings = {reinterpret_cast<const uint8_t *>(translationUnit->programInfo.globalStrings.initData),
                                        translationUnit->programInfo.globalStrings.size};
-    return NEO::Zebin::Debug::Segments(translationUnit->globalVarBuffer, translationUnit->globalConstBuffer, strings, kernels);
+    auto segments = NEO::Zebin::Debug::Segments(translationUnit->globalVarBuffer, translationUnit->globalConstBuffer, strings, kernels);
+
+    // with packed ISA kernels share an allocation, so each segment covers only its kernel's range
+    for (const auto &kernelImmData : kernelImmDatas) {
+        NEO::Zebin::Debug::Segments::Segment kernelSegment = {static_cast<uintptr_t>(kernelImmData->getIsaGraphicsAllocation()->getGpuAddress() + kernelImmData->getIsaOffsetInParentAllocation()),
+                                                              kernelImmData->getIsaSize()};
+        segments.nameToSegMap.insert({kernelImmData->getDescriptor().kernelMetadata.kernelName, kernelSegment});
+    }
+    return segments;
 }
 
 ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice) {
@@ -610,9 +619,19 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
         return result;
     }
 
+    std::vector<std::pair<NEO::GraphicsAllocation *, uint64_t>> packedIsaLocations;
+    result = allocatePackedIsa(packedIsaLocations);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+
     kernelImmDatas.reserve(this->translationUnit->programInfo.kernelInfos.size());
     for (auto &ki : this->translationUnit->programInfo.kernelInfos) {
         std::unique_ptr<KernelImmutableData> kernelImmData{new KernelImmutableData(this->device)};
+        if (!packedIsaLocations.empty()) {
+            auto &isaLocation = packedIsaLocations[kernelImmDatas.size()];
+            kernelImmData->setIsaParentAllocation(isaLocation.first, isaLocation.second);
+        }
         result = kernelImmData->initialize(ki, device, device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
                                            this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer,
                                            this->type == ModuleType::Builtin);
@@ -649,6 +668,7 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
     const auto &productHelper = neoDevice->getProductHelper();
 
     if (this->isFullyLinked && this->type == ModuleType::User) {
+        copyIsaToPackedAllocations(nullptr);
         for (auto &ki : kernelImmDatas) {
 
             if (!ki->isIsaCopiedToAllocation()) {
@@ -862,11 +882,13 @@ ze_result_t ModuleImp::getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData)
 
 void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching) {
     if (this->translationUnit->programInfo.linkerInput && this->translationUnit->programInfo.linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
+        copyIsaToPackedAllocations(&isaSegmentsForPatching);
+
         auto &rootDeviceEnvironment = device->getNEODevice()->getRootDeviceEnvironment();
         const auto &productHelper = this->device->getProductHelper();
 
         for (auto &kernelImmData : this->kernelImmDatas) {
-            if (nullptr == kernelImmData->getIsaGraphicsAllocation()) {
+            if (nullptr == kernelImmData->getIsaGraphicsAllocation() || nullptr != kernelImmData->getIsaParentAllocation()) {
                 continue;
             }
 
@@ -893,6 +915,78 @@ void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSeg
     }
 }
 
+ze_result_t ModuleImp::allocatePackedIsa(std::vector<std::pair<NEO::GraphicsAllocation *, uint64_t>> &kernelIsaLocations) {
+    const auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    auto neoDevice = device->getNEODevice();
+    if (NEO::DebugManager.flags.EnableModuleIsaPacking.get() <= 0 || this->type != ModuleType::User ||
+        kernelInfos.size() < 2 || neoDevice->getDebugger()) {
+        return ZE_RESULT_SUCCESS;
+    }
+    const auto maxPackedIsaSize = static_cast<size_t>(NEO::DebugManager.flags.EnableModuleIsaPacking.get()) * MemoryConstants::kiloByte;
+
+    std::vector<uint64_t> isaOffsets;
+    isaOffsets.reserve(kernelInfos.size());
+    PackedIsaAllocation packedIsa;
+    for (size_t kernelId = 0; kernelId < kernelInfos.size(); kernelId++) {
+        auto kernelIsaSize = kernelInfos[kernelId]->heapInfo.kernelHeapSize;
+        auto isaOffset = alignUp(packedIsa.size, packedIsaAlignment);
+        if (packedIsa.kernelsCount > 0 && isaOffset + kernelIsaSize > maxPackedIsaSize) {
+            packedIsaAllocations.push_back(packedIsa);
+            packedIsa = {};
+            packedIsa.firstKernelId = kernelId;
+            isaOffset = 0u;
+        }
+        isaOffsets.push_back(isaOffset);
+        packedIsa.size = isaOffset + kernelIsaSize;
+        packedIsa.kernelsCount++;
+    }
+    packedIsaAllocations.push_back(packedIsa);
+
+    kernelIsaLocations.resize(kernelInfos.size());
+    for (auto &packed : packedIsaAllocations) {
+        packed.allocation = neoDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(
+            {neoDevice->getRootDeviceIndex(), packed.size, NEO::AllocationType::KERNEL_ISA, neoDevice->getDeviceBitfield()});
+        if (nullptr == packed.allocation) {
+            return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        }
+        for (auto kernelId = packed.firstKernelId; kernelId < packed.firstKernelId + packed.kernelsCount; kernelId++) {
+            kernelIsaLocations[kernelId] = {packed.allocation, isaOffsets[kernelId]};
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+void ModuleImp::copyIsaToPackedAllocations(const NEO::Linker::PatchableSegments *isaSegmentsForPatching) {
+    auto &rootDeviceEnvironment = device->getNEODevice()->getRootDeviceEnvironment();
+    const auto &productHelper = this->device->getProductHelper();
+
+    std::vector<uint8_t> packedIsaData;
+    for (auto &packedIsa : packedIsaAllocations) {
+        if (kernelImmDatas[packedIsa.firstKernelId]->isIsaCopiedToAllocation()) {
+            continue;
+        }
+
+        packedIsaData.assign(packedIsa.size, 0u);
+        for (auto kernelId = packedIsa.firstKernelId; kernelId < packedIsa.firstKernelId + packedIsa.kernelsCount; kernelId++) {
+            auto &kernelImmData = kernelImmDatas[kernelId];
+            const void *isa = kernelImmData->getKernelInfo()->heapInfo.pKernelHeap;
+            size_t isaSize = kernelImmData->getKernelInfo()->heapInfo.kernelHeapSize;
+            if (isaSegmentsForPatching) {
+                isa = (*isaSegmentsForPatching)[kernelId].hostPointer;
+                isaSize = (*isaSegmentsForPatching)[kernelId].segmentSize;
+            }
+            auto isaOffset = static_cast<size_t>(kernelImmData->getIsaOffsetInParentAllocation());
+            memcpy_s(packedIsaData.data() + isaOffset, packedIsaData.size() - isaOffset, isa, isaSize);
+            kernelImmData->setIsaCopiedToAllocation();
+        }
+
+        packedIsa.allocation->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+        packedIsa.allocation->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+        NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *packedIsa.allocation),
+                                                              *device->getNEODevice(), packedIsa.allocation, 0, packedIsaData.data(), packedIsaData.size());
+    }
+}
+
 bool ModuleImp::linkBinary() {
     using namespace NEO;
     auto linkerInput = this->translationUnit->programInfo.linkerInput.get();
@@ -922,8 +1016,8 @@ bool ModuleImp::linkBinary() {
     if (linkerInput->getExportedFunctionsSegmentId() >= 0) {
         auto exportedFunctionHeapId = linkerInput->getExportedFunctionsSegmentId();
         this->exportedFunctionsSurface = this->kernelImmDatas[exportedFunctionHeapId]->getIsaGraphicsAllocation();
-        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch());
-        exportedFunctions.segmentSize = exportedFunctionsSurface->getUnderlyingBufferSize();
+        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch() + this->kernelImmDatas[exportedFunctionHeapId]->getIsaOffsetInParentAllocation());
+        exportedFunctions.segmentSize = this->kernelImmDatas[exportedFunctionHeapId]->getIsaSize();
     }
 
     Linker::KernelDescriptorsT kernelDescriptors;
@@ -935,7 +1029,7 @@ bool ModuleImp::linkBinary() {
             auto &kernHeapInfo = kernelInfo->heapInfo;
             const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
             patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.kernelHeapSize));
-            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch()), kernHeapInfo.kernelHeapSize});
+            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch() + kernelImmDatas.at(i)->getIsaOffsetInParentAllocation()), kernHeapInfo.kernelHeapSize});
             kernelDescriptors.push_back(&kernelInfo->kernelDescriptor);
         }
     }
@@ -997,7 +1091,7 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
         auto kernelImmData = this->getKernelImmutableData(pFunctionName);
         if (kernelImmData != nullptr) {
             auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
-            *pfnFunction = reinterpret_cast<void *>(isaAllocation->getGpuAddress());
+            *pfnFunction = reinterpret_cast<void *>(isaAllocation->getGpuAddress() + kernelImmData->getIsaOffsetInParentAllocation());
             // Ensure that any kernel in this module which uses this kernel module function pointer has access to the memory.
             for (auto &data : this->getKernelImmutableDataVector()) {
                 if (data.get() != kernelImmData) {
@@ -1178,7 +1272,7 @@ ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                     auto &kernHeapInfo = kernelInfo->heapInfo;
                     const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
                     patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.kernelHeapSize));
-                    isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch()), kernHeapInfo.kernelHeapSize});
+                    isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch() + kernelImmDatas.at(i)->getIsaOffsetInParentAllocation()), kernHeapInfo.kernelHeapSize});
                 }
             }
             for (const auto &unresolvedExternal : moduleId->unresolvedExternalsInfo) {
@@ -9,6 +9,7 @@
 
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/linker.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/program/program_info.h"
 
 #include "level_zero/core/source/module/module.h"
@@ -150,6 +151,8 @@ struct ModuleImp : public Module {
 
   protected:
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
+    ze_result_t allocatePackedIsa(std::vector<std::pair<NEO::GraphicsAllocation *, uint64_t>> &kernelIsaLocations);
+    void copyIsaToPackedAllocations(const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     void verifyDebugCapabilities();
     void checkIfPrivateMemoryPerDispatchIsNeeded() override;
     NEO::Zebin::Debug::Segments getZebinSegments();
@@ -193,6 +196,16 @@ struct ModuleImp : public Module {
 
     NEO::Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
+
+    // ISA of consecutive kernels packed into one allocation, see EnableModuleIsaPacking
+    struct PackedIsaAllocation {
+        NEO::GraphicsAllocation *allocation = nullptr;
+        size_t size = 0u;
+        size_t firstKernelId = 0u;
+        size_t kernelsCount = 0u;
+    };
+    static constexpr size_t packedIsaAlignment = MemoryConstants::cacheLineSize;
+    std::vector<PackedIsaAllocation> packedIsaAllocations;
 };
 
 bool moveBuildOption(std::string &dstOptionsSet, std::string &srcOptionSet, NEO::ConstStringRef dstOptionName, NEO::ConstStringRef srcOptionName);
@@ -72,7 +72,8 @@ void PrintfHandler::printOutput(const KernelImmutableData *kernelData,
         printfOutputBuffer,
         printfOutputSize,
         using32BitGpuPointers,
-        usesStringMap ? &kernelData->getDescriptor().kernelMetadata.printfStringsMap : nullptr};
+        usesStringMap ? &kernelData->getDescriptor().kernelMetadata.printfStringsMap : nullptr,
+        &kernelData->getKernelInfo()->printfFormatPlans};
     printfFormatter.printKernelOutput();
 
     *reinterpret_cast<uint32_t *>(printfBuffer->getUnderlyingBuffer()) =
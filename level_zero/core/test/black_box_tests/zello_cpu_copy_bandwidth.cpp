@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "zello_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+// Large copies take the CPU path only with raised thresholds, e.g.
+// ExperimentalH2DCpuCopyThreshold=268435456 ExperimentalD2HCpuCopyThreshold=268435456
+double measureCopyBandwidth(ze_command_list_handle_t cmdList, void *dst, const void *src, size_t size, uint32_t iterations) {
+    double minNs = std::numeric_limits<double>::max();
+    for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+        auto start = std::chrono::steady_clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(cmdList, dst, src, size, nullptr, 0, nullptr));
+        auto end = std::chrono::steady_clock::now();
+        minNs = std::min(minNs, static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+    }
+    return static_cast<double>(size) / minNs;
+}
+
+void measureCpuCopyBandwidth(ze_context_handle_t &context, ze_device_handle_t &device, size_t maxSize, uint32_t iterations, bool &outputValidationSuccessful) {
+    ze_command_queue_desc_t cmdQueueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    cmdQueueDesc.ordinal = getCommandQueueOrdinal(device);
+    cmdQueueDesc.index = 0;
+    cmdQueueDesc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+    ze_command_list_handle_t cmdList;
+    SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(context, device, &cmdQueueDesc, &cmdList));
+
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    void *deviceBuffer = nullptr;
+    SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, maxSize, 1, device, &deviceBuffer));
+
+    auto hostSrc = new uint8_t[maxSize];
+    auto hostDst = new uint8_t[maxSize];
+    for (size_t i = 0; i < maxSize; i++) {
+        hostSrc[i] = static_cast<uint8_t>(i * 7 + 1);
+    }
+    memset(hostDst, 0, maxSize);
+
+    std::cout << std::setw(12) << "size [B]" << std::setw(14) << "H2D [GB/s]" << std::setw(14) << "D2H [GB/s]" << std::endl;
+    for (size_t size = 4096u; size <= maxSize; size *= 4) {
+        auto h2d = measureCopyBandwidth(cmdList, deviceBuffer, hostSrc, size, iterations);
+        auto d2h = measureCopyBandwidth(cmdList, hostDst, deviceBuffer, size, iterations);
+        std::cout << std::setw(12) << size << std::setw(14) << std::fixed << std::setprecision(2) << h2d << std::setw(14) << d2h << std::endl;
+    }
+
+    SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(cmdList, deviceBuffer, hostSrc, maxSize, nullptr, 0, nullptr));
+    SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(cmdList, hostDst, deviceBuffer, maxSize, nullptr, 0, nullptr));
+    outputValidationSuccessful = (0 == memcmp(hostDst, hostSrc, maxSize));
+
+    delete[] hostSrc;
+    delete[] hostDst;
+    SUCCESS_OR_TERMINATE(zeMemFree(context, deviceBuffer));
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello CPU Copy Bandwidth";
+    verbose = isVerbose(argc, argv);
+    bool aubMode = isAubMode(argc, argv);
+    uint32_t iterations = static_cast<uint32_t>(std::max(getParamValue(argc, argv, "-i", "--iterations", 10), 1));
+    size_t maxSize = static_cast<size_t>(std::max(getParamValue(argc, argv, "-s", "--max-size", 64 * 1024 * 1024), 4096));
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    printDeviceProperties(deviceProperties);
+
+    bool outputValidationSuccessful = false;
+    measureCpuCopyBandwidth(context, device, maxSize, iterations, outputValidationSuccessful);
+
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    printResult(aubMode, outputValidationSuccessful, blackBoxName);
+    outputValidationSuccessful = aubMode ? true : outputValidationSuccessful;
+    return outputValidationSuccessful ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "zello_common.h"
+#include "zello_compile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+void measureAppendLaunchKernelLatency(ze_context_handle_t &context, ze_device_handle_t &device, uint32_t iterations, uint32_t launchesPerIteration, bool &outputValidationSuccessful) {
+    ze_command_queue_handle_t cmdQueue = createCommandQueue(context, device, nullptr);
+    ze_command_list_handle_t cmdList;
+    SUCCESS_OR_TERMINATE(createCommandList(context, device, cmdList));
+
+    constexpr size_t allocSize = 4096;
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+
+    void *srcBuffer = nullptr;
+    SUCCESS_OR_TERMINATE(zeMemAllocShared(context, &deviceDesc, &hostDesc, allocSize, 1, device, &srcBuffer));
+    void *dstBuffer = nullptr;
+    SUCCESS_OR_TERMINATE(zeMemAllocShared(context, &deviceDesc, &hostDesc, allocSize, 1, device, &dstBuffer));
+
+    constexpr uint8_t val = 55;
+    memset(srcBuffer, val, allocSize);
+    memset(dstBuffer, 0, allocSize);
+
+    std::string buildLog;
+    auto spirV = compileToSpirV(memcpyBytesTestKernelSrc, "", buildLog);
+    if (buildLog.size() > 0) {
+        std::cout << "Build log " << buildLog;
+    }
+    SUCCESS_OR_TERMINATE((0 == spirV.size()));
+
+    ze_module_handle_t module = nullptr;
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = spirV.data();
+    moduleDesc.inputSize = spirV.size();
+    SUCCESS_OR_TERMINATE(zeModuleCreate(context, device, &moduleDesc, &module, nullptr));
+
+    ze_kernel_handle_t kernel = nullptr;
+    ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    kernelDesc.pKernelName = "memcpy_bytes";
+    SUCCESS_OR_TERMINATE(zeKernelCreate(module, &kernelDesc, &kernel));
+
+    uint32_t groupSizeX = 32u;
+    uint32_t groupSizeY = 1u;
+    uint32_t groupSizeZ = 1u;
+    SUCCESS_OR_TERMINATE(zeKernelSuggestGroupSize(kernel, allocSize, 1U, 1U, &groupSizeX, &groupSizeY, &groupSizeZ));
+    SUCCESS_OR_TERMINATE(zeKernelSetGroupSize(kernel, groupSizeX, groupSizeY, groupSizeZ));
+    SUCCESS_OR_TERMINATE(zeKernelSetArgumentValue(kernel, 0, sizeof(dstBuffer), &dstBuffer));
+    SUCCESS_OR_TERMINATE(zeKernelSetArgumentValue(kernel, 1, sizeof(srcBuffer), &srcBuffer));
+
+    ze_group_count_t dispatchTraits;
+    dispatchTraits.groupCountX = allocSize / groupSizeX;
+    dispatchTraits.groupCountY = 1u;
+    dispatchTraits.groupCountZ = 1u;
+
+    double minNsPerLaunch = std::numeric_limits<double>::max();
+    double totalNsPerLaunch = 0.0;
+    for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+        SUCCESS_OR_TERMINATE(zeCommandListReset(cmdList));
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t launch = 0; launch < launchesPerIteration; launch++) {
+            SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, kernel, &dispatchTraits, nullptr, 0, nullptr));
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        auto nsPerLaunch = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / launchesPerIteration;
+        minNsPerLaunch = std::min(minNsPerLaunch, nsPerLaunch);
+        totalNsPerLaunch += nsPerLaunch;
+
+        SUCCESS_OR_TERMINATE(zeCommandListClose(cmdList));
+        SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(cmdQueue, 1, &cmdList, nullptr));
+        SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(cmdQueue, std::numeric_limits<uint64_t>::max()));
+    }
+
+    std::cout << "zeCommandListAppendLaunchKernel: " << launchesPerIteration << " launches x " << iterations << " iterations" << std::endl;
+    std::cout << "  min ns per launch: " << minNsPerLaunch << std::endl;
+    std::cout << "  avg ns per launch: " << totalNsPerLaunch / iterations << std::endl;
+
+    outputValidationSuccessful = (0 == memcmp(dstBuffer, srcBuffer, allocSize));
+
+    SUCCESS_OR_TERMINATE(zeKernelDestroy(kernel));
+    SUCCESS_OR_TERMINATE(zeModuleDestroy(module));
+    SUCCESS_OR_TERMINATE(zeMemFree(context, dstBuffer));
+    SUCCESS_OR_TERMINATE(zeMemFree(context, srcBuffer));
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    SUCCESS_OR_TERMINATE(zeCommandQueueDestroy(cmdQueue));
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello Dispatch Latency";
+    verbose = isVerbose(argc, argv);
+    bool aubMode = isAubMode(argc, argv);
+    uint32_t iterations = static_cast<uint32_t>(std::max(getParamValue(argc, argv, "-i", "--iterations", 10), 1));
+    uint32_t launchesPerIteration = static_cast<uint32_t>(std::max(getParamValue(argc, argv, "-l", "--launches", 1000), 1));
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    printDeviceProperties(deviceProperties);
+
+    bool outputValidationSuccessful = false;
+    measureAppendLaunchKernelLatency(context, device, iterations, launchesPerIteration, outputValidationSuccessful);
+
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    printResult(aubMode, outputValidationSuccessful, blackBoxName);
+    outputValidationSuccessful = aubMode ? true : outputValidationSuccessful;
+    return outputValidationSuccessful ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "zello_common.h"
+#include "zello_compile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+std::string generateModuleSource(uint32_t kernelsCount) {
+    std::ostringstream source;
+    for (uint32_t kernelId = 0; kernelId < kernelsCount; kernelId++) {
+        source << "__kernel void kernel_" << kernelId << "(__global int *dst, __global const int *src) {\n"
+               << "    size_t gid = get_global_id(0);\n"
+               << "    dst[gid] = src[gid] * " << kernelId + 1 << " + " << kernelId << ";\n"
+               << "}\n";
+    }
+    return source.str();
+}
+
+void measureModuleLoad(ze_context_handle_t &context, ze_device_handle_t &device, uint32_t kernelsCount, uint32_t iterations, bool &outputValidationSuccessful) {
+    std::string buildLog;
+    auto spirV = compileToSpirV(generateModuleSource(kernelsCount), "", buildLog);
+    if (buildLog.size() > 0) {
+        std::cout << "Build log " << buildLog;
+    }
+    SUCCESS_OR_TERMINATE((0 == spirV.size()));
+
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = spirV.data();
+    moduleDesc.inputSize = spirV.size();
+
+    // first load builds the native binary, which is then reused to measure module load only
+    ze_module_handle_t module = nullptr;
+    SUCCESS_OR_TERMINATE(zeModuleCreate(context, device, &moduleDesc, &module, nullptr));
+    size_t nativeBinarySize = 0;
+    SUCCESS_OR_TERMINATE(zeModuleGetNativeBinary(module, &nativeBinarySize, nullptr));
+    std::vector<uint8_t> nativeBinary(nativeBinarySize);
+    SUCCESS_OR_TERMINATE(zeModuleGetNativeBinary(module, &nativeBinarySize, nativeBinary.data()));
+    SUCCESS_OR_TERMINATE(zeModuleDestroy(module));
+
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    moduleDesc.pInputModule = nativeBinary.data();
+    moduleDesc.inputSize = nativeBinary.size();
+
+    double minCreateUs = std::numeric_limits<double>::max();
+    double minDestroyUs = std::numeric_limits<double>::max();
+    for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+        auto start = std::chrono::steady_clock::now();
+        SUCCESS_OR_TERMINATE(zeModuleCreate(context, device, &moduleDesc, &module, nullptr));
+        auto created = std::chrono::steady_clock::now();
+
+        uint32_t kernelNamesCount = 0;
+        SUCCESS_OR_TERMINATE(zeModuleGetKernelNames(module, &kernelNamesCount, nullptr));
+        outputValidationSuccessful &= (kernelNamesCount == kernelsCount);
+
+        auto destroyStart = std::chrono::steady_clock::now();
+        SUCCESS_OR_TERMINATE(zeModuleDestroy(module));
+        auto end = std::chrono::steady_clock::now();
+
+        minCreateUs = std::min(minCreateUs, std::chrono::duration<double, std::micro>(created - start).count());
+        minDestroyUs = std::min(minDestroyUs, std::chrono::duration<double, std::micro>(end - destroyStart).count());
+    }
+
+    std::cout << "zeModuleCreate with " << kernelsCount << " kernels: " << minCreateUs << " us ("
+              << minCreateUs / kernelsCount << " us per kernel), zeModuleDestroy: " << minDestroyUs << " us" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello Module Load";
+    verbose = isVerbose(argc, argv);
+    bool aubMode = isAubMode(argc, argv);
+    uint32_t iterations = static_cast<uint32_t>(std::max(getParamValue(argc, argv, "-i", "--iterations", 5), 1));
+    uint32_t maxKernelsCount = static_cast<uint32_t>(std::max(getParamValue(argc, argv, "-k", "--kernels", 1024), 1));
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    printDeviceProperties(deviceProperties);
+
+    bool outputValidationSuccessful = true;
+    for (uint32_t kernelsCount = 1; kernelsCount <= maxKernelsCount; kernelsCount *= 4) {
+        measureModuleLoad(context, device, kernelsCount, iterations, outputValidationSuccessful);
+    }
+
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    printResult(aubMode, outputValidationSuccessful, blackBoxName);
+    outputValidationSuccessful = aubMode ? true : outputValidationSuccessful;
+    return outputValidationSuccessful ? 0 : 1;
+}
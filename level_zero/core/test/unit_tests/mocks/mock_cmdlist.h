@@ -63,6 +63,7 @@ struct WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>
     using BaseClass::doubleSbaWa;
     using BaseClass::engineGroupType;
     using BaseClass::estimateBufferSizeMultiTileBarrier;
+    using BaseClass::eventResetRange;
     using BaseClass::finalStreamState;
     using BaseClass::flags;
     using BaseClass::frontEndStateTracking;
@@ -145,6 +146,7 @@ struct WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>
     : public L0::CommandListCoreFamilyImmediate<gfxCoreFamily> {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     using BaseClass = L0::CommandListCoreFamilyImmediate<gfxCoreFamily>;
+    using BaseClass::capturedLaunches;
     using BaseClass::clearCommandsToPatch;
     using BaseClass::cmdListHeapAddressModel;
     using BaseClass::cmdListType;
@@ -211,6 +213,7 @@ struct WhiteBox<::L0::CommandList> : public ::L0::CommandListImp {
     using BaseClass::commandContainer;
     using BaseClass::commandListPreemptionMode;
     using BaseClass::commandsToPatch;
+    using BaseClass::copyThresholdCalibrator;
     using BaseClass::copyThroughLockedPtrEnabled;
     using BaseClass::csr;
     using BaseClass::currentBindingTablePoolBaseAddress;
@@ -567,6 +570,7 @@ class MockCommandListImmediateHw : public WhiteBox<::L0::CommandListCoreFamilyIm
     MockCommandListImmediateHw() : BaseClass() {}
     using BaseClass::applyMemoryRangesBarrier;
     using BaseClass::cmdListType;
+    using BaseClass::copyThresholdCalibrator;
     using BaseClass::copyThroughLockedPtrEnabled;
     using BaseClass::dcFlushSupport;
     using BaseClass::dependenciesPresent;
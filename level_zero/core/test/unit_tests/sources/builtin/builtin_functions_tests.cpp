@@ -8,13 +8,16 @@
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/default_hw_info.h"
 #include "shared/test/common/helpers/memory_management.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
 #include "shared/test/common/mocks/mock_compiler_interface_spirv.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/core/source/builtin/builtin_binary_cache.h"
 #include "level_zero/core/source/builtin/builtin_functions_lib_impl.h"
 #include "level_zero/core/source/device/device_imp.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_device_for_spirv.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
@@ -273,5 +276,98 @@ HWTEST_F(TestBuiltinFunctionsLibImpl, GivenBuiltinsWhenInitializingFunctionsThen
     EXPECT_EQ(ModuleType::Builtin, testDevice.typeCreated);
 }
 
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenPreloadAllBuiltinsAsyncWhenCreateBuiltinFunctionsLibThenAllBuiltinsAreLoaded) {
+    struct MockBuiltinFunctionsLibImpl : public BuiltinFunctionsLibImpl {
+        using BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl;
+        using BuiltinFunctionsLibImpl::builtins;
+        using BuiltinFunctionsLibImpl::imageBuiltins;
+        using BuiltinFunctionsLibImpl::initAsyncComplete;
+    };
+
+    DebugManagerStateRestore dgbRestorer;
+    NEO::DebugManager.flags.PreloadAllBuiltinsAsync.set(1);
+    MockBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+    EXPECT_FALSE(lib.initAsyncComplete);
+    lib.ensureInitCompletion();
+    EXPECT_TRUE(lib.initAsyncComplete);
+
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
+        EXPECT_NE(nullptr, lib.builtins[builtId]);
+    }
+    bool imageSupport = device->getNEODevice()->getDeviceInfo().imageSupport;
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(ImageBuiltin::COUNT); builtId++) {
+        EXPECT_EQ(imageSupport, nullptr != lib.imageBuiltins[builtId]);
+    }
+
+    MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenShareBuiltinBinariesAcrossDevicesWhenSecondLibLoadsBuiltinThenNativeBinaryFromDriverCacheIsUsed) {
+    struct MockDeviceWithBuilins : public Mock<DeviceImp> {
+        MockDeviceWithBuilins(L0::Device *device) : Mock(device->getNEODevice(), static_cast<NEO::ExecutionEnvironment *>(device->getExecEnvironment())) {
+            driverHandle = device->getDriverHandle();
+            builtins = BuiltinFunctionsLib::create(this, neoDevice->getBuiltIns());
+        }
+
+        ze_result_t createModule(const ze_module_desc_t *desc,
+                                 ze_module_handle_t *module,
+                                 ze_module_build_log_handle_t *buildLog, ModuleType type) override {
+            lastFormat = desc->format;
+            createModuleCalled++;
+            return DeviceImp::createModule(desc, module, buildLog, type);
+        }
+
+        ze_module_format_t lastFormat = ZE_MODULE_FORMAT_FORCE_UINT32;
+        uint32_t createModuleCalled = 0u;
+    };
+
+    DebugManagerStateRestore dgbRestorer;
+    NEO::DebugManager.flags.ShareBuiltinBinariesAcrossDevices.set(1);
+    auto &binaryCache = static_cast<DriverHandleImp *>(device->getDriverHandle())->builtinBinaryCache;
+
+    MockDeviceWithBuilins testDevice(device);
+    L0::Device *testDevicePtr = &testDevice;
+    testDevice.builtins.reset(new BuiltinFunctionsLibImpl(testDevicePtr, neoDevice->getBuiltIns()));
+    testDevice.getBuiltinFunctionsLib()->initBuiltinKernel(Builtin::CopyBufferBytes);
+    EXPECT_EQ(1u, testDevice.createModuleCalled);
+    EXPECT_EQ(1u, binaryCache.getStoredCount());
+    EXPECT_EQ(0u, binaryCache.getHitCount());
+
+    testDevice.builtins.reset(new BuiltinFunctionsLibImpl(testDevicePtr, neoDevice->getBuiltIns()));
+    testDevice.getBuiltinFunctionsLib()->initBuiltinKernel(Builtin::CopyBufferBytes);
+    EXPECT_EQ(2u, testDevice.createModuleCalled);
+    EXPECT_EQ(ZE_MODULE_FORMAT_NATIVE, testDevice.lastFormat);
+    EXPECT_EQ(1u, binaryCache.getStoredCount());
+    EXPECT_EQ(1u, binaryCache.getHitCount());
+    EXPECT_NE(nullptr, testDevice.getBuiltinFunctionsLib()->getFunction(Builtin::CopyBufferBytes));
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenShareBuiltinBinariesAcrossDevicesDisabledWhenLoadingBuiltinThenDriverCacheIsNotUsed) {
+    auto &binaryCache = static_cast<DriverHandleImp *>(device->getDriverHandle())->builtinBinaryCache;
+
+    BuiltinFunctionsLibImpl lib(device, neoDevice->getBuiltIns());
+    lib.initBuiltinKernel(Builtin::CopyBufferBytes);
+    EXPECT_EQ(0u, binaryCache.getStoredCount());
+    EXPECT_EQ(0u, binaryCache.getHitCount());
+}
+
+TEST(BuiltinBinaryCacheTest, givenDifferentRevisionsWhenCreatingKeysThenKeysDiffer) {
+    NEO::HardwareInfo hwInfo = *NEO::defaultHwInfo;
+    auto key0 = BuiltinBinaryCache::createKey(hwInfo, NEO::EBuiltInOps::CopyBufferToBuffer);
+    hwInfo.platform.usRevId++;
+    auto key1 = BuiltinBinaryCache::createKey(hwInfo, NEO::EBuiltInOps::CopyBufferToBuffer);
+    EXPECT_NE(key0, key1);
+
+    BuiltinBinaryCache cache;
+    cache.store(key0, {1, 2, 3});
+    cache.store(key1, {});
+    EXPECT_EQ(1u, cache.getStoredCount());
+    EXPECT_EQ(nullptr, cache.get(key1));
+    auto binary = cache.get(key0);
+    ASSERT_NE(nullptr, binary);
+    EXPECT_EQ(3u, binary->size());
+    EXPECT_EQ(1u, cache.getHitCount());
+}
+
 } // namespace ult
 } // namespace L0
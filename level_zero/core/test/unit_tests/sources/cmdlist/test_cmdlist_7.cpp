@@ -7,6 +7,7 @@
 
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/os_interface/sys_calls_common.h"
+#include "shared/source/utilities/copy_threshold_calibrator.h"
 #include "shared/test/common/cmd_parse/hw_parse.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
@@ -2290,6 +2291,67 @@ HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndThresholdDebug
     EXPECT_EQ(6 * MemoryConstants::megaByte, cmdList.getTransferThreshold(DEVICE_USM_TO_HOST_NON_USM));
 }
 
+HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListWithCalibratedThresholdWhenGetTransferThresholdThenCalibratedValueIsReturnedUnlessOverriddenByDebugFlag, IsAtLeastSkl) {
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.copyThroughLockedPtrEnabled = true;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+
+    NEO::CopyThresholdCalibrator calibrator;
+    for (uint32_t i = 0u; i < NEO::CopyThresholdCalibrator::minSamplesPerBucket; i++) {
+        calibrator.recordSample(HOST_NON_USM_TO_DEVICE_USM, NEO::CopyThresholdCalibrator::CopyPath::cpu, 1024u, 100u);
+        calibrator.recordSample(HOST_NON_USM_TO_DEVICE_USM, NEO::CopyThresholdCalibrator::CopyPath::gpu, 1024u, 10000u);
+    }
+    cmdList.copyThresholdCalibrator = &calibrator;
+
+    EXPECT_EQ(2047u, cmdList.getTransferThreshold(HOST_NON_USM_TO_DEVICE_USM));
+    EXPECT_EQ(1 * MemoryConstants::kiloByte, cmdList.getTransferThreshold(DEVICE_USM_TO_HOST_NON_USM));
+
+    DebugManager.flags.ExperimentalH2DCpuCopyThreshold.set(5 * MemoryConstants::megaByte);
+    EXPECT_EQ(5 * MemoryConstants::megaByte, cmdList.getTransferThreshold(HOST_NON_USM_TO_DEVICE_USM));
+}
+
+HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListWithCalibratorWhenCopySizeIsNearThresholdThenPathLackingSamplesIsExplored, IsAtLeastSkl) {
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.copyThroughLockedPtrEnabled = true;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    NEO::CopyThresholdCalibrator calibrator;
+    cmdList.copyThresholdCalibrator = &calibrator;
+
+    auto threshold = cmdList.getTransferThreshold(HOST_NON_USM_TO_DEVICE_USM);
+    CpuMemCopyInfo cpuMemCopyInfo(devicePtr, nonUsmHostPtr, threshold);
+    device->getDriverHandle()->findAllocationDataForRange(devicePtr, threshold, &cpuMemCopyInfo.dstAllocData);
+
+    cmdList.isSyncModeQueue = false;
+    EXPECT_TRUE(cmdList.preferCopyThroughLockedPtr(cpuMemCopyInfo, 0, nullptr));
+    EXPECT_TRUE(cpuMemCopyInfo.latencySampleRequired);
+    EXPECT_EQ(HOST_NON_USM_TO_DEVICE_USM, cpuMemCopyInfo.transferType);
+
+    cmdList.isSyncModeQueue = true;
+    EXPECT_FALSE(cmdList.preferCopyThroughLockedPtr(cpuMemCopyInfo, 0, nullptr));
+
+    CpuMemCopyInfo smallCopyInfo(devicePtr, nonUsmHostPtr, 1024u);
+    smallCopyInfo.dstAllocData = cpuMemCopyInfo.dstAllocData;
+    EXPECT_TRUE(cmdList.preferCopyThroughLockedPtr(smallCopyInfo, 0, nullptr));
+
+    for (uint32_t i = 0u; i < NEO::CopyThresholdCalibrator::minSamplesPerBucket; i++) {
+        calibrator.recordSample(HOST_NON_USM_TO_DEVICE_USM, NEO::CopyThresholdCalibrator::CopyPath::gpu, threshold, 1000u);
+    }
+    EXPECT_TRUE(cmdList.preferCopyThroughLockedPtr(cpuMemCopyInfo, 0, nullptr));
+}
+
+HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListWithCalibratorWhenCopyH2DThroughLockedPtrThenCpuLatencySampleIsRecorded, IsAtLeastSkl) {
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.copyThroughLockedPtrEnabled = true;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    cmdList.csr = device->getNEODevice()->getInternalEngine().commandStreamReceiver;
+    NEO::CopyThresholdCalibrator calibrator;
+    cmdList.copyThresholdCalibrator = &calibrator;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, 1024, nullptr, 0, nullptr, false));
+    EXPECT_TRUE(calibrator.isDirty());
+    EXPECT_NE(std::string::npos, calibrator.serialize().find("bucket 2 0 10 1 "));
+}
+
 HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndNonUsmHostPtrWhenCopyH2DThenLockPtr, IsAtLeastSkl) {
     MockCommandListImmediateHw<gfxCoreFamily> cmdList;
     cmdList.copyThroughLockedPtrEnabled = true;
@@ -498,5 +498,175 @@ HWTEST2_F(CommandListAppendUsedPacketSignalEvent,
     }
 }
 
+
+HWTEST_F(CommandListAppendEventReset, givenTimestampEventsPlacedBackToBackWhenResetOneAfterAnotherThenResetsAreMergedWithSingleBarrierWithPostSync) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    using POST_SYNC_OPERATION = typename PIPE_CONTROL::POST_SYNC_OPERATION;
+    using MI_STORE_DATA_IMM = typename FamilyType::MI_STORE_DATA_IMM;
+
+    constexpr uint32_t numEvents = 3u;
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = numEvents;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    std::unique_ptr<L0::Event> events[numEvents];
+    for (uint32_t i = 0; i < numEvents; i++) {
+        ze_event_desc_t eventDesc = {};
+        eventDesc.index = i;
+        events[i].reset(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    }
+
+    auto usedSpaceBefore = commandList->getCmdContainer().getCommandStream()->getUsed();
+
+    for (uint32_t i = 0; i < numEvents; i++) {
+        result = commandList->appendEventReset(events[i]->toHandle());
+        ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    }
+
+    auto usedSpaceAfter = commandList->getCmdContainer().getCommandStream()->getUsed();
+    ASSERT_GT(usedSpaceAfter, usedSpaceBefore);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList,
+                                                      ptrOffset(commandList->getCmdContainer().getCommandStream()->getCpuBase(), usedSpaceBefore),
+                                                      usedSpaceAfter - usedSpaceBefore));
+
+    auto maxPackets = events[0]->getMaxPacketsCount();
+    auto itorSdi = findAll<MI_STORE_DATA_IMM *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(numEvents * maxPackets - 1, static_cast<uint32_t>(itorSdi.size()));
+    EXPECT_EQ(events[0]->getCompletionFieldGpuAddress(device), genCmdCast<MI_STORE_DATA_IMM *>(*itorSdi[0])->getAddress());
+
+    uint32_t postSyncFound = 0;
+    auto itorPC = findAll<PIPE_CONTROL *>(cmdList.begin(), cmdList.end());
+    for (auto it : itorPC) {
+        auto cmd = genCmdCast<PIPE_CONTROL *>(*it);
+        if (cmd->getPostSyncOperation() == POST_SYNC_OPERATION::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA) {
+            EXPECT_EQ(Event::STATE_CLEARED, cmd->getImmediateData());
+            auto lastPacketAddress = events[numEvents - 1]->getCompletionFieldGpuAddress(device) + (maxPackets - 1) * events[numEvents - 1]->getSinglePacketSize();
+            EXPECT_EQ(lastPacketAddress, NEO::UnitTestHelper<FamilyType>::getPipeControlPostSyncAddress(*cmd));
+            postSyncFound++;
+        }
+    }
+    EXPECT_EQ(1u, postSyncFound);
+}
+
+HWTEST_F(CommandListAppendEventReset, givenTimestampEventsNotPlacedBackToBackWhenResetOneAfterAnotherThenEachResetHasOwnBarrierWithPostSync) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    using POST_SYNC_OPERATION = typename PIPE_CONTROL::POST_SYNC_OPERATION;
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 3;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 0;
+    auto firstEvent = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    eventDesc.index = 2;
+    auto secondEvent = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    auto usedSpaceBefore = commandList->getCmdContainer().getCommandStream()->getUsed();
+
+    result = commandList->appendEventReset(firstEvent->toHandle());
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    result = commandList->appendEventReset(secondEvent->toHandle());
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto usedSpaceAfter = commandList->getCmdContainer().getCommandStream()->getUsed();
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList,
+                                                      ptrOffset(commandList->getCmdContainer().getCommandStream()->getCpuBase(), usedSpaceBefore),
+                                                      usedSpaceAfter - usedSpaceBefore));
+
+    uint32_t postSyncFound = 0;
+    auto itorPC = findAll<PIPE_CONTROL *>(cmdList.begin(), cmdList.end());
+    for (auto it : itorPC) {
+        auto cmd = genCmdCast<PIPE_CONTROL *>(*it);
+        if (cmd->getPostSyncOperation() == POST_SYNC_OPERATION::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA) {
+            postSyncFound++;
+        }
+    }
+    EXPECT_EQ(2u, postSyncFound);
+}
+
+HWTEST_F(CommandListAppendEventReset, givenImmediateCmdlistWhenResettingEventsPlacedBackToBackThenResetsAreNotMerged) {
+    using MI_STORE_DATA_IMM = typename FamilyType::MI_STORE_DATA_IMM;
+
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    eventDesc.index = 1;
+    auto secondEvent = std::unique_ptr<Event>(static_cast<Event *>(getHelper<L0GfxCoreHelper>().createEvent(eventPool.get(), &eventDesc, device)));
+
+    commandList->cmdListType = CommandList::CommandListType::TYPE_IMMEDIATE;
+    auto result = commandList->appendEventReset(event->toHandle());
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto usedSpaceBefore = commandList->getCmdContainer().getCommandStream()->getUsed();
+    result = commandList->appendEventReset(secondEvent->toHandle());
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    commandList->cmdListType = CommandList::CommandListType::TYPE_REGULAR;
+
+    auto usedSpaceAfter = commandList->getCmdContainer().getCommandStream()->getUsed();
+    ASSERT_GT(usedSpaceAfter, usedSpaceBefore);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList,
+                                                      ptrOffset(commandList->getCmdContainer().getCommandStream()->getCpuBase(), usedSpaceBefore),
+                                                      usedSpaceAfter - usedSpaceBefore));
+
+    auto itorSdi = findAll<MI_STORE_DATA_IMM *>(cmdList.begin(), cmdList.end());
+    ASSERT_NE(0u, itorSdi.size());
+    EXPECT_EQ(secondEvent->getCompletionFieldGpuAddress(device), genCmdCast<MI_STORE_DATA_IMM *>(*itorSdi[0])->getAddress());
+}
+
+HWTEST_F(CommandListAppendEventReset, givenCopyOnlyCmdlistAndEventsPlacedBackToBackWhenResetOneAfterAnotherThenRangeIsClearedWithSingleFill) {
+    using MI_FLUSH_DW = typename FamilyType::MI_FLUSH_DW;
+    using XY_COLOR_BLT = typename FamilyType::XY_COLOR_BLT;
+    ze_result_t returnValue;
+    commandList.reset(whiteboxCast(CommandList::create(productFamily, device, NEO::EngineGroupType::Copy, 0u, returnValue)));
+
+    auto tagSize = event->getTimestampSizeInDw() * sizeof(uint32_t);
+    if (device->getNEODevice()->getGfxCoreHelper().getMaxFillPaternSizeForCopyEngine() < tagSize) {
+        GTEST_SKIP();
+    }
+
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    eventDesc.index = 1;
+    auto secondEvent = std::unique_ptr<Event>(static_cast<Event *>(getHelper<L0GfxCoreHelper>().createEvent(eventPool.get(), &eventDesc, device)));
+
+    auto usedSpaceBefore = commandList->getCmdContainer().getCommandStream()->getUsed();
+
+    auto result = commandList->appendEventReset(event->toHandle());
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    result = commandList->appendEventReset(secondEvent->toHandle());
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto usedSpaceAfter = commandList->getCmdContainer().getCommandStream()->getUsed();
+    ASSERT_GT(usedSpaceAfter, usedSpaceBefore);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList,
+                                                      ptrOffset(commandList->getCmdContainer().getCommandStream()->getCpuBase(), usedSpaceBefore),
+                                                      usedSpaceAfter - usedSpaceBefore));
+
+    auto itorFill = find<XY_COLOR_BLT *>(cmdList.begin(), cmdList.end());
+    ASSERT_NE(cmdList.end(), itorFill);
+    auto fillCmd = genCmdCast<XY_COLOR_BLT *>(*itorFill);
+    EXPECT_EQ(event->getGpuAddress(device), fillCmd->getDestinationBaseAddress());
+
+    auto itorFlush = findAll<MI_FLUSH_DW *>(cmdList.begin(), cmdList.end());
+    ASSERT_NE(0u, itorFlush.size());
+    for (auto it : itorFlush) {
+        auto cmd = genCmdCast<MI_FLUSH_DW *>(*it);
+        EXPECT_NE(MI_FLUSH_DW::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA_QWORD, cmd->getPostSyncOperation());
+    }
+}
+
 } // namespace ult
 } // namespace L0
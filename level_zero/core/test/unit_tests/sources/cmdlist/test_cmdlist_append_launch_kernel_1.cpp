@@ -976,5 +976,107 @@ HWTEST2_F(CommandListAppendLaunchKernel, whenUpdateStreamPropertiesIsCalledThenC
     }
 }
 
+HWTEST_F(CommandListAppendLaunchKernelMockModule, givenRegularCommandListWhenUsingCaptureThenUnsupportedFeatureIsReturned) {
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->beginCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->endCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->replayCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->patchCapturedKernelArgument(0u, 0u, 0u, nullptr));
+}
+
+HWTEST_F(CommandListAppendLaunchKernelMockModule, givenImmediateCommandListWhenCapturingKernelLaunchThenNothingIsSubmittedUntilReplay) {
+    auto csr = neoDevice->getDefaultEngine().commandStreamReceiver;
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandListImmediate->endCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandListImmediate->replayCapture());
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->beginCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandListImmediate->beginCapture());
+
+    auto taskCountBeforeCapture = csr->peekTaskCount();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(taskCountBeforeCapture, csr->peekTaskCount());
+
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandListImmediate->replayCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandListImmediate->patchCapturedKernelArgument(0u, 0u, 0u, nullptr));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->endCapture());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->replayCapture());
+    EXPECT_EQ(taskCountBeforeCapture + 1, csr->peekTaskCount());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->replayCapture());
+    EXPECT_EQ(taskCountBeforeCapture + 2, csr->peekTaskCount());
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandListImmediate->patchCapturedKernelArgument(2u, 0u, 0u, nullptr));
+    auto argCount = static_cast<uint32_t>(kernel->getKernelDescriptor().payloadMappings.explicitArgs.size());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX, commandListImmediate->patchCapturedKernelArgument(1u, argCount, 0u, nullptr));
+}
+
+HWTEST_F(CommandListAppendLaunchKernelMockModule, givenCaptureInProgressWhenAppendingCommandsOtherThanKernelLaunchOrMemoryCopyThenUnsupportedFeatureIsReturnedAndNothingIsSubmitted) {
+    auto csr = neoDevice->getDefaultEngine().commandStreamReceiver;
+    ze_group_count_t groupCount{1, 1, 1};
+    ze_event_handle_t hEvent = reinterpret_cast<ze_event_handle_t>(0x1234);
+    uint32_t pattern = 0u;
+    uint64_t timestamp = 0u;
+    uint8_t buffer[64] = {};
+    ze_copy_region_t region = {0, 0, 0, 4, 4, 1};
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->beginCapture());
+    auto taskCountBeforeCapture = csr->peekTaskCount();
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandListImmediate->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandListImmediate->appendSignalEvent(hEvent));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandListImmediate->appendEventReset(hEvent));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandListImmediate->appendWaitOnEvents(1, &hEvent, false, true, false));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandListImmediate->appendMemoryFill(buffer, &pattern, sizeof(pattern), sizeof(buffer), nullptr, 0, nullptr, false));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandListImmediate->appendMemoryCopyRegion(buffer, &region, 4, 0, buffer, &region, 4, 0, nullptr, 0, nullptr, false));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandListImmediate->appendWriteGlobalTimestamp(&timestamp, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandListImmediate->appendLaunchCooperativeKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, false));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandListImmediate->appendLaunchKernelIndirect(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, false));
+    EXPECT_EQ(taskCountBeforeCapture, csr->peekTaskCount());
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->endCapture());
+}
+
+HWTEST2_F(CommandListAppendLaunchKernelMockModule, givenCapturedKernelLaunchWhenPatchingValueArgumentThenEncodedCrossThreadDataIsUpdated, IsAtLeastSkl) {
+    auto &explicitArgs = const_cast<NEO::KernelDescriptor &>(kernel->getKernelDescriptor()).payloadMappings.explicitArgs;
+    if (kernel->getCrossThreadDataSize() < sizeof(uint32_t)) {
+        GTEST_SKIP();
+    }
+    auto explicitArgsBackup = explicitArgs;
+    NEO::ArgDescriptor valueArg(NEO::ArgDescriptor::ArgTValue);
+    NEO::ArgDescValue::Element element;
+    element.offset = 0u;
+    element.size = sizeof(uint32_t);
+    element.sourceOffset = 0u;
+    valueArg.as<NEO::ArgDescValue>().elements.push_back(element);
+    explicitArgs.clear();
+    explicitArgs.push_back(valueArg);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->beginCapture());
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->endCapture());
+
+    auto immediateHw = static_cast<WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>> *>(static_cast<L0::CommandList *>(commandListImmediate.get()));
+    ASSERT_EQ(1u, immediateHw->capturedLaunches.size());
+    ASSERT_EQ(1u, immediateHw->capturedLaunches[0].size());
+    auto &kernelLaunch = immediateHw->capturedLaunches[0][0];
+    EXPECT_EQ(kernel.get(), kernelLaunch.kernel);
+
+    uint32_t argValue = 0x1234u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->patchCapturedKernelArgument(0u, 0u, sizeof(argValue), &argValue));
+    EXPECT_EQ(0, memcmp(kernelLaunch.crossThreadData.data(), &argValue, sizeof(argValue)));
+
+    auto encodedArgLocation = kernelLaunch.encodedInlineDataSize > 0 ? kernelLaunch.encodedInlineData : kernelLaunch.encodedCrossThreadData;
+    ASSERT_NE(nullptr, encodedArgLocation);
+    EXPECT_EQ(0, memcmp(encodedArgLocation, &argValue, sizeof(argValue)));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandListImmediate->replayCapture());
+    explicitArgs = explicitArgsBackup;
+}
+
 } // namespace ult
 } // namespace L0
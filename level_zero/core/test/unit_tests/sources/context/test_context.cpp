@@ -8,6 +8,8 @@
 #include "shared/source/built_ins/sip.h"
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/helpers/blit_properties.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_compilers.h"
 #include "shared/test/common/mocks/mock_cpu_page_fault_manager.h"
@@ -477,6 +479,56 @@ TEST_F(ContextTest, whenCreatingAndDestroyingContextThenSuccessIsReturned) {
     EXPECT_EQ(ZE_RESULT_SUCCESS, res);
 }
 
+TEST_F(ContextTest, givenHostUsmAllocationPoolEnabledWhenAllocatingSmallHostAllocationsThenTheyAreServicedFromPool) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHostUsmAllocationPool.set(2);
+
+    ze_context_handle_t hContext;
+    ze_context_desc_t desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+    ze_result_t res = driverHandle->createContext(&desc, 0u, nullptr, &hContext);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    auto contextImp = static_cast<ContextImp *>(L0::Context::fromHandle(hContext));
+
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    void *ptr0 = nullptr;
+    void *ptr1 = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->allocHostMem(&hostDesc, 100u, 0u, &ptr0));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->allocHostMem(&hostDesc, 100u, 0u, &ptr1));
+    ASSERT_NE(nullptr, contextImp->getUsmHostMemAllocPool());
+    EXPECT_EQ(contextImp->getUsmHostMemAllocPool(), contextImp->getUsmMemAllocPool(ptr0));
+    EXPECT_EQ(contextImp->getUsmHostMemAllocPool(), contextImp->getUsmMemAllocPool(ptr1));
+
+    void *basePtr = nullptr;
+    size_t size = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->getMemAddressRange(ptrOffset(ptr1, 10u), &basePtr, &size));
+    EXPECT_EQ(ptr1, basePtr);
+    EXPECT_EQ(100u, size);
+
+    ze_memory_allocation_properties_t memoryProperties0 = {};
+    ze_memory_allocation_properties_t memoryProperties1 = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->getMemAllocProperties(ptr0, &memoryProperties0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->getMemAllocProperties(ptr1, &memoryProperties1, nullptr));
+    EXPECT_EQ(ZE_MEMORY_TYPE_HOST, memoryProperties0.type);
+    EXPECT_NE(memoryProperties0.id, memoryProperties1.id);
+
+    ze_ipc_mem_handle_t ipcHandle = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, contextImp->getIpcMemHandle(ptr0, &ipcHandle));
+    uint32_t numIpcHandles = 0u;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, contextImp->getIpcMemHandles(ptr0, &numIpcHandles, nullptr));
+
+    void *largePtr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->allocHostMem(&hostDesc, 2 * MemoryConstants::megaByte, 0u, &largePtr));
+    EXPECT_EQ(nullptr, contextImp->getUsmMemAllocPool(largePtr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->freeMem(ptr0));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, contextImp->freeMem(ptr0));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->freeMem(ptr1));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->freeMem(largePtr));
+
+    res = contextImp->destroy();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+}
+
 using ContextMakeMemoryResidentTests = Test<HostPointerManagerFixure>;
 
 TEST_F(ContextMakeMemoryResidentTests,
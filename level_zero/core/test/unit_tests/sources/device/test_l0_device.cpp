@@ -4539,5 +4539,100 @@ TEST(DeviceReturnSubDevicesAsApiDevicesTest, GivenReturnSubDevicesAsApiDevicesIs
     multiDeviceFixture.tearDown();
 }
 
+using BcsSplitChunkTest = Test<DeviceFixture>;
+
+TEST_F(BcsSplitChunkTest, givenWeightedSplitDisabledWhenGettingChunkSizesThenSizeIsSplitEvenly) {
+    BcsSplit bcsSplit(*static_cast<DeviceImp *>(device));
+    bcsSplit.cmdQs = {reinterpret_cast<L0::CommandQueue *>(0x1000), reinterpret_cast<L0::CommandQueue *>(0x2000), reinterpret_cast<L0::CommandQueue *>(0x3000)};
+    bcsSplit.engineThroughput = {1u, 2u, 3u};
+
+    StackVec<size_t, 4> chunkSizes;
+    bcsSplit.getChunkSizes(bcsSplit.cmdQs, 100u, 0u, MemoryConstants::pageSize64k, chunkSizes);
+    ASSERT_EQ(3u, chunkSizes.size());
+    EXPECT_EQ(33u, chunkSizes[0]);
+    EXPECT_EQ(33u, chunkSizes[1]);
+    EXPECT_EQ(34u, chunkSizes[2]);
+}
+
+TEST_F(BcsSplitChunkTest, givenWeightedSplitAndNotAllEnginesMeasuredWhenGettingChunkSizesThenChunksAreEvenAndAligned) {
+    BcsSplit bcsSplit(*static_cast<DeviceImp *>(device));
+    bcsSplit.weightedSplit = true;
+    bcsSplit.cmdQs = {reinterpret_cast<L0::CommandQueue *>(0x1000), reinterpret_cast<L0::CommandQueue *>(0x2000), reinterpret_cast<L0::CommandQueue *>(0x3000)};
+    bcsSplit.engineThroughput = {10u, 0u, 10u};
+
+    size_t size = 4 * MemoryConstants::megaByte + 7u;
+    StackVec<size_t, 4> chunkSizes;
+    bcsSplit.getChunkSizes(bcsSplit.cmdQs, size, 0u, MemoryConstants::pageSize64k, chunkSizes);
+    ASSERT_EQ(3u, chunkSizes.size());
+    EXPECT_EQ(0u, chunkSizes[0] % MemoryConstants::pageSize64k);
+    EXPECT_EQ(0u, chunkSizes[1] % MemoryConstants::pageSize64k);
+    EXPECT_EQ(chunkSizes[0], chunkSizes[1]);
+    EXPECT_EQ(size, chunkSizes[0] + chunkSizes[1] + chunkSizes[2]);
+}
+
+TEST_F(BcsSplitChunkTest, givenWeightedSplitAndMeasuredThroughputWhenGettingChunkSizesThenChunksAreProportionalToThroughput) {
+    BcsSplit bcsSplit(*static_cast<DeviceImp *>(device));
+    bcsSplit.weightedSplit = true;
+    bcsSplit.cmdQs = {reinterpret_cast<L0::CommandQueue *>(0x1000), reinterpret_cast<L0::CommandQueue *>(0x2000)};
+    bcsSplit.engineThroughput = {30u, 10u};
+
+    size_t size = 8 * MemoryConstants::megaByte;
+    StackVec<size_t, 4> chunkSizes;
+    bcsSplit.getChunkSizes(bcsSplit.cmdQs, size, 0u, MemoryConstants::pageSize64k, chunkSizes);
+    ASSERT_EQ(2u, chunkSizes.size());
+    EXPECT_EQ(6 * MemoryConstants::megaByte, chunkSizes[0]);
+    EXPECT_EQ(2 * MemoryConstants::megaByte, chunkSizes[1]);
+
+    std::vector<L0::CommandQueue *> subset = {bcsSplit.cmdQs[1]};
+    bcsSplit.getChunkSizes(subset, size, 0u, MemoryConstants::pageSize64k, chunkSizes);
+    ASSERT_EQ(1u, chunkSizes.size());
+    EXPECT_EQ(size, chunkSizes[0]);
+}
+
+TEST_F(BcsSplitChunkTest, givenWeightedSplitAndSizeSmallerThanAlignedChunksWhenGettingChunkSizesThenEveryEngineGetsNonZeroChunk) {
+    BcsSplit bcsSplit(*static_cast<DeviceImp *>(device));
+    bcsSplit.weightedSplit = true;
+    bcsSplit.cmdQs = {reinterpret_cast<L0::CommandQueue *>(0x1000), reinterpret_cast<L0::CommandQueue *>(0x2000)};
+    bcsSplit.engineThroughput = {1000u, 1u};
+
+    StackVec<size_t, 4> chunkSizes;
+    bcsSplit.getChunkSizes(bcsSplit.cmdQs, 100u, 0u, MemoryConstants::pageSize64k, chunkSizes);
+    ASSERT_EQ(2u, chunkSizes.size());
+    EXPECT_EQ(99u, chunkSizes[0]);
+    EXPECT_EQ(1u, chunkSizes[1]);
+}
+
+TEST_F(BcsSplitChunkTest, givenWeightedSplitAndUnalignedDestinationWhenGettingChunkSizesThenChunkBoundariesAreAlignedRelativeToDestination) {
+    BcsSplit bcsSplit(*static_cast<DeviceImp *>(device));
+    bcsSplit.weightedSplit = true;
+    bcsSplit.cmdQs = {reinterpret_cast<L0::CommandQueue *>(0x1000), reinterpret_cast<L0::CommandQueue *>(0x2000), reinterpret_cast<L0::CommandQueue *>(0x3000)};
+    bcsSplit.engineThroughput = {10u, 10u, 10u};
+
+    uint64_t dstAddress = 16 * MemoryConstants::pageSize64k + 0x100;
+    size_t size = 6 * MemoryConstants::megaByte;
+    StackVec<size_t, 4> chunkSizes;
+    bcsSplit.getChunkSizes(bcsSplit.cmdQs, size, dstAddress, MemoryConstants::pageSize64k, chunkSizes);
+    ASSERT_EQ(3u, chunkSizes.size());
+    EXPECT_EQ(2 * MemoryConstants::megaByte - 0x100, chunkSizes[0]);
+    EXPECT_EQ(0u, (dstAddress + chunkSizes[0]) % MemoryConstants::pageSize64k);
+    EXPECT_EQ(0u, (dstAddress + chunkSizes[0] + chunkSizes[1]) % MemoryConstants::pageSize64k);
+    EXPECT_EQ(size, chunkSizes[0] + chunkSizes[1] + chunkSizes[2]);
+}
+
+TEST_F(BcsSplitChunkTest, givenWeightedSplitAndUnalignedDestinationWithSmallSizeWhenGettingChunkSizesThenFirstChunkEndsAtNextAlignedBoundary) {
+    BcsSplit bcsSplit(*static_cast<DeviceImp *>(device));
+    bcsSplit.weightedSplit = true;
+    bcsSplit.cmdQs = {reinterpret_cast<L0::CommandQueue *>(0x1000), reinterpret_cast<L0::CommandQueue *>(0x2000)};
+    bcsSplit.engineThroughput = {1u, 1000u};
+
+    uint64_t dstAddress = MemoryConstants::pageSize64k - 0x10;
+    size_t size = 3 * MemoryConstants::pageSize64k;
+    StackVec<size_t, 4> chunkSizes;
+    bcsSplit.getChunkSizes(bcsSplit.cmdQs, size, dstAddress, MemoryConstants::pageSize64k, chunkSizes);
+    ASSERT_EQ(2u, chunkSizes.size());
+    EXPECT_EQ(0x10u, chunkSizes[0]);
+    EXPECT_EQ(size - 0x10u, chunkSizes[1]);
+}
+
 } // namespace ult
 } // namespace L0
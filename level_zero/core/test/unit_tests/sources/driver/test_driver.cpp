@@ -863,6 +863,12 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     decltype(&zexDriverReleaseImportedPointer) expectedRelease = L0::zexDriverReleaseImportedPointer;
     decltype(&zexDriverGetHostPointerBaseAddress) expectedGet = L0::zexDriverGetHostPointerBaseAddress;
     decltype(&zexKernelGetBaseAddress) expectedKernelGetBaseAddress = L0::zexKernelGetBaseAddress;
+    decltype(&zexEventHostResetBatch) expectedEventHostResetBatch = L0::zexEventHostResetBatch;
+    decltype(&zexCommandListBeginCapture) expectedBeginCapture = L0::zexCommandListBeginCapture;
+    decltype(&zexCommandListEndCapture) expectedEndCapture = L0::zexCommandListEndCapture;
+    decltype(&zexCommandListReplayCapture) expectedReplayCapture = L0::zexCommandListReplayCapture;
+    decltype(&zexCommandListPatchCapturedKernelArgument) expectedPatchCapturedKernelArgument = L0::zexCommandListPatchCapturedKernelArgument;
+    decltype(&zexSysmanDeviceGetEngineActivity) expectedSysmanDeviceGetEngineActivity = L0::zexSysmanDeviceGetEngineActivity;
 
     void *funPtr = nullptr;
 
@@ -881,6 +887,30 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexKernelGetBaseAddress", &funPtr);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
     EXPECT_EQ(expectedKernelGetBaseAddress, reinterpret_cast<decltype(&zexKernelGetBaseAddress)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexEventHostResetBatch", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedEventHostResetBatch, reinterpret_cast<decltype(&zexEventHostResetBatch)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListBeginCapture", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedBeginCapture, reinterpret_cast<decltype(&zexCommandListBeginCapture)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListEndCapture", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedEndCapture, reinterpret_cast<decltype(&zexCommandListEndCapture)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListReplayCapture", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedReplayCapture, reinterpret_cast<decltype(&zexCommandListReplayCapture)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListPatchCapturedKernelArgument", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedPatchCapturedKernelArgument, reinterpret_cast<decltype(&zexCommandListPatchCapturedKernelArgument)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexSysmanDeviceGetEngineActivity", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedSysmanDeviceGetEngineActivity, reinterpret_cast<decltype(&zexSysmanDeviceGetEngineActivity)>(funPtr));
 }
 
 TEST_F(DriverExperimentalApiTest, givenHostPointerApiExistWhenImportingPtrThenExpectProperBehavior) {
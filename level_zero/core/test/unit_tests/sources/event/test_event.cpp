@@ -1280,6 +1280,80 @@ TEST_F(EventPoolCreate, whenAllocationMemoryFailsThenEventAllocationIsNotCreated
     EXPECT_EQ(nullptr, eventPool);
 }
 
+TEST_F(EventPoolCreate, givenEventPoolRecyclingEnabledWhenEventPoolIsDestroyedThenItsAllocationIsReusedByEventPoolWithSameParameters) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableEventPoolRecycling.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        4};
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool);
+    auto allocation = eventPool->getAllocation().getDefaultGraphicsAllocation();
+
+    eventPool.reset();
+    EXPECT_EQ(1u, driverHandle->recycledEventPoolAllocations.size());
+
+    eventPool.reset(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool);
+    EXPECT_EQ(allocation, eventPool->getAllocation().getDefaultGraphicsAllocation());
+    EXPECT_TRUE(driverHandle->recycledEventPoolAllocations.empty());
+
+    eventPoolDesc.count = 256;
+    std::unique_ptr<L0::EventPool> biggerEventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, biggerEventPool);
+    EXPECT_NE(allocation, biggerEventPool->getAllocation().getDefaultGraphicsAllocation());
+
+    eventPool.reset();
+    biggerEventPool.reset();
+    ASSERT_EQ(1u, driverHandle->recycledEventPoolAllocations.size());
+    EXPECT_NE(allocation, driverHandle->recycledEventPoolAllocations.back().allocations->getDefaultGraphicsAllocation());
+}
+
+TEST_F(EventPoolCreate, givenEventPoolRecyclingDisabledWhenEventPoolIsDestroyedThenItsAllocationIsNotRecycled) {
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        4};
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool);
+    EXPECT_FALSE(eventPool->isEventPoolAllocationRecyclable());
+
+    eventPool.reset();
+    EXPECT_TRUE(driverHandle->recycledEventPoolAllocations.empty());
+}
+
+TEST_F(EventPoolCreate, givenEventPoolRecyclingEnabledWhenIpcEventPoolIsDestroyedThenItsAllocationIsNotRecycled) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableEventPoolRecycling.set(4);
+
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE | ZE_EVENT_POOL_FLAG_IPC,
+        4};
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool);
+    EXPECT_FALSE(eventPool->isEventPoolAllocationRecyclable());
+
+    eventPool.reset();
+    EXPECT_TRUE(driverHandle->recycledEventPoolAllocations.empty());
+}
+
 TEST_F(EventCreate, givenAnEventCreatedThenTheEventHasTheDeviceCommandStreamReceiverSet) {
     ze_event_pool_desc_t eventPoolDesc = {
         ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
@@ -2590,6 +2664,39 @@ TEST_F(EventTests, givenRegularEventUseMultiplePacketsWhenHostSignalThenExpectAl
     }
 }
 
+TEST_F(EventTests, givenSignaledEventsWhenResettingThemInBatchThenAllEventsAreNotReadyAndPacketsAreCleared) {
+    constexpr uint32_t numEvents = 3u;
+    ze_event_handle_t eventHandles[numEvents] = {};
+    for (uint32_t i = 0; i < numEvents; i++) {
+        eventDesc.index = i;
+        auto event = getHelper<L0GfxCoreHelper>().createEvent(eventPool.get(), &eventDesc, device);
+        ASSERT_NE(nullptr, event);
+        event->hostSignal();
+        EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+        eventHandles[i] = event->toHandle();
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostResetEvents(numEvents, eventHandles));
+
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto event = Event::fromHandle(eventHandles[i]);
+        EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+        EXPECT_EQ(1u, event->getPacketsInUse());
+        auto hostAddr = static_cast<uint32_t *>(event->getCompletionFieldHostAddress());
+        EXPECT_EQ(static_cast<uint32_t>(Event::STATE_INITIAL), *hostAddr);
+        event->destroy();
+    }
+}
+
+TEST_F(EventTests, givenNullEventHandleWhenResettingEventsInBatchThenErrorIsReturned) {
+    auto event = getHelper<L0GfxCoreHelper>().createEvent(eventPool.get(), &eventDesc, device);
+    ASSERT_NE(nullptr, event);
+    ze_event_handle_t eventHandles[] = {event->toHandle(), nullptr};
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, Event::hostResetEvents(2u, eventHandles));
+    event->destroy();
+}
+
 TEST_F(EventUsedPacketSignalTests, givenEventUseMultiplePacketsWhenHostSignalThenExpectAllPacketsAreSignaled) {
     eventDesc.index = 0;
     eventDesc.signal = 0;
@@ -3706,6 +3706,90 @@ TEST_F(ModuleIsaCopyTest, whenModuleIsInitializedThenIsaIsCopied) {
     }
 }
 
+TEST_F(ModuleIsaCopyTest, givenIsaPackingEnabledWhenUserModuleWithMultipleKernelsIsInitializedThenKernelsShareIsaAllocationUploadedWithSingleTransfer) {
+    DebugManagerStateRestore restorer;
+    MockImmutableMemoryManager *mockMemoryManager = static_cast<MockImmutableMemoryManager *>(device->getNEODevice()->getMemoryManager());
+
+    auto zebinData = std::make_unique<ZebinTestData::ZebinWithL0TestCommonModule>(device->getHwInfo());
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(zebinData->storage.data());
+    moduleDesc.inputSize = zebinData->storage.size();
+
+    auto copiesBefore = mockMemoryManager->copyMemoryToAllocationCalledTimes;
+    auto unpackedModule = std::make_unique<L0::ModuleImp>(device, nullptr, ModuleType::User);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, unpackedModule->initialize(&moduleDesc, neoDevice));
+    auto unpackedModuleCopies = mockMemoryManager->copyMemoryToAllocationCalledTimes - copiesBefore;
+
+    struct ModuleWithZebinSegments : public L0::ModuleImp {
+        using ModuleImp::getZebinSegments;
+        using ModuleImp::ModuleImp;
+    };
+
+    DebugManager.flags.EnableModuleIsaPacking.set(64);
+    copiesBefore = mockMemoryManager->copyMemoryToAllocationCalledTimes;
+    auto packedModule = std::make_unique<ModuleWithZebinSegments>(device, nullptr, ModuleType::User);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, packedModule->initialize(&moduleDesc, neoDevice));
+    auto packedModuleCopies = mockMemoryManager->copyMemoryToAllocationCalledTimes - copiesBefore;
+
+    auto &kernelImmDatas = packedModule->getKernelImmutableDataVector();
+    ASSERT_EQ(zebinData->numOfKernels, kernelImmDatas.size());
+    EXPECT_EQ(unpackedModuleCopies - (zebinData->numOfKernels - 1), packedModuleCopies);
+
+    auto packedIsaAllocation = kernelImmDatas[0]->getIsaGraphicsAllocation();
+    ASSERT_NE(nullptr, packedIsaAllocation);
+    uint64_t expectedIsaOffset = 0u;
+    for (auto &kernelImmData : kernelImmDatas) {
+        EXPECT_EQ(packedIsaAllocation, kernelImmData->getIsaGraphicsAllocation());
+        EXPECT_EQ(packedIsaAllocation, kernelImmData->getIsaParentAllocation());
+        EXPECT_EQ(expectedIsaOffset, kernelImmData->getIsaOffsetInParentAllocation());
+        EXPECT_EQ(kernelImmData->getKernelInfo()->heapInfo.kernelHeapSize, kernelImmData->getIsaSize());
+        EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+        expectedIsaOffset = alignUp(expectedIsaOffset + kernelImmData->getIsaSize(), MemoryConstants::cacheLineSize);
+    }
+
+    auto segments = packedModule->getZebinSegments();
+    for (auto &kernelImmData : kernelImmDatas) {
+        auto &kernelSegment = segments.nameToSegMap[kernelImmData->getDescriptor().kernelMetadata.kernelName];
+        EXPECT_EQ(static_cast<uintptr_t>(packedIsaAllocation->getGpuAddress() + kernelImmData->getIsaOffsetInParentAllocation()), kernelSegment.address);
+        EXPECT_EQ(kernelImmData->getIsaSize(), kernelSegment.size);
+    }
+
+    ze_kernel_handle_t kernelHandle = nullptr;
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = kernelImmDatas[1]->getDescriptor().kernelMetadata.kernelName.c_str();
+    ASSERT_EQ(ZE_RESULT_SUCCESS, packedModule->createKernel(&kernelDesc, &kernelHandle));
+    auto kernel = static_cast<L0::KernelImp *>(Kernel::fromHandle(kernelHandle));
+    EXPECT_EQ(packedIsaAllocation, kernel->getIsaAllocation());
+    EXPECT_EQ(kernelImmDatas[1]->getIsaOffsetInParentAllocation(), kernel->getIsaOffsetInParentAllocation());
+
+    uint64_t baseAddress = 0u;
+    kernel->getBaseAddress(&baseAddress);
+    auto gmmHelper = neoDevice->getGmmHelper();
+    EXPECT_EQ(gmmHelper->decanonize(packedIsaAllocation->getGpuAddress() + kernelImmDatas[1]->getIsaOffsetInParentAllocation()), baseAddress);
+    kernel->destroy();
+}
+
+TEST_F(ModuleIsaCopyTest, givenIsaPackingEnabledWhenBuiltinModuleIsInitializedThenEachKernelHasOwnIsaAllocation) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableModuleIsaPacking.set(64);
+
+    auto zebinData = std::make_unique<ZebinTestData::ZebinWithL0TestCommonModule>(device->getHwInfo());
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(zebinData->storage.data());
+    moduleDesc.inputSize = zebinData->storage.size();
+
+    auto builtinModule = std::make_unique<L0::ModuleImp>(device, nullptr, ModuleType::Builtin);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, builtinModule->initialize(&moduleDesc, neoDevice));
+
+    for (auto &kernelImmData : builtinModule->getKernelImmutableDataVector()) {
+        EXPECT_EQ(nullptr, kernelImmData->getIsaParentAllocation());
+        EXPECT_EQ(0u, kernelImmData->getIsaOffsetInParentAllocation());
+    }
+    EXPECT_NE(builtinModule->getKernelImmutableDataVector()[0]->getIsaGraphicsAllocation(), builtinModule->getKernelImmutableDataVector()[1]->getIsaGraphicsAllocation());
+}
+
 using ModuleWithZebinTest = Test<ModuleWithZebinFixture>;
 TEST_F(ModuleWithZebinTest, givenNoZebinThenSegmentsAreEmpty) {
     auto segments = module->getZebinSegments();
@@ -932,6 +932,56 @@ HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhe
     context->freeMem(dstPtr);
 }
 
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsWeightedAndRegionWithFewerRowsThanEnginesWhenAppendingMemoryCopyRegionThenRowsAreSplitAndEmptySubcopiesAreSkipped, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsWeighted.set(1);
+    DebugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    EXPECT_TRUE(bcsSplit.weightedSplit);
+    ASSERT_EQ(bcsSplit.cmdQs.size(), 4u);
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t size = 8 * MemoryConstants::megaByte;
+    void *srcPtr = reinterpret_cast<void *>(0x1234);
+    void *dstPtr;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    context->allocHostMem(&hostDesc, size, alignment, &dstPtr);
+    constexpr uint32_t rowPitch = static_cast<uint32_t>(4 * MemoryConstants::megaByte);
+    ze_copy_region_t region = {0, 0, 0, rowPitch, 2, 1};
+
+    auto result = commandList0->appendMemoryCopyRegion(dstPtr, &region, rowPitch, 0, srcPtr, &region, rowPitch, 0, nullptr, 0, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[0])->getTaskCount(), 0u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[1])->getTaskCount(), 0u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[2])->getTaskCount(), 1u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[3])->getTaskCount(), 1u);
+    EXPECT_EQ(0u, bcsSplit.events.subcopySize[0]);
+    EXPECT_EQ(0u, bcsSplit.events.subcopySize[1]);
+    EXPECT_EQ(rowPitch, bcsSplit.events.subcopySize[2]);
+    EXPECT_EQ(rowPitch, bcsSplit.events.subcopySize[3]);
+
+    context->freeMem(dstPtr);
+}
+
 HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhenAppendingMemoryCopyWithEventThenSuccessIsReturnedAndMiFlushProgrammed, IsXeHpcCore) {
     using MI_FLUSH_DW = typename FamilyType::MI_FLUSH_DW;
 
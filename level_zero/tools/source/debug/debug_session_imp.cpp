@@ -21,6 +21,8 @@
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/include/zet_intel_gpu_debug.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 DebugSession::DebugSession(const zet_debug_config_t &config, Device *device) : connectedDevice(device), config(config) {
@@ -404,6 +406,8 @@ DebugSessionImp::Error DebugSessionImp::resumeThreadsWithinDevice(uint32_t devic
     // For resume(ALL) and multiple threads to resume - read whole state save area
     // to avoid multiple calls to KMD
     if (resumeThreadIds.size() > 1 && isThreadAll(apiThread)) {
+        const auto startTime = std::chrono::steady_clock::now();
+        const bool readSlotsOnly = isStateSaveAreaCacheEnabled();
 
         auto gpuVa = getContextStateSaveAreaGpuVa(memoryHandle);
         auto stateSaveAreaSize = getContextStateSaveAreaSize(memoryHandle);
@@ -413,21 +417,38 @@ DebugSessionImp::Error DebugSessionImp::resumeThreadsWithinDevice(uint32_t devic
 
         if (gpuVa != 0 && stateSaveAreaSize != 0) {
             stateSaveArea = std::make_unique<char[]>(stateSaveAreaSize);
-            stateSaveReadResult = readGpuMemory(memoryHandle, stateSaveArea.get(), stateSaveAreaSize, gpuVa);
+            if (readSlotsOnly) {
+                stateSaveReadResult = readThreadSlots(memoryHandle, gpuVa, resumeThreadIds, stateSaveArea.get());
+            } else {
+                stateSaveReadResult = readGpuMemory(memoryHandle, stateSaveArea.get(), stateSaveAreaSize, gpuVa);
+            }
         } else {
             DEBUG_BREAK_IF(true);
         }
 
-        for (auto &threadID : resumeThreadIds) {
+        for (size_t i = 0; i < resumeThreadIds.size(); i++) {
+            auto &threadID = resumeThreadIds[i];
             if (stateSaveReadResult == ZE_RESULT_SUCCESS) {
                 while (checkThreadIsResumed(threadID, stateSaveArea.get()) == false) {
                     // read state save area again to update sr counters
-                    stateSaveReadResult = readGpuMemory(allThreads[threadID]->getMemoryHandle(), stateSaveArea.get(), stateSaveAreaSize, gpuVa);
+                    if (readSlotsOnly) {
+                        // threads before current one are already resumed, their slots are not read anymore
+                        std::vector<EuThread::ThreadId> threadsToCheck(resumeThreadIds.begin() + i, resumeThreadIds.end());
+                        stateSaveReadResult = readThreadSlots(allThreads[threadID]->getMemoryHandle(), gpuVa, threadsToCheck, stateSaveArea.get());
+                    } else {
+                        stateSaveReadResult = readGpuMemory(allThreads[threadID]->getMemoryHandle(), stateSaveArea.get(), stateSaveAreaSize, gpuVa);
+                    }
                 }
             }
             allThreads[threadID]->resumeThread();
+            invalidateCachedThreadSlot(threadID);
         }
 
+        auto &counters = stateSaveAreaAccessCounters[static_cast<uint32_t>(StateSaveAreaAccess::resume)];
+        counters.totalTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+        PRINT_DEBUGGER_INFO_LOG("Resume of %zu threads - state save area reads: %llu, bytes read: %llu, time: %llu us\n", resumeThreadIds.size(),
+                                static_cast<unsigned long long>(counters.gpuReadsCount), static_cast<unsigned long long>(counters.gpuReadBytes), static_cast<unsigned long long>(counters.totalTimeUs));
+
     } else {
 
         for (auto &threadID : resumeThreadIds) {
@@ -435,6 +456,7 @@ DebugSessionImp::Error DebugSessionImp::resumeThreadsWithinDevice(uint32_t devic
                 ;
 
             allThreads[threadID]->resumeThread();
+            invalidateCachedThreadSlot(threadID);
         }
     }
     checkStoppedThreadsAndGenerateEvents(resumeThreadIds, memoryHandle, deviceIndex);
@@ -767,6 +789,7 @@ void DebugSessionImp::addThreadToNewlyStoppedFromRaisedAttention(EuThread::Threa
             }
 
             allThreads[threadId]->stopThread(memoryHandle);
+            invalidateCachedThreadSlot(threadId);
         }
     }
 
@@ -903,6 +926,7 @@ void DebugSessionImp::resumeAccidentallyStoppedThreads(const std::vector<EuThrea
                 ;
 
             allThreads[threadID]->resumeThread();
+            invalidateCachedThreadSlot(threadID);
         }
     }
 }
@@ -1304,9 +1328,90 @@ ze_result_t DebugSessionImp::readRegistersImp(EuThread::ThreadId threadId, uint3
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    if (isStateSaveAreaCacheEnabled()) {
+        return readRegistersFromCachedThreadSlot(threadId, regdesc, start, count, pRegisterValues);
+    }
     return registersAccessHelper(allThreads[threadId].get(), regdesc, start, count, pRegisterValues, false);
 }
 
+bool DebugSessionImp::isStateSaveAreaCacheEnabled() const {
+    return NEO::DebugManager.flags.EnableDebuggerStateSaveAreaCache.get() == 1;
+}
+
+// Reads slots of given threads into stateSaveArea buffer at their offsets,
+// slots of threads adjacent in state save area are read with a single call
+ze_result_t DebugSessionImp::readThreadSlots(uint64_t memoryHandle, uint64_t gpuVa, const std::vector<EuThread::ThreadId> &threads, char *stateSaveArea) {
+    const size_t slotSize = getStateSaveAreaHeader()->regHeader.state_save_size;
+    auto &counters = stateSaveAreaAccessCounters[static_cast<uint32_t>(StateSaveAreaAccess::resume)];
+
+    std::vector<size_t> slotOffsets;
+    slotOffsets.reserve(threads.size());
+    for (auto &threadId : threads) {
+        slotOffsets.push_back(calculateThreadSlotOffset(threadId));
+    }
+    std::sort(slotOffsets.begin(), slotOffsets.end());
+    slotOffsets.erase(std::unique(slotOffsets.begin(), slotOffsets.end()), slotOffsets.end());
+
+    size_t i = 0;
+    while (i < slotOffsets.size()) {
+        auto rangeStart = slotOffsets[i];
+        auto rangeEnd = rangeStart + slotSize;
+        for (i++; i < slotOffsets.size() && slotOffsets[i] == rangeEnd; i++) {
+            rangeEnd += slotSize;
+        }
+
+        auto result = readGpuMemory(memoryHandle, stateSaveArea + rangeStart, rangeEnd - rangeStart, gpuVa + rangeStart);
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+        counters.gpuReadsCount++;
+        counters.gpuReadBytes += rangeEnd - rangeStart;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t DebugSessionImp::readRegistersFromCachedThreadSlot(EuThread::ThreadId threadId, const SIP::regset_desc *regdesc, uint32_t start, uint32_t count, void *pRegisterValues) {
+    if (start >= regdesc->num || start + count > regdesc->num) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    const auto startTime = std::chrono::steady_clock::now();
+    auto &counters = stateSaveAreaAccessCounters[static_cast<uint32_t>(StateSaveAreaAccess::readRegisters)];
+
+    std::lock_guard<std::mutex> lock(threadSlotCacheMutex);
+    auto cachedSlot = threadSlotCache.find(threadId);
+    if (cachedSlot == threadSlotCache.end()) {
+        const auto thread = allThreads[threadId].get();
+        auto gpuVa = getContextStateSaveAreaGpuVa(thread->getMemoryHandle());
+        if (gpuVa == 0) {
+            return ZE_RESULT_ERROR_UNKNOWN;
+        }
+
+        std::vector<char> threadSlot(getStateSaveAreaHeader()->regHeader.state_save_size);
+        auto result = readGpuMemory(thread->getMemoryHandle(), threadSlot.data(), threadSlot.size(), gpuVa + calculateThreadSlotOffset(threadId));
+        if (result != ZE_RESULT_SUCCESS) {
+            return ZE_RESULT_ERROR_UNKNOWN;
+        }
+        counters.gpuReadsCount++;
+        counters.gpuReadBytes += threadSlot.size();
+        cachedSlot = threadSlotCache.emplace(threadId, std::move(threadSlot)).first;
+    } else {
+        counters.cacheHits++;
+    }
+
+    auto size = count * regdesc->bytes;
+    auto offset = calculateRegisterOffsetInThreadSlot(regdesc, start);
+    UNRECOVERABLE_IF(offset + size > cachedSlot->second.size());
+    memcpy_s(pRegisterValues, size, cachedSlot->second.data() + offset, size);
+
+    counters.totalTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+    return ZE_RESULT_SUCCESS;
+}
+
+void DebugSessionImp::invalidateCachedThreadSlot(EuThread::ThreadId threadId) {
+    std::lock_guard<std::mutex> lock(threadSlotCacheMutex);
+    threadSlotCache.erase(threadId);
+}
+
 ze_result_t DebugSessionImp::writeRegisters(ze_device_thread_t thread, uint32_t type, uint32_t start, uint32_t count, void *pRegisterValues) {
     if (!isSingleThread(thread)) {
         return ZE_RESULT_ERROR_NOT_AVAILABLE;
@@ -1335,6 +1440,7 @@ ze_result_t DebugSessionImp::writeRegistersImp(EuThread::ThreadId threadId, uint
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    invalidateCachedThreadSlot(threadId);
     return registersAccessHelper(allThreads[threadId].get(), regdesc, start, count, pRegisterValues, true);
 }
 
@@ -14,11 +14,14 @@
 
 #include "common/StateSaveAreaHeader.h"
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <cmath>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace SIP {
@@ -69,6 +72,23 @@ struct DebugSessionImp : DebugSession {
 
     using ApiEventQueue = std::queue<zet_debug_event_t>;
 
+    enum class StateSaveAreaAccess : uint32_t {
+        resume = 0,
+        readRegisters,
+        count
+    };
+
+    struct StateSaveAreaAccessCounters {
+        uint64_t gpuReadsCount = 0;
+        uint64_t gpuReadBytes = 0;
+        uint64_t cacheHits = 0;
+        uint64_t totalTimeUs = 0;
+    };
+
+    const StateSaveAreaAccessCounters &getStateSaveAreaAccessCounters(StateSaveAreaAccess access) const {
+        return stateSaveAreaAccessCounters[static_cast<uint32_t>(access)];
+    }
+
   protected:
     MOCKABLE_VIRTUAL ze_result_t readRegistersImp(EuThread::ThreadId thread, uint32_t type, uint32_t start, uint32_t count, void *pRegisterValues);
     MOCKABLE_VIRTUAL ze_result_t writeRegistersImp(EuThread::ThreadId thread, uint32_t type, uint32_t start, uint32_t count, void *pRegisterValues);
@@ -124,6 +144,11 @@ struct DebugSessionImp : DebugSession {
     size_t calculateThreadSlotOffset(EuThread::ThreadId threadId);
     size_t calculateRegisterOffsetInThreadSlot(const SIP::regset_desc *const regdesc, uint32_t start);
 
+    bool isStateSaveAreaCacheEnabled() const;
+    ze_result_t readThreadSlots(uint64_t memoryHandle, uint64_t gpuVa, const std::vector<EuThread::ThreadId> &threads, char *stateSaveArea);
+    ze_result_t readRegistersFromCachedThreadSlot(EuThread::ThreadId threadId, const SIP::regset_desc *regdesc, uint32_t start, uint32_t count, void *pRegisterValues);
+    void invalidateCachedThreadSlot(EuThread::ThreadId threadId);
+
     void newAttentionRaised(uint32_t deviceIndex) {
         if (expectedAttentionEvents > 0) {
             expectedAttentionEvents--;
@@ -158,6 +183,9 @@ struct DebugSessionImp : DebugSession {
     std::vector<std::pair<ze_device_thread_t, bool>> pendingInterrupts;
     std::vector<EuThread::ThreadId> newlyStoppedThreads;
     std::vector<char> stateSaveAreaHeader;
+    std::mutex threadSlotCacheMutex;
+    std::unordered_map<uint64_t, std::vector<char>> threadSlotCache;
+    std::array<StateSaveAreaAccessCounters, static_cast<uint32_t>(StateSaveAreaAccess::count)> stateSaveAreaAccessCounters = {};
     SIP::version minSlmSipVersion = {2, 1, 0};
     bool sipSupportsSlm = false;
 
@@ -247,6 +275,7 @@ ze_result_t DebugSessionImp::slmMemoryAccess(EuThread::ThreadId threadId, const
         }
 
         status = resumeImp(std::vector<EuThread::ThreadId>{threadId}, threadId.tileIndex);
+        invalidateCachedThreadSlot(threadId);
         if (status != ZE_RESULT_SUCCESS) {
             return status;
         }
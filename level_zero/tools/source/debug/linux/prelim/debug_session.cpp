@@ -1529,6 +1529,7 @@ void DebugSessionLinux::checkStoppedThreadsAndGenerateEvents(const std::vector<E
 
             if (allThreads[threadId]->verifyStopped(srMagic.count)) {
                 allThreads[threadId]->stopThread(memoryHandle);
+                invalidateCachedThreadSlot(threadId);
                 if (!wasStopped) {
                     stoppedThreadsToReport.push_back(threadId);
                 }
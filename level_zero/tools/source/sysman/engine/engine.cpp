@@ -46,14 +46,19 @@ void EngineHandleContext::init(std::vector<ze_device_handle_t> &deviceHandles) {
 }
 
 void EngineHandleContext::releaseEngines() {
+    pOsEngineGroup.reset();
     handleList.clear();
 }
 
-ze_result_t EngineHandleContext::engineGet(uint32_t *pCount, zes_engine_handle_t *phEngine) {
+void EngineHandleContext::initEngines() {
     std::call_once(initEngineOnce, [this]() {
         this->init(pOsSysman->getDeviceHandles());
         this->engineInitDone = true;
     });
+}
+
+ze_result_t EngineHandleContext::engineGet(uint32_t *pCount, zes_engine_handle_t *phEngine) {
+    initEngines();
     uint32_t handleListSize = static_cast<uint32_t>(handleList.size());
     uint32_t numToCopy = std::min(*pCount, handleListSize);
     if (0 == *pCount || *pCount > handleListSize) {
@@ -67,4 +72,27 @@ ze_result_t EngineHandleContext::engineGet(uint32_t *pCount, zes_engine_handle_t
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t EngineHandleContext::engineGetActivity(uint32_t *pCount, zes_engine_stats_t *pStats) {
+    initEngines();
+    uint32_t handleListSize = static_cast<uint32_t>(handleList.size());
+    uint32_t numToCopy = std::min(*pCount, handleListSize);
+    if (0 == *pCount || *pCount > handleListSize) {
+        *pCount = handleListSize;
+    }
+    if (nullptr == pStats || 0 == numToCopy) {
+        return ZE_RESULT_SUCCESS;
+    }
+    std::vector<OsEngine *> osEngines(numToCopy);
+    for (uint32_t i = 0; i < numToCopy; i++) {
+        osEngines[i] = static_cast<EngineImp *>(handleList[i].get())->pOsEngine.get();
+    }
+    {
+        std::lock_guard<std::mutex> lock(engineGroupMutex);
+        if (nullptr == pOsEngineGroup) {
+            pOsEngineGroup = OsEngineGroup::create(pOsSysman);
+        }
+    }
+    return pOsEngineGroup->getActivity(osEngines, pStats);
+}
+
 } // namespace L0
@@ -16,6 +16,7 @@
 namespace L0 {
 using EngineInstanceSubDeviceId = std::pair<uint32_t, uint32_t>;
 struct OsSysman;
+class OsEngineGroup;
 
 class Engine : _zes_engine_handle_t {
   public:
@@ -37,16 +38,20 @@ struct EngineHandleContext {
     void releaseEngines();
 
     ze_result_t engineGet(uint32_t *pCount, zes_engine_handle_t *phEngine);
+    ze_result_t engineGetActivity(uint32_t *pCount, zes_engine_stats_t *pStats);
 
     OsSysman *pOsSysman = nullptr;
     std::vector<std::unique_ptr<Engine>> handleList = {};
+    std::unique_ptr<OsEngineGroup> pOsEngineGroup;
     bool isEngineInitDone() {
         return engineInitDone;
     }
 
   private:
     void createHandle(zes_engine_group_t engineType, uint32_t engineInstance, uint32_t subDeviceId, ze_bool_t onSubdevice);
+    void initEngines();
     std::once_flag initEngineOnce;
+    std::mutex engineGroupMutex;
     bool engineInitDone = false;
 };
 
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include "level_zero/tools/source/sysman/engine/linux/os_engine_imp.h"
+#include "level_zero/tools/source/sysman/linux/os_sysman_imp.h"
+
+#include <linux/perf_event.h>
+
+namespace L0 {
+
+void LinuxEngineGroupImp::openGroup(const std::vector<uint64_t> &configs) {
+    closeGroup();
+    groupConfigs = configs;
+    for (const auto &config : configs) {
+        // First event becomes the group leader, all the others are opened as its followers
+        int groupLeaderFd = groupFds.empty() ? -1 : static_cast<int>(groupFds[0]);
+        auto fd = pPmuInterface->pmuInterfaceOpen(config, groupLeaderFd, PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_GROUP);
+        if (fd < 0) {
+            NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): failed to open event group, engines are read separately \n", __FUNCTION__);
+            closeGroup();
+            return;
+        }
+        groupFds.push_back(fd);
+    }
+}
+
+void LinuxEngineGroupImp::closeGroup() {
+    // Followers are closed before the group leader
+    for (auto fd = groupFds.rbegin(); fd != groupFds.rend(); fd++) {
+        close(static_cast<int>(*fd));
+    }
+    groupFds.clear();
+}
+
+ze_result_t LinuxEngineGroupImp::getActivity(const std::vector<OsEngine *> &osEngines, zes_engine_stats_t *pStats) {
+    std::vector<uint64_t> configs(osEngines.size());
+    for (size_t i = 0; i < osEngines.size(); i++) {
+        configs[i] = static_cast<LinuxEngineImp *>(osEngines[i])->getPmuConfig();
+    }
+    // group is shared by all threads querying activity of the device
+    std::lock_guard<std::mutex> lock(groupMutex);
+    if (configs != groupConfigs) {
+        openGroup(configs);
+    }
+
+    if (groupFds.empty()) {
+        for (size_t i = 0; i < osEngines.size(); i++) {
+            auto result = osEngines[i]->getActivity(&pStats[i]);
+            if (result != ZE_RESULT_SUCCESS) {
+                return result;
+            }
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    // In data[], first u64 is number of events, second u64 is "timestamp" and then "active time" of each event follows. All in nanoseconds
+    std::vector<uint64_t> data(groupFds.size() + 2, 0u);
+    auto ret = pPmuInterface->pmuRead(static_cast<int>(groupFds[0]), data.data(), data.size() * sizeof(uint64_t));
+    if (ret < 0 || data[0] != groupFds.size()) {
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():pmuRead is returning value:%d and error:0x%x \n", __FUNCTION__, ret, ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    for (size_t i = 0; i < groupFds.size(); i++) {
+        pStats[i].activeTime = data[i + 2] / microSecondsToNanoSeconds;
+        pStats[i].timestamp = data[1] / microSecondsToNanoSeconds;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+LinuxEngineGroupImp::LinuxEngineGroupImp(OsSysman *pOsSysman) {
+    LinuxSysmanImp *pLinuxSysmanImp = static_cast<LinuxSysmanImp *>(pOsSysman);
+    pPmuInterface = pLinuxSysmanImp->getPmuInterface();
+}
+
+LinuxEngineGroupImp::~LinuxEngineGroupImp() {
+    closeGroup();
+}
+
+std::unique_ptr<OsEngineGroup> OsEngineGroup::create(OsSysman *pOsSysman) {
+    return std::make_unique<LinuxEngineGroupImp>(pOsSysman);
+}
+
+} // namespace L0
@@ -76,7 +76,8 @@ ze_result_t LinuxEngineImp::getProperties(zes_engine_properties_t &properties) {
 void LinuxEngineImp::init() {
     auto i915EngineClass = engineToI915Map.find(engineGroup);
     // I915_PMU_ENGINE_BUSY macro provides the perf type config which we want to listen to get the engine busyness.
-    fd = pPmuInterface->pmuInterfaceOpen(I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance), -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    pmuConfig = I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance);
+    fd = pPmuInterface->pmuInterfaceOpen(pmuConfig, -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
 }
 
 bool LinuxEngineImp::isEngineModuleSupported() {
@@ -12,6 +12,7 @@
 #include "level_zero/tools/source/sysman/engine/os_engine.h"
 #include "level_zero/tools/source/sysman/sysman_const.h"
 
+#include <mutex>
 #include <unistd.h>
 
 namespace L0 {
@@ -23,6 +24,7 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
     ze_result_t getProperties(zes_engine_properties_t &properties) override;
     bool isEngineModuleSupported() override;
     static zes_engine_group_t getGroupFromEngineType(zes_engine_group_t type);
+    uint64_t getPmuConfig() const { return pmuConfig; }
     LinuxEngineImp() = default;
     LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance, uint32_t subDeviceId, ze_bool_t onSubDevice);
     ~LinuxEngineImp() override {
@@ -40,10 +42,27 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
     Device *pDevice = nullptr;
     uint32_t subDeviceId = 0;
     ze_bool_t onSubDevice = false;
+    uint64_t pmuConfig = UINT64_MAX;
 
   private:
     void init();
     int64_t fd = -1;
 };
 
+class LinuxEngineGroupImp : public OsEngineGroup, NEO::NonCopyableOrMovableClass {
+  public:
+    ze_result_t getActivity(const std::vector<OsEngine *> &osEngines, zes_engine_stats_t *pStats) override;
+    LinuxEngineGroupImp() = default;
+    LinuxEngineGroupImp(OsSysman *pOsSysman);
+    ~LinuxEngineGroupImp() override;
+
+  protected:
+    void openGroup(const std::vector<uint64_t> &configs);
+    void closeGroup();
+    PmuInterface *pPmuInterface = nullptr;
+    std::vector<uint64_t> groupConfigs = {};
+    std::vector<int64_t> groupFds = {};
+    std::mutex groupMutex;
+};
+
 } // namespace L0
@@ -115,6 +115,7 @@ void LinuxEngineImp::init() {
         config = I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance);
         break;
     }
+    pmuConfig = config;
     fd = pPmuInterface->pmuInterfaceOpen(config, -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
 }
 
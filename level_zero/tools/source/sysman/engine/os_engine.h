@@ -11,6 +11,7 @@
 #include <level_zero/zes_api.h>
 
 #include <set>
+#include <vector>
 
 namespace L0 {
 
@@ -27,4 +28,12 @@ class OsEngine {
     virtual ~OsEngine() = default;
 };
 
+// Samples activity of several engines of one device at once
+class OsEngineGroup {
+  public:
+    virtual ze_result_t getActivity(const std::vector<OsEngine *> &osEngines, zes_engine_stats_t *pStats) = 0;
+    static std::unique_ptr<OsEngineGroup> create(OsSysman *pOsSysman);
+    virtual ~OsEngineGroup() = default;
+};
+
 } // namespace L0
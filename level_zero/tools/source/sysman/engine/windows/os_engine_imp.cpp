@@ -106,4 +106,18 @@ ze_result_t OsEngine::getNumEngineTypeAndInstances(std::set<std::pair<zes_engine
     return status;
 }
 
+ze_result_t WddmEngineGroupImp::getActivity(const std::vector<OsEngine *> &osEngines, zes_engine_stats_t *pStats) {
+    for (size_t i = 0; i < osEngines.size(); i++) {
+        auto result = osEngines[i]->getActivity(&pStats[i]);
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+std::unique_ptr<OsEngineGroup> OsEngineGroup::create(OsSysman *pOsSysman) {
+    return std::make_unique<WddmEngineGroupImp>();
+}
+
 } // namespace L0
@@ -27,4 +27,12 @@ class WddmEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
     KmdSysManager *pKmdSysManager = nullptr;
     zes_engine_group_t engineGroup = ZES_ENGINE_GROUP_ALL;
 };
+
+class WddmEngineGroupImp : public OsEngineGroup, NEO::NonCopyableOrMovableClass {
+  public:
+    ze_result_t getActivity(const std::vector<OsEngine *> &osEngines, zes_engine_stats_t *pStats) override;
+
+    WddmEngineGroupImp() = default;
+    ~WddmEngineGroupImp() override = default;
+};
 } // namespace L0
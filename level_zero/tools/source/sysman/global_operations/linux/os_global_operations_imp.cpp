@@ -315,6 +315,109 @@ ze_result_t LinuxGlobalOperationsImp::reset(ze_bool_t force) {
     return pLinuxSysmanImp->initDevice();
 }
 
+ze_result_t LinuxGlobalOperationsImp::readClientPid(const std::string &clientId, uint64_t &pid) {
+    // realClientPidPath will be something like: clients/<clientId>/pid
+    std::string realClientPidPath = clientsDir + "/" + clientId + "/" + "pid";
+    ze_result_t result = pSysfsAccess->read(realClientPidPath, pid);
+
+    if (ZE_RESULT_SUCCESS != result) {
+        std::string bPidString;
+        result = pSysfsAccess->read(realClientPidPath, bPidString);
+        if (result == ZE_RESULT_SUCCESS) {
+            size_t start = bPidString.find("<");
+            size_t end = bPidString.find(">");
+            std::string bPid = bPidString.substr(start + 1, end - start - 1);
+            pid = std::stoull(bPid, nullptr, 10);
+        }
+    }
+    return result;
+}
+
+// Reads busy time of given engines of the client, engines which were used are removed from engineNums
+ze_result_t LinuxGlobalOperationsImp::readClientEnginesBusy(const std::string &clientId, std::vector<std::string> &engineNums, int64_t &engineType) {
+    std::string busyDirForEngines = clientsDir + "/" + clientId + "/" + "busy";
+    for (auto engineNum = engineNums.begin(); engineNum != engineNums.end();) {
+        uint64_t timeSpent = 0;
+        std::string engine = busyDirForEngines + "/" + *engineNum;
+        ze_result_t result = pSysfsAccess->read(engine, timeSpent);
+        if (ZE_RESULT_SUCCESS != result) {
+            if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
+                engineNum++;
+                continue;
+            } else {
+                return result;
+            }
+        }
+        if (timeSpent > 0) {
+            int i915EnginNumber = stoi(*engineNum);
+            auto i915MapToL0EngineType = engineMap.find(i915EnginNumber);
+            zes_engine_type_flags_t val = ZES_ENGINE_TYPE_FLAG_OTHER;
+            if (i915MapToL0EngineType != engineMap.end()) {
+                // Found a valid map
+                val = i915MapToL0EngineType->second;
+            }
+            // In this for loop we want to retrieve the overall engines used by process
+            engineType = engineType | val;
+            engineNum = engineNums.erase(engineNum);
+        } else {
+            engineNum++;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t LinuxGlobalOperationsImp::readClientMemory(const std::string &clientId, DrmClient &client) {
+    client.memSize = 0;
+    std::string realClientTotalMemoryPath = clientsDir + "/" + clientId + "/" + "total_device_memory_buffer_objects" + "/" + "created_bytes";
+    ze_result_t result = pSysfsAccess->read(realClientTotalMemoryPath, client.memSize);
+    if (ZE_RESULT_SUCCESS != result) {
+        if (ZE_RESULT_ERROR_NOT_AVAILABLE != result) {
+            NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read memory size from:%s and returning error:0x%x \n", __FUNCTION__, realClientTotalMemoryPath.c_str(), result);
+            return result;
+        }
+    }
+
+    client.sharedMemSize = 0;
+    std::string realClientTotalSharedMemoryPath = clientsDir + "/" + clientId + "/" + "total_device_memory_buffer_objects" + "/" + "imported_bytes";
+    result = pSysfsAccess->read(realClientTotalSharedMemoryPath, client.sharedMemSize);
+    if (ZE_RESULT_SUCCESS != result) {
+        if (ZE_RESULT_ERROR_NOT_AVAILABLE != result) {
+            NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read shared memory size from:%s and returning error:0x%x \n", __FUNCTION__, realClientTotalSharedMemoryPath.c_str(), result);
+            return result;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+// Reads all data of a client, which was not seen before
+ze_result_t LinuxGlobalOperationsImp::readClient(const std::string &clientId, DrmClient &client) {
+    ze_result_t result = readClientPid(clientId, client.pid);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // Traverse the clients/<clientId>/busy directory to get accelerator engines used by process
+    std::string busyDirForEngines = clientsDir + "/" + clientId + "/" + "busy";
+    result = pSysfsAccess->scanDirEntries(busyDirForEngines, client.idleEngineNums);
+    if (ZE_RESULT_SUCCESS != result) {
+        if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
+            // ZE_RESULT_ERROR_NOT_AVAILABLE is expected if the busy directory is absent for the client
+            // this condition(when encountered) must not prevent the information accumulated for other clientIds
+            client.engineType = ZES_ENGINE_TYPE_FLAG_OTHER; // When busy node is absent assign engine type with ZES_ENGINE_TYPE_FLAG_OTHER
+            client.idleEngineNums.clear();
+        } else {
+            return result;
+        }
+    }
+    // Scan all engine files present in /sys/class/drm/card0/clients/<ClientId>/busy and check
+    // whether that engine is used by process
+    result = readClientEnginesBusy(clientId, client.idleEngineNums, client.engineType);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+    return readClientMemory(clientId, client);
+}
+
 // Processes in the form of clients are present in sysfs like this:
 // # /sys/class/drm/card0/clients$ ls
 // 4  5
@@ -332,16 +435,10 @@ ze_result_t LinuxGlobalOperationsImp::reset(ze_bool_t force) {
 // accumulated nanoseconds each client spent on engines.
 // Thus we traverse each file in busy dir for non-zero time and if we find that file say 0,then we could say that
 // this engine 0 is used by process.
+// With SysmanDrmClientIndex, pid and used engines of each client are kept between queries, as they do not change
+// during client lifetime, so for known clients only memory sizes and busy time of not yet used engines are re-read.
 ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process_state_t> &pProcessList) {
     std::vector<std::string> clientIds;
-    struct DeviceMemStruct {
-        uint64_t deviceMemorySize;
-        uint64_t deviceSharedMemorySize;
-    };
-    struct EngineMemoryPairType {
-        int64_t engineTypeField;
-        DeviceMemStruct deviceMemStructField;
-    };
 
     ze_result_t result = pSysfsAccess->scanDirEntries(clientsDir, clientIds);
     if (ZE_RESULT_SUCCESS != result) {
@@ -349,23 +446,32 @@ ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    // Create a map with unique pid as key and engineType as value
-    std::map<uint64_t, EngineMemoryPairType> pidClientMap;
-    for (const auto &clientId : clientIds) {
-        // realClientPidPath will be something like: clients/<clientId>/pid
-        std::string realClientPidPath = clientsDir + "/" + clientId + "/" + "pid";
-        uint64_t pid;
-        result = pSysfsAccess->read(realClientPidPath, pid);
+    const auto drmClientIndexMode = NEO::DebugManager.flags.SysmanDrmClientIndex.get();
+    const bool useDrmClientIndex = drmClientIndexMode >= 1;
+    const auto refreshBudget = std::chrono::microseconds(drmClientIndexMode > 1 ? drmClientIndexMode : 0);
+    std::unique_lock<std::mutex> lock(drmClientIndexMutex);
+    const auto scanStart = std::chrono::steady_clock::now();
+    std::map<std::string, DrmClient> updatedDrmClientIndex;
 
-        if (ZE_RESULT_SUCCESS != result) {
-            std::string bPidString;
-            result = pSysfsAccess->read(realClientPidPath, bPidString);
-            if (result == ZE_RESULT_SUCCESS) {
-                size_t start = bPidString.find("<");
-                size_t end = bPidString.find(">");
-                std::string bPid = bPidString.substr(start + 1, end - start - 1);
-                pid = std::stoull(bPid, nullptr, 10);
+    // Create a map with unique pid as key and accumulated engines and memory of its clients as value
+    std::map<uint64_t, DrmClient> pidClientMap;
+    for (const auto &clientId : clientIds) {
+        DrmClient client = {};
+        auto indexEntry = useDrmClientIndex ? drmClientIndex.find(clientId) : drmClientIndex.end();
+        if (indexEntry != drmClientIndex.end()) {
+            client = indexEntry->second;
+            if (refreshBudget.count() > 0 && std::chrono::steady_clock::now() - scanStart > refreshBudget) {
+                scanStatistics.clientsReportedFromIndex++;
+            } else {
+                result = readClientEnginesBusy(clientId, client.idleEngineNums, client.engineType);
+                if (ZE_RESULT_SUCCESS == result) {
+                    result = readClientMemory(clientId, client);
+                }
+                scanStatistics.clientsRefreshed++;
             }
+        } else {
+            result = readClient(clientId, client);
+            scanStatistics.clientsRead++;
         }
 
         if (ZE_RESULT_SUCCESS != result) {
@@ -379,93 +485,39 @@ ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process
                 return result;
             }
         }
-        // Traverse the clients/<clientId>/busy directory to get accelerator engines used by process
-        std::vector<std::string> engineNums = {};
-        int64_t engineType = 0;
-        std::string busyDirForEngines = clientsDir + "/" + clientId + "/" + "busy";
-        result = pSysfsAccess->scanDirEntries(busyDirForEngines, engineNums);
-        if (ZE_RESULT_SUCCESS != result) {
-            if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
-                // update the result as Success as ZE_RESULT_ERROR_NOT_AVAILABLE is expected if the "realClientPidPath" folder is empty
-                // this condition(when encountered) must not prevent the information accumulated for other clientIds
-                // this situation occurs when there is no call modifying result,
-                // Here its seen when the last element of clientIds returns ZE_RESULT_ERROR_NOT_AVAILABLE for some reason.
-                engineType = ZES_ENGINE_TYPE_FLAG_OTHER; // When busy node is absent assign engine type with ZES_ENGINE_TYPE_FLAG_OTHER
-            } else {
-                return result;
-            }
-        }
-        // Scan all engine files present in /sys/class/drm/card0/clients/<ClientId>/busy and check
-        // whether that engine is used by process
-        for (const auto &engineNum : engineNums) {
-            uint64_t timeSpent = 0;
-            std::string engine = busyDirForEngines + "/" + engineNum;
-            result = pSysfsAccess->read(engine, timeSpent);
-            if (ZE_RESULT_SUCCESS != result) {
-                if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
-                    continue;
-                } else {
-                    return result;
-                }
-            }
-            if (timeSpent > 0) {
-                int i915EnginNumber = stoi(engineNum);
-                auto i915MapToL0EngineType = engineMap.find(i915EnginNumber);
-                zes_engine_type_flags_t val = ZES_ENGINE_TYPE_FLAG_OTHER;
-                if (i915MapToL0EngineType != engineMap.end()) {
-                    // Found a valid map
-                    val = i915MapToL0EngineType->second;
-                }
-                // In this for loop we want to retrieve the overall engines used by process
-                engineType = engineType | val;
-            }
+        if (useDrmClientIndex) {
+            updatedDrmClientIndex.emplace(clientId, client);
         }
 
-        uint64_t memSize = 0;
-        std::string realClientTotalMemoryPath = clientsDir + "/" + clientId + "/" + "total_device_memory_buffer_objects" + "/" + "created_bytes";
-        result = pSysfsAccess->read(realClientTotalMemoryPath, memSize);
-        if (ZE_RESULT_SUCCESS != result) {
-            if (ZE_RESULT_ERROR_NOT_AVAILABLE != result) {
-                NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read memory size from:%s and returning error:0x%x \n", __FUNCTION__, realClientTotalMemoryPath.c_str(), result);
-                return result;
-            }
-        }
-
-        uint64_t sharedMemSize = 0;
-        std::string realClientTotalSharedMemoryPath = clientsDir + "/" + clientId + "/" + "total_device_memory_buffer_objects" + "/" + "imported_bytes";
-        result = pSysfsAccess->read(realClientTotalSharedMemoryPath, sharedMemSize);
-        if (ZE_RESULT_SUCCESS != result) {
-            if (ZE_RESULT_ERROR_NOT_AVAILABLE != result) {
-                NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): Failed to read shared memory size from:%s and returning error:0x%x \n", __FUNCTION__, realClientTotalSharedMemoryPath.c_str(), result);
-                return result;
-            }
-        }
-        DeviceMemStruct totalDeviceMem = {memSize, sharedMemSize};
-        EngineMemoryPairType engineMemoryPair = {engineType, totalDeviceMem};
-        auto ret = pidClientMap.insert(std::make_pair(pid, engineMemoryPair));
+        auto ret = pidClientMap.insert(std::make_pair(client.pid, client));
         if (ret.second == false) {
             // insertion failed as entry with same pid already exists in map
-            // Now update the EngineMemoryPairType field for the existing pid entry
-            EngineMemoryPairType updateEngineMemoryPair;
-            auto pidEntryFromMap = pidClientMap.find(pid);
-            auto existingEngineType = pidEntryFromMap->second.engineTypeField;
-            auto existingdeviceMemorySize = pidEntryFromMap->second.deviceMemStructField.deviceMemorySize;
-            auto existingdeviceSharedMemorySize = pidEntryFromMap->second.deviceMemStructField.deviceSharedMemorySize;
-            updateEngineMemoryPair.engineTypeField = existingEngineType | engineMemoryPair.engineTypeField;
-            updateEngineMemoryPair.deviceMemStructField.deviceMemorySize = existingdeviceMemorySize + engineMemoryPair.deviceMemStructField.deviceMemorySize;
-            updateEngineMemoryPair.deviceMemStructField.deviceSharedMemorySize = existingdeviceSharedMemorySize + engineMemoryPair.deviceMemStructField.deviceSharedMemorySize;
-            pidClientMap[pid] = updateEngineMemoryPair;
+            // Now update the engines and memory sizes of the existing pid entry
+            auto &pidEntry = ret.first->second;
+            pidEntry.engineType |= client.engineType;
+            pidEntry.memSize += client.memSize;
+            pidEntry.sharedMemSize += client.sharedMemSize;
         }
-        result = ZE_RESULT_SUCCESS;
     }
+    // Clients, which are not listed anymore, are dropped from the index
+    drmClientIndex = std::move(updatedDrmClientIndex);
+
+    auto scanDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - scanStart).count();
+    scanStatistics.scansCount++;
+    scanStatistics.lastScanDurationUs = static_cast<uint64_t>(scanDuration);
+    scanStatistics.maxScanDurationUs = std::max(scanStatistics.maxScanDurationUs, scanStatistics.lastScanDurationUs);
+    NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "%s(): scanned %zu clients in %llu us, clients read: %llu, refreshed: %llu, reported from index: %llu \n", __FUNCTION__, clientIds.size(),
+                          static_cast<unsigned long long>(scanStatistics.lastScanDurationUs), static_cast<unsigned long long>(scanStatistics.clientsRead),
+                          static_cast<unsigned long long>(scanStatistics.clientsRefreshed), static_cast<unsigned long long>(scanStatistics.clientsReportedFromIndex));
+    lock.unlock();
 
     // iterate through all elements of pidClientMap
     for (auto itr = pidClientMap.begin(); itr != pidClientMap.end(); ++itr) {
         zes_process_state_t process;
         process.processId = static_cast<uint32_t>(itr->first);
-        process.memSize = itr->second.deviceMemStructField.deviceMemorySize;
-        process.sharedSize = itr->second.deviceMemStructField.deviceSharedMemorySize;
-        process.engines = static_cast<uint32_t>(itr->second.engineTypeField);
+        process.memSize = itr->second.memSize;
+        process.sharedSize = itr->second.sharedMemSize;
+        process.engines = static_cast<uint32_t>(itr->second.engineType);
         pProcessList.push_back(process);
     }
     return result;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,12 +11,24 @@
 #include "level_zero/tools/source/sysman/global_operations/os_global_operations.h"
 #include "level_zero/tools/source/sysman/linux/os_sysman_imp.h"
 
+#include <map>
+#include <mutex>
+
 namespace L0 {
 class SysfsAccess;
 struct Device;
 
 class LinuxGlobalOperationsImp : public OsGlobalOperations, NEO::NonCopyableOrMovableClass {
   public:
+    struct ProcessesStateScanStatistics {
+        uint64_t scansCount = 0u;
+        uint64_t clientsRead = 0u;
+        uint64_t clientsRefreshed = 0u;
+        uint64_t clientsReportedFromIndex = 0u;
+        uint64_t lastScanDurationUs = 0u;
+        uint64_t maxScanDurationUs = 0u;
+    };
+
     bool getSerialNumber(char (&serialNumber)[ZES_STRING_PROPERTY_SIZE]) override;
     bool getBoardNumber(char (&boardNumber)[ZES_STRING_PROPERTY_SIZE]) override;
     void getBrandName(char (&brandName)[ZES_STRING_PROPERTY_SIZE]) override;
@@ -29,6 +41,10 @@ class LinuxGlobalOperationsImp : public OsGlobalOperations, NEO::NonCopyableOrMo
     ze_result_t reset(ze_bool_t force) override;
     ze_result_t scanProcessesState(std::vector<zes_process_state_t> &pProcessList) override;
     ze_result_t deviceGetState(zes_device_state_t *pState) override;
+    ProcessesStateScanStatistics getProcessesStateScanStatistics() {
+        std::lock_guard<std::mutex> lock(drmClientIndexMutex);
+        return scanStatistics;
+    }
     LinuxGlobalOperationsImp() = default;
     LinuxGlobalOperationsImp(OsSysman *pOsSysman);
     ~LinuxGlobalOperationsImp() override = default;
@@ -45,6 +61,21 @@ class LinuxGlobalOperationsImp : public OsGlobalOperations, NEO::NonCopyableOrMo
     ze_result_t initDevice();
     void reInitSysmanDeviceResources();
 
+    struct DrmClient {
+        uint64_t pid = 0u;
+        int64_t engineType = 0;
+        std::vector<std::string> idleEngineNums; // busy entries without accumulated time, re-read until engine gets used
+        uint64_t memSize = 0u;
+        uint64_t sharedMemSize = 0u;
+    };
+    ze_result_t readClient(const std::string &clientId, DrmClient &client);
+    ze_result_t readClientPid(const std::string &clientId, uint64_t &pid);
+    ze_result_t readClientEnginesBusy(const std::string &clientId, std::vector<std::string> &engineNums, int64_t &engineType);
+    ze_result_t readClientMemory(const std::string &clientId, DrmClient &client);
+    std::mutex drmClientIndexMutex; // guards drmClientIndex and scanStatistics, processes can be scanned from multiple threads
+    std::map<std::string, DrmClient> drmClientIndex;
+    ProcessesStateScanStatistics scanStatistics;
+
   private:
     static const std::string deviceDir;
     static const std::string subsystemVendorFile;
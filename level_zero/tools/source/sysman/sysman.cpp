@@ -187,6 +187,14 @@ ze_result_t SysmanDevice::engineGet(zes_device_handle_t hDevice, uint32_t *pCoun
     return pSysmanDevice->engineGet(pCount, phEngine);
 }
 
+ze_result_t SysmanDevice::engineGetActivity(zes_device_handle_t hDevice, uint32_t *pCount, zes_engine_stats_t *pStats) {
+    auto pSysmanDevice = L0::SysmanDevice::fromHandle(hDevice);
+    if (pSysmanDevice == nullptr) {
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+    return pSysmanDevice->engineGetActivity(pCount, pStats);
+}
+
 ze_result_t SysmanDevice::pciGetProperties(zes_device_handle_t hDevice, zes_pci_properties_t *pProperties) {
     auto pSysmanDevice = L0::SysmanDevice::fromHandle(hDevice);
     if (pSysmanDevice == nullptr) {
@@ -44,6 +44,7 @@ struct SysmanDevice : _ze_device_handle_t {
     static ze_result_t deviceReset(zes_device_handle_t hDevice, ze_bool_t force);
     static ze_result_t deviceGetState(zes_device_handle_t hDevice, zes_device_state_t *pState);
     static ze_result_t engineGet(zes_device_handle_t hDevice, uint32_t *pCount, zes_engine_handle_t *phEngine);
+    static ze_result_t engineGetActivity(zes_device_handle_t hDevice, uint32_t *pCount, zes_engine_stats_t *pStats);
     static ze_result_t pciGetProperties(zes_device_handle_t hDevice, zes_pci_properties_t *pProperties);
     static ze_result_t pciGetState(zes_device_handle_t hDevice, zes_pci_state_t *pState);
     static ze_result_t pciGetBars(zes_device_handle_t hDevice, uint32_t *pCount, zes_pci_bar_properties_t *pProperties);
@@ -73,6 +74,7 @@ struct SysmanDevice : _ze_device_handle_t {
     virtual ze_result_t deviceReset(ze_bool_t force) = 0;
     virtual ze_result_t deviceGetState(zes_device_state_t *pState) = 0;
     virtual ze_result_t engineGet(uint32_t *pCount, zes_engine_handle_t *phEngine) = 0;
+    virtual ze_result_t engineGetActivity(uint32_t *pCount, zes_engine_stats_t *pStats) = 0;
     virtual ze_result_t pciGetProperties(zes_pci_properties_t *pProperties) = 0;
     virtual ze_result_t pciGetState(zes_pci_state_t *pState) = 0;
     virtual ze_result_t pciGetBars(uint32_t *pCount, zes_pci_bar_properties_t *pProperties) = 0;
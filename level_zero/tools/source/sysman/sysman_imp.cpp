@@ -172,6 +172,10 @@ ze_result_t SysmanDeviceImp::engineGet(uint32_t *pCount, zes_engine_handle_t *ph
     return pEngineHandleContext->engineGet(pCount, phEngine);
 }
 
+ze_result_t SysmanDeviceImp::engineGetActivity(uint32_t *pCount, zes_engine_stats_t *pStats) {
+    return pEngineHandleContext->engineGetActivity(pCount, pStats);
+}
+
 ze_result_t SysmanDeviceImp::standbyGet(uint32_t *pCount, zes_standby_handle_t *phStandby) {
     return pStandbyHandleContext->standbyGet(pCount, phStandby);
 }
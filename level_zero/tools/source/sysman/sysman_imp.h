@@ -57,6 +57,7 @@ struct SysmanDeviceImp : SysmanDevice, NEO::NonCopyableOrMovableClass {
     ze_result_t deviceReset(ze_bool_t force) override;
     ze_result_t deviceGetState(zes_device_state_t *pState) override;
     ze_result_t engineGet(uint32_t *pCount, zes_engine_handle_t *phEngine) override;
+    ze_result_t engineGetActivity(uint32_t *pCount, zes_engine_stats_t *pStats) override;
     ze_result_t pciGetProperties(zes_pci_properties_t *pProperties) override;
     ze_result_t pciGetState(zes_pci_state_t *pState) override;
     ze_result_t pciGetBars(uint32_t *pCount, zes_pci_bar_properties_t *pProperties) override;
@@ -980,6 +980,62 @@ TEST(DebugSessionTest, givenMultipleStoppedThreadsWhenResumeAllCalledThenStateSa
     EXPECT_EQ(threadCount, sessionMock->checkThreadIsResumedCalled);
 }
 
+TEST(DebugSessionTest, givenStateSaveAreaCacheEnabledAndMultipleStoppedThreadsWhenResumeAllCalledThenOnlyAdjacentSlotsOfStoppedThreadsAreReadWithSingleCall) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDebuggerStateSaveAreaCache.set(1);
+
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+    auto hwInfo = *NEO::defaultHwInfo.get();
+    hwInfo.gtSystemInfo.EUCount = 8;
+    hwInfo.gtSystemInfo.ThreadCount = 8 * hwInfo.gtSystemInfo.EUCount;
+
+    NEO::MockDevice *neoDevice(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    Mock<L0::DeviceImp> deviceImp(neoDevice, neoDevice->getExecutionEnvironment());
+
+    auto sessionMock = std::make_unique<MockDebugSession>(config, &deviceImp);
+    auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(sessionMock->stateSaveAreaHeader.data());
+    auto stateSaveSize = pStateSaveAreaHeader->regHeader.state_save_size;
+    auto size = pStateSaveAreaHeader->versionHeader.size * 8 +
+                pStateSaveAreaHeader->regHeader.state_area_offset +
+                stateSaveSize * 16;
+    sessionMock->stateSaveAreaHeader.resize(size);
+
+    auto threadCount = hwInfo.gtSystemInfo.ThreadCount / hwInfo.gtSystemInfo.EUCount;
+    for (uint32_t i = 0; i < threadCount; i++) {
+        EuThread::ThreadId thread(0, 0, 0, 0, i);
+        sessionMock->allThreads[thread]->stopThread(1u);
+        sessionMock->allThreads[thread]->reportAsStopped();
+    }
+
+    ze_device_thread_t threadAll = {UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX};
+    auto result = sessionMock->resume(threadAll);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(threadCount, sessionMock->checkThreadIsResumedFromPassedSaveAreaCalled);
+
+    const auto &counters = sessionMock->getStateSaveAreaAccessCounters(DebugSessionImp::StateSaveAreaAccess::resume);
+    EXPECT_EQ(1u, counters.gpuReadsCount);
+    EXPECT_EQ(static_cast<uint64_t>(threadCount) * stateSaveSize, counters.gpuReadBytes);
+
+    for (uint32_t i = 0; i < threadCount; i++) {
+        EuThread::ThreadId thread(0, 0, 0, 0, i);
+        EXPECT_TRUE(sessionMock->allThreads[thread]->isRunning());
+    }
+
+    // Threads not adjacent in state save area are read separately
+    for (uint32_t i = 0; i < threadCount; i += 2) {
+        EuThread::ThreadId thread(0, 0, 0, 0, i);
+        sessionMock->allThreads[thread]->stopThread(1u);
+        sessionMock->allThreads[thread]->reportAsStopped();
+    }
+    result = sessionMock->resume(threadAll);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u + threadCount / 2, counters.gpuReadsCount);
+    EXPECT_EQ(static_cast<uint64_t>(threadCount + threadCount / 2) * stateSaveSize, counters.gpuReadBytes);
+}
+
 TEST(DebugSessionTest, givenMultipleStoppedThreadsWhenResumeAllCalledThenStateSaveAreaIsReadUntilThreadsConfirmedToBeResumed) {
 
     class InternalMockDebugSession : public MockDebugSession {
@@ -2428,6 +2484,55 @@ TEST_F(DebugSessionRegistersAccessTest, givenReadGpuMemoryErrorWhenRegistersAcce
     EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, ret);
 }
 
+TEST_F(DebugSessionRegistersAccessTest, givenStateSaveAreaCacheEnabledWhenReadingRegistersOfStoppedThreadRepeatedlyThenThreadSlotIsReadOnceUntilRegistersAreWritten) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDebuggerStateSaveAreaCache.set(1);
+
+    {
+        auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data());
+        auto size = pStateSaveAreaHeader->versionHeader.size * 8 +
+                    pStateSaveAreaHeader->regHeader.state_area_offset +
+                    pStateSaveAreaHeader->regHeader.state_save_size * 16;
+        session->stateSaveAreaHeader.resize(size);
+    }
+    session->areRequestedThreadsStoppedReturnValue = 1;
+
+    auto grfSize = session->getRegisterSize(ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU);
+    std::vector<uint8_t> grf(grfSize, 0xab);
+    std::vector<uint8_t> grfRead(grfSize, 0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetDebugWriteRegisters(session->toHandle(), stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grf.data()));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetDebugReadRegisters(session->toHandle(), stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grfRead.data()));
+    EXPECT_EQ(grf, grfRead);
+    std::fill(grfRead.begin(), grfRead.end(), 0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetDebugReadRegisters(session->toHandle(), stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grfRead.data()));
+    EXPECT_EQ(grf, grfRead);
+
+    const auto &counters = session->getStateSaveAreaAccessCounters(DebugSessionImp::StateSaveAreaAccess::readRegisters);
+    EXPECT_EQ(1u, counters.gpuReadsCount);
+    EXPECT_EQ(1u, counters.cacheHits);
+
+    std::fill(grf.begin(), grf.end(), 0xcd);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetDebugWriteRegisters(session->toHandle(), stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grf.data()));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetDebugReadRegisters(session->toHandle(), stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grfRead.data()));
+    EXPECT_EQ(grf, grfRead);
+    EXPECT_EQ(2u, counters.gpuReadsCount);
+}
+
+TEST_F(DebugSessionRegistersAccessTest, givenStateSaveAreaCacheEnabledAndReadGpuMemoryErrorWhenReadingRegistersThenErrorUnknownIsReturnedAndNothingIsCached) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDebuggerStateSaveAreaCache.set(1);
+    session->areRequestedThreadsStoppedReturnValue = 1;
+
+    uint8_t grf[64] = {};
+    session->readMemoryResult = ZE_RESULT_ERROR_UNKNOWN;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, zetDebugReadRegisters(session->toHandle(), stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grf));
+
+    session->returnStateSaveAreaGpuVa = false;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, zetDebugReadRegisters(session->toHandle(), stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grf));
+    EXPECT_EQ(0u, session->getStateSaveAreaAccessCounters(DebugSessionImp::StateSaveAreaAccess::readRegisters).cacheHits);
+}
+
 TEST_F(DebugSessionRegistersAccessTest, givenNoStateSaveAreaWhenReadRegisterCalledThenErrorUnknownReturned) {
     session->stateSaveAreaHeader.clear();
 
@@ -2752,6 +2857,35 @@ TEST_F(DebugSessionRegistersAccessTest, GivenBindlessSipWhenCheckingDifferentSip
     EXPECT_EQ(session->sipSupportsSlm, true);
 }
 
+TEST(DebugSessionTest, GivenCachedThreadSlotWhenAccessingSlmThenCachedThreadSlotIsInvalidated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDebuggerStateSaveAreaCache.set(1);
+
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+    auto hwInfo = *NEO::defaultHwInfo.get();
+
+    NEO::MockDevice *neoDevice(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    Mock<L0::DeviceImp> deviceImp(neoDevice, neoDevice->getExecutionEnvironment());
+
+    auto sessionMock = std::make_unique<MockDebugSession>(config, &deviceImp);
+
+    EuThread::ThreadId threadId(0, 0, 0, 0, 0);
+    sessionMock->allThreads[threadId]->stopThread(1u);
+    sessionMock->threadSlotCache[threadId] = std::vector<char>(64, 0);
+
+    zet_debug_memory_space_desc_t desc;
+    desc.address = 0x10000000;
+    desc.type = ZET_DEBUG_MEMORY_SPACE_TYPE_SLM;
+    char output[16] = {};
+
+    sessionMock->slmTesting = true;
+    sessionMock->sipSupportsSlm = true;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sessionMock->slmMemoryAccess<void *, false>(threadId, &desc, sizeof(output), output));
+    EXPECT_EQ(0u, sessionMock->threadSlotCache.count(threadId));
+}
+
 TEST(DebugSessionTest, GivenStoppedThreadWhenValidAddressesSizesAndOffsetsThenSlmReadIsSuccessful) {
 
     zet_debug_config_t config = {};
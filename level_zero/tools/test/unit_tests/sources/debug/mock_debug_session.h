@@ -174,6 +174,7 @@ struct MockDebugSession : public L0::DebugSessionImp {
     using L0::DebugSessionImp::sipSupportsSlm;
     using L0::DebugSessionImp::slmMemoryAccess;
     using L0::DebugSessionImp::slmSipVersionCheck;
+    using L0::DebugSessionImp::threadSlotCache;
     using L0::DebugSessionImp::tileAttachEnabled;
     using L0::DebugSessionImp::tileSessions;
 
@@ -65,20 +65,37 @@ struct MockEnginePmuInterfaceImp : public PmuInterfaceImp {
     MockEnginePmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp) : PmuInterfaceImp(pLinuxSysmanImp) {}
 
     int64_t mockPerfEventFailureReturnValue = 0;
+    uint32_t groupedPerfEventOpenCalled = 0u;
     int64_t perfEventOpen(perf_event_attr *attr, pid_t pid, int cpu, int groupFd, uint64_t flags) override {
         if (mockPerfEventFailureReturnValue == -1) {
             return mockPerfEventFailureReturnValue;
         }
+        if (attr->read_format & PERF_FORMAT_GROUP || groupFd >= 0) {
+            groupedPerfEventOpenCalled++;
+        }
 
         return mockPmuFd;
     }
 
     int mockPmuReadFailureReturnValue = 0;
+    uint32_t groupedPmuReadCalled = 0u;
     int pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) override {
         if (mockPmuReadFailureReturnValue == -1) {
             return mockPmuReadFailureReturnValue;
         }
 
+        auto dataCount = sizeOfdata / sizeof(uint64_t);
+        if (dataCount > 2) {
+            // Group read format: number of events, time enabled and value of each event
+            groupedPmuReadCalled++;
+            data[0] = dataCount - 2;
+            data[1] = mockTimestamp;
+            for (size_t i = 2; i < dataCount; i++) {
+                data[i] = mockActiveTime;
+            }
+            return 0;
+        }
+
         data[0] = mockActiveTime;
         data[1] = mockTimestamp;
         return 0;
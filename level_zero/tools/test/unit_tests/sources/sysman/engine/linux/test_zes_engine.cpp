@@ -7,10 +7,14 @@
 
 #include "shared/source/os_interface/linux/memory_info.h"
 
+#include "level_zero/api/driver_experimental/public/zex_sysman_engine.h"
 #include "level_zero/tools/test/unit_tests/sources/sysman/linux/mock_sysman_fixture.h"
 
 #include "mock_engine.h"
 
+#include <atomic>
+#include <thread>
+
 extern bool sysmanUltsEnable;
 
 class OsEngine;
@@ -205,6 +209,87 @@ TEST_F(ZesEngineFixture, GivenValidEngineHandleWhenCallingZesEngineGetActivityAn
     EXPECT_EQ(-1, pPmuInterface->pmuInterfaceOpen(0, -1, 0));
 }
 
+TEST_F(ZesEngineFixture, GivenValidDeviceWhenCallingZexSysmanDeviceGetEngineActivityThenStatsOfAllEnginesAreReturnedFromSingleGroupedRead) {
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexSysmanDeviceGetEngineActivity(device->toHandle(), &count, nullptr));
+    EXPECT_EQ(handleComponentCount, count);
+    EXPECT_EQ(0u, pPmuInterface->groupedPerfEventOpenCalled);
+
+    std::vector<zes_engine_stats_t> stats(count);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexSysmanDeviceGetEngineActivity(device->toHandle(), &count, stats.data()));
+    EXPECT_EQ(handleComponentCount, pPmuInterface->groupedPerfEventOpenCalled);
+    EXPECT_EQ(1u, pPmuInterface->groupedPmuReadCalled);
+    for (const auto &engineStats : stats) {
+        EXPECT_EQ(mockActiveTime / microSecondsToNanoSeconds, engineStats.activeTime);
+        EXPECT_EQ(mockTimestamp / microSecondsToNanoSeconds, engineStats.timestamp);
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexSysmanDeviceGetEngineActivity(device->toHandle(), &count, stats.data()));
+    EXPECT_EQ(handleComponentCount, pPmuInterface->groupedPerfEventOpenCalled);
+    EXPECT_EQ(2u, pPmuInterface->groupedPmuReadCalled);
+}
+
+TEST_F(ZesEngineFixture, GivenMultipleThreadsWhenCallingZexSysmanDeviceGetEngineActivityThenEventGroupIsOpenedOnce) {
+    constexpr uint32_t numThreads = 4u;
+    constexpr uint32_t numIterations = 10u;
+    std::vector<std::thread> threads;
+    std::atomic<uint32_t> failures{0u};
+    for (uint32_t threadId = 0; threadId < numThreads; threadId++) {
+        threads.emplace_back([&]() {
+            uint32_t count = handleComponentCount;
+            std::vector<zes_engine_stats_t> stats(count);
+            for (uint32_t i = 0; i < numIterations; i++) {
+                if (ZE_RESULT_SUCCESS != L0::zexSysmanDeviceGetEngineActivity(device->toHandle(), &count, stats.data())) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, failures.load());
+    EXPECT_EQ(handleComponentCount, pPmuInterface->groupedPerfEventOpenCalled);
+    EXPECT_EQ(numThreads * numIterations, pPmuInterface->groupedPmuReadCalled);
+}
+
+TEST_F(ZesEngineFixture, GivenFewerStatsRequestedWhenCallingZexSysmanDeviceGetEngineActivityThenGroupIsReopenedForRequestedEnginesOnly) {
+    uint32_t count = handleComponentCount;
+    std::vector<zes_engine_stats_t> stats(count);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexSysmanDeviceGetEngineActivity(device->toHandle(), &count, stats.data()));
+    EXPECT_EQ(handleComponentCount, pPmuInterface->groupedPerfEventOpenCalled);
+
+    count = 2u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexSysmanDeviceGetEngineActivity(device->toHandle(), &count, stats.data()));
+    EXPECT_EQ(2u, count);
+    EXPECT_EQ(handleComponentCount + 2u, pPmuInterface->groupedPerfEventOpenCalled);
+    EXPECT_EQ(2u, pPmuInterface->groupedPmuReadCalled);
+}
+
+TEST_F(ZesEngineFixture, GivenEventGroupCannotBeOpenedWhenCallingZexSysmanDeviceGetEngineActivityThenEachEngineIsReadSeparately) {
+    uint32_t count = handleComponentCount;
+    std::vector<zes_engine_stats_t> stats(count);
+    pPmuInterface->mockPerfEventFailureReturnValue = -1;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexSysmanDeviceGetEngineActivity(device->toHandle(), &count, stats.data()));
+    EXPECT_EQ(0u, pPmuInterface->groupedPmuReadCalled);
+    for (const auto &engineStats : stats) {
+        EXPECT_EQ(mockActiveTime / microSecondsToNanoSeconds, engineStats.activeTime);
+        EXPECT_EQ(mockTimestamp / microSecondsToNanoSeconds, engineStats.timestamp);
+    }
+
+    pPmuInterface->mockPmuReadFailureReturnValue = -1;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, L0::zexSysmanDeviceGetEngineActivity(device->toHandle(), &count, stats.data()));
+}
+
+TEST_F(ZesEngineFixture, GivenGroupedPmuReadFailsWhenCallingZexSysmanDeviceGetEngineActivityThenErrorIsReturned) {
+    uint32_t count = handleComponentCount;
+    std::vector<zes_engine_stats_t> stats(count);
+    pPmuInterface->mockPmuReadFailureReturnValue = -1;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, L0::zexSysmanDeviceGetEngineActivity(device->toHandle(), &count, stats.data()));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, L0::zexSysmanDeviceGetEngineActivity(device->toHandle(), nullptr, stats.data()));
+}
+
 TEST_F(ZesEngineFixture, GivenValidOsSysmanPointerWhenRetrievingEngineTypeAndInstancesAndIfEngineInfoQueryFailsThenErrorIsReturned) {
     std::set<std::pair<zes_engine_group_t, EngineInstanceSubDeviceId>> engineGroupInstance;
     pDrm->mockSysmanQueryEngineInfoReturnFalse = false;
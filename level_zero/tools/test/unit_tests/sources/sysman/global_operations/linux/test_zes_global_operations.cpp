@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
 #include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
 
@@ -12,6 +13,9 @@
 
 #include "mock_global_operations.h"
 
+#include <atomic>
+#include <thread>
+
 extern bool sysmanUltsEnable;
 
 namespace L0 {
@@ -637,6 +641,99 @@ TEST_F(SysmanGlobalOperationsFixture, GivenValidDeviceHandleWhileRetrievingInfor
     EXPECT_EQ(processes[4].sharedSize, sharedMemSize7);
 }
 
+TEST_F(SysmanGlobalOperationsFixture, GivenDrmClientIndexEnabledWhileRetrievingInformationAboutHostProcessesRepeatedlyThenKnownClientsAreRefreshedAndSameStatesAreReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SysmanDrmClientIndex.set(1);
+
+    uint32_t count = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    EXPECT_EQ(count, totalProcessStates);
+    auto pLinuxGlobalOperationsImp = static_cast<LinuxGlobalOperationsImp *>(pGlobalOperationsImp->pOsGlobalOperations);
+    auto statistics = pLinuxGlobalOperationsImp->getProcessesStateScanStatistics();
+    EXPECT_EQ(1u, statistics.scansCount);
+    EXPECT_EQ(0u, statistics.clientsRefreshed);
+    auto clientsCount = statistics.clientsRead;
+
+    std::vector<zes_process_state_t> processes(count);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, processes.data()));
+    statistics = pLinuxGlobalOperationsImp->getProcessesStateScanStatistics();
+    EXPECT_EQ(2u, statistics.scansCount);
+    EXPECT_LT(0u, statistics.clientsRefreshed);
+    EXPECT_EQ(2 * clientsCount, statistics.clientsRead + statistics.clientsRefreshed);
+    EXPECT_EQ(0u, statistics.clientsReportedFromIndex);
+    EXPECT_GE(statistics.maxScanDurationUs, statistics.lastScanDurationUs);
+
+    EXPECT_EQ(processes[0].processId, pid1);
+    EXPECT_EQ(processes[0].engines, engines1);
+    EXPECT_EQ(processes[0].memSize, memSize1);
+    EXPECT_EQ(processes[0].sharedSize, sharedMemSize1);
+    EXPECT_EQ(processes[1].processId, pid2);
+    EXPECT_EQ(processes[1].engines, engines2);
+    EXPECT_EQ(processes[1].memSize, memSize2);
+    EXPECT_EQ(processes[1].sharedSize, sharedMemSize2);
+    EXPECT_EQ(processes[2].processId, pid4);
+    EXPECT_EQ(processes[2].engines, engines4);
+    EXPECT_EQ(processes[2].memSize, memSize4);
+    EXPECT_EQ(processes[2].sharedSize, sharedMemSize4);
+    EXPECT_EQ(processes[3].processId, pid6);
+    EXPECT_EQ(processes[3].engines, engines6);
+    EXPECT_EQ(processes[3].memSize, memSize6);
+    EXPECT_EQ(processes[3].sharedSize, sharedMemSize6);
+    EXPECT_EQ(processes[4].processId, pid7);
+    EXPECT_EQ(processes[4].engines, engines7);
+    EXPECT_EQ(processes[4].memSize, memSize7);
+    EXPECT_EQ(processes[4].sharedSize, sharedMemSize7);
+}
+
+TEST_F(SysmanGlobalOperationsFixture, GivenDrmClientIndexWithRefreshBudgetWhileRetrievingInformationAboutHostProcessesThenEachKnownClientIsRefreshedOrReportedFromIndex) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SysmanDrmClientIndex.set(2);
+
+    uint32_t count = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    auto pLinuxGlobalOperationsImp = static_cast<LinuxGlobalOperationsImp *>(pGlobalOperationsImp->pOsGlobalOperations);
+    auto statistics = pLinuxGlobalOperationsImp->getProcessesStateScanStatistics();
+    auto clientsCount = statistics.clientsRead;
+
+    std::vector<zes_process_state_t> processes(count);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, processes.data()));
+    statistics = pLinuxGlobalOperationsImp->getProcessesStateScanStatistics();
+    EXPECT_EQ(totalProcessStates, count);
+    EXPECT_EQ(2 * clientsCount, statistics.clientsRead + statistics.clientsRefreshed + statistics.clientsReportedFromIndex);
+    EXPECT_EQ(processes[0].processId, pid1);
+    EXPECT_EQ(processes[0].engines, engines1);
+    EXPECT_EQ(processes[0].memSize, memSize1);
+}
+
+TEST_F(SysmanGlobalOperationsFixture, GivenDrmClientIndexEnabledWhenRetrievingInformationAboutHostProcessesFromMultipleThreadsThenEveryScanIsCountedAndStatesAreCorrect) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SysmanDrmClientIndex.set(1);
+    constexpr uint32_t numThreads = 4u;
+    constexpr uint32_t numIterations = 10u;
+    std::vector<std::thread> threads;
+    std::atomic<uint32_t> failures{0u};
+    for (uint32_t threadId = 0; threadId < numThreads; threadId++) {
+        threads.emplace_back([&]() {
+            for (uint32_t i = 0; i < numIterations; i++) {
+                uint32_t count = totalProcessStates;
+                std::vector<zes_process_state_t> processes(count);
+                if (ZE_RESULT_SUCCESS != zesDeviceProcessesGetState(device, &count, processes.data()) ||
+                    count != totalProcessStates || processes[0].processId != pid1 || processes[0].memSize != memSize1) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    auto pLinuxGlobalOperationsImp = static_cast<LinuxGlobalOperationsImp *>(pGlobalOperationsImp->pOsGlobalOperations);
+    auto statistics = pLinuxGlobalOperationsImp->getProcessesStateScanStatistics();
+    EXPECT_EQ(0u, failures.load());
+    EXPECT_EQ(numThreads * numIterations, statistics.scansCount);
+}
+
 TEST_F(SysmanGlobalOperationsFixture, GivenValidDeviceHandleWhileRetrievingInformationAboutHostProcessesUsingDeviceThenSuccessIsReturnedEvenwithFaultyClient) {
     uint32_t count = 0;
     pSysfsAccess->mockGetScannedDir4EntriesStatus = true;
@@ -4454,6 +4454,7 @@ void *CL_API_CALL clGetExtensionFunctionAddress(const char *funcName) {
 
     RETURN_FUNC_PTR_IF_EXIST(clCreateTracingHandleINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clSetTracingPointINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clSetTracingBatchCallbackINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clDestroyTracingHandleINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clEnableTracingINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clDisableTracingINTEL);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,8 +10,9 @@
 #include "shared/source/utilities/logger.h"
 #include "shared/source/utilities/perf_profiler.h"
 
-#define API_ENTER(retValPointer) \
-    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
+#define API_ENTER(retValPointer)                                                                                                                          \
+    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::apiLoggingAvailable()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer); \
+    PERF_PROFILER_API_HISTOGRAM()
 
 #if KMD_PROFILING == 1
 #undef API_ENTER
@@ -337,7 +337,7 @@ void CommandQueue::constructBcsEngine(bool internalUsage) {
 
         if (bcsEngines[bcsIndex]) {
             bcsQueueEngineType = bcsEngineType;
-            bcsEngines[bcsIndex]->osContext->ensureContextInitialized();
+            bcsEngines[bcsIndex]->commandStreamReceiver->initializeResources();
             bcsEngines[bcsIndex]->commandStreamReceiver->initDirectSubmission();
         }
         bcsInitialized = true;
@@ -89,7 +89,7 @@ class CommandQueueHw : public CommandQueue {
 
         for (const EngineControl *engine : bcsEngines) {
             if (engine != nullptr) {
-                engine->osContext->ensureContextInitialized();
+                engine->commandStreamReceiver->initializeResources();
                 engine->commandStreamReceiver->initDirectSubmission();
             }
         }
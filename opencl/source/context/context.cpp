@@ -18,7 +18,7 @@
 #include "shared/source/memory_manager/deferred_deleter.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
-#include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/pool_chunk_allocator.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "opencl/source/cl_device/cl_device.h"
@@ -517,9 +517,8 @@ Context::BufferPoolAllocator::BufferPool::BufferPool(Context *context) : memoryM
                                      bufferCreateArgs,
                                      errcodeRet));
     if (mainStorage) {
-        chunkAllocator.reset(new HeapAllocator(BufferPoolAllocator::startingOffset,
-                                               BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
-                                               BufferPoolAllocator::chunkAlignment));
+        chunkAllocator.reset(new PoolChunkAllocator(BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
+                                                    BufferPoolAllocator::chunkAlignment));
         context->decRefInternal();
     }
 }
@@ -535,12 +534,10 @@ Buffer *Context::BufferPoolAllocator::BufferPool::allocate(const MemoryPropertie
                                                            void *hostPtr,
                                                            cl_int &errcodeRet) {
     cl_buffer_region bufferRegion{};
-    size_t actualSize = requestedSize;
-    bufferRegion.origin = static_cast<size_t>(chunkAllocator->allocate(actualSize));
-    if (bufferRegion.origin == 0) {
+    size_t actualSize = 0u;
+    if (!chunkAllocator->allocate(requestedSize, 0u, bufferRegion.origin, actualSize)) {
         return nullptr;
     }
-    bufferRegion.origin -= BufferPoolAllocator::startingOffset;
     bufferRegion.size = requestedSize;
     auto bufferFromPool = mainStorage->createSubBuffer(flags, flagsIntel, &bufferRegion, errcodeRet);
     bufferFromPool->createFunction = mainStorage->createFunction;
@@ -559,16 +556,12 @@ void Context::BufferPoolAllocator::BufferPool::drain() {
         }
     }
 
-    for (auto &chunk : chunksToFree) {
-        chunkAllocator->free(chunk.first, chunk.second);
-    }
-
-    chunksToFree.clear();
+    chunkAllocator->releaseDeferredChunks();
 }
 
 void Context::BufferPoolAllocator::BufferPool::tryFreeFromPoolBuffer(MemObj *possiblePoolBuffer, size_t offset, size_t size) {
     if (this->isPoolBuffer(possiblePoolBuffer)) {
-        chunksToFree.push_back({offset + BufferPoolAllocator::startingOffset, size});
+        chunkAllocator->deferFree(offset, size);
     }
 }
 
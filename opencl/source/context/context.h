@@ -25,7 +25,7 @@ enum InternalMemoryType : uint32_t;
 
 namespace NEO {
 struct MemoryProperties;
-class HeapAllocator;
+class PoolChunkAllocator;
 
 class AsyncEventsHandler;
 class CommandQueue;
@@ -50,7 +50,6 @@ class Context : public BaseObject<_cl_context> {
         static constexpr auto aggregatedSmallBuffersPoolSize = 64 * KB;
         static constexpr auto smallBufferThreshold = 4 * KB;
         static constexpr auto chunkAlignment = 512u;
-        static constexpr auto startingOffset = chunkAlignment;
 
         static_assert(aggregatedSmallBuffersPoolSize > smallBufferThreshold, "Largest allowed buffer needs to fit in pool");
 
@@ -97,8 +96,7 @@ class Context : public BaseObject<_cl_context> {
             void drain();
             MemoryManager *memoryManager{nullptr};
             std::unique_ptr<Buffer> mainStorage;
-            std::unique_ptr<HeapAllocator> chunkAllocator;
-            std::vector<std::pair<uint64_t, size_t>> chunksToFree;
+            std::unique_ptr<PoolChunkAllocator> chunkAllocator;
         };
         Context *context{nullptr};
         std::mutex mutex;
@@ -21,6 +21,7 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/utilities/perf_counter.h"
 #include "shared/source/utilities/range.h"
+#include "shared/source/utilities/slab_allocator.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "opencl/extensions/public/cl_ext_private.h"
@@ -37,6 +38,25 @@
 #include <iostream>
 
 namespace NEO {
+namespace {
+using EventSlabAllocator = SlabAllocator<2 * MemoryConstants::kiloByte>;
+
+EventSlabAllocator &getEventSlabAllocator() {
+    // never destroyed, events can still be released during static destruction
+    alignas(EventSlabAllocator) static char allocatorStorage[sizeof(EventSlabAllocator)];
+    static auto allocator = new (allocatorStorage) EventSlabAllocator();
+    return *allocator;
+}
+} // namespace
+
+void *Event::operator new(size_t size) {
+    return getEventSlabAllocator().allocate(size);
+}
+
+void Event::operator delete(void *ptr, size_t size) {
+    getEventSlabAllocator().deallocate(ptr, size);
+}
+
 Event::Event(
     Context *ctx,
     CommandQueue *cmdQueue,
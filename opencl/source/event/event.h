@@ -90,6 +90,9 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
 
     ~Event() override;
 
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr, size_t size);
+
     void setupBcs(aub_stream::EngineType bcsEngineType);
     TaskCountType peekBcsTaskCountFromCommandQueue();
     bool isBcsEvent() const;
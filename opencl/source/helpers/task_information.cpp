@@ -16,6 +16,7 @@
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/surface.h"
+#include "shared/source/utilities/slab_allocator.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/cl_device/cl_device.h"
@@ -31,6 +32,33 @@ namespace NEO {
 template void KernelOperation::ResourceCleaner::operator()<LinearStream>(LinearStream *);
 template void KernelOperation::ResourceCleaner::operator()<IndirectHeap>(IndirectHeap *);
 
+namespace {
+using TaskInformationSlabAllocator = SlabAllocator<8 * MemoryConstants::kiloByte>;
+
+TaskInformationSlabAllocator &getTaskInformationSlabAllocator() {
+    // never destroyed, blocked commands can still be released during static destruction
+    alignas(TaskInformationSlabAllocator) static char allocatorStorage[sizeof(TaskInformationSlabAllocator)];
+    static auto allocator = new (allocatorStorage) TaskInformationSlabAllocator();
+    return *allocator;
+}
+} // namespace
+
+void *KernelOperation::operator new(size_t size) {
+    return getTaskInformationSlabAllocator().allocate(size);
+}
+
+void KernelOperation::operator delete(void *ptr, size_t size) {
+    getTaskInformationSlabAllocator().deallocate(ptr, size);
+}
+
+void *Command::operator new(size_t size) {
+    return getTaskInformationSlabAllocator().allocate(size);
+}
+
+void Command::operator delete(void *ptr, size_t size) {
+    getTaskInformationSlabAllocator().deallocate(ptr, size);
+}
+
 CommandMapUnmap::CommandMapUnmap(MapOperationType operationType, MemObj &memObj, MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset, bool readOnly,
                                  CommandQueue &commandQueue)
     : Command(commandQueue), memObj(memObj), copySize(copySize), copyOffset(copyOffset), readOnly(readOnly), operationType(operationType) {
@@ -68,6 +68,9 @@ struct KernelOperation {
         }
     }
 
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr, size_t size);
+
     LinearStreamUniquePtrT commandStream{nullptr, resourceCleaner};
     IndirectHeapUniquePtrT dsh{nullptr, resourceCleaner};
     IndirectHeapUniquePtrT ioh{nullptr, resourceCleaner};
@@ -90,6 +93,10 @@ class Command : public IFNode<Command> {
     Command(CommandQueue &commandQueue, std::unique_ptr<KernelOperation> &kernelOperation);
 
     virtual ~Command();
+
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr, size_t size);
+
     virtual LinearStream *getCommandStream() {
         return nullptr;
     }
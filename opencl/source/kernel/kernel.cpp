@@ -342,6 +342,7 @@ cl_int Kernel::initialize() {
             kernelArgHandlers[i] = &Kernel::setArgImmediate;
         }
     }
+    buildArgPatchPlan();
 
     if (usingImages && !usingBuffers) {
         usingImagesOnly = true;
@@ -869,6 +870,9 @@ cl_int Kernel::setArg(uint32_t argIndex, size_t argSize, const void *argVal) {
         if (argIndex >= kernelArgHandlers.size()) {
             return CL_INVALID_ARG_INDEX;
         }
+        if (setArgFromPatchPlan(argIndex, argSize, argVal)) {
+            return CL_SUCCESS;
+        }
         argWasUncacheable = kernelArguments[argIndex].isStatelessUncacheable;
         auto argHandler = kernelArgHandlers[argIndex];
         retVal = (this->*argHandler)(argIndex, argSize, argVal);
@@ -1728,6 +1732,55 @@ cl_int Kernel::setArgImmediate(uint32_t argIndex,
     return retVal;
 }
 
+void Kernel::buildArgPatchPlan() {
+    const auto &explicitArgs = kernelInfo.kernelDescriptor.payloadMappings.explicitArgs;
+    argPatchPlan.clear();
+    argPatchPlan.resize(explicitArgs.size());
+
+    for (size_t i = 0; i < explicitArgs.size(); i++) {
+        if (!explicitArgs[i].is<ArgDescriptor::ArgTValue>()) {
+            continue;
+        }
+        const auto &elements = explicitArgs[i].as<ArgDescValue>().elements;
+        if (elements.empty()) {
+            continue;
+        }
+
+        // direct store is possible only when the elements map the value to one contiguous cross thread data range
+        const auto baseOffset = elements[0].offset;
+        uint32_t contiguousSize = 0u;
+        bool isContiguous = true;
+        for (const auto &element : elements) {
+            if (element.size == 0u || element.sourceOffset != contiguousSize || element.offset != baseOffset + contiguousSize) {
+                isContiguous = false;
+                break;
+            }
+            contiguousSize += element.size;
+        }
+        if (isContiguous) {
+            argPatchPlan[i].crossThreadDataOffset = baseOffset;
+            argPatchPlan[i].size = contiguousSize;
+        }
+    }
+}
+
+bool Kernel::setArgFromPatchPlan(uint32_t argIndex, size_t argSize, const void *argVal) {
+    if (argIndex >= argPatchPlan.size()) {
+        return false;
+    }
+    const auto &planEntry = argPatchPlan[argIndex];
+    const auto &argInfo = kernelArguments[argIndex];
+    // only re-setting an already patched value argument with an unchanged size is a plain store,
+    // the argument bookkeeping done by setArgImmediate stays valid in that case
+    if (planEntry.size == 0u || argVal == nullptr || !argInfo.isPatched || argInfo.size != argSize ||
+        argSize < planEntry.size || planEntry.crossThreadDataOffset + planEntry.size > crossThreadDataSize ||
+        kernelArgHandlers[argIndex] != &Kernel::setArgImmediate) {
+        return false;
+    }
+    memcpy_s(ptrOffset(crossThreadData, planEntry.crossThreadDataOffset), planEntry.size, argVal, planEntry.size);
+    return true;
+}
+
 cl_int Kernel::setArgSampler(uint32_t argIndex,
                              size_t argSize,
                              const void *argVal) {
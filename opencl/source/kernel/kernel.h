@@ -74,6 +74,12 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         bool isSetToNullptr = false;
     };
 
+    // cross thread data range, which a value argument is stored to directly when set again
+    struct ArgPatchPlanEntry {
+        uint32_t crossThreadDataOffset = 0u;
+        uint32_t size = 0u;
+    };
+
     enum class TunningStatus {
         STANDARD_TUNNING_IN_PROGRESS,
         SUBDEVICE_TUNNING_IN_PROGRESS,
@@ -411,6 +417,9 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     size_t getLocalIdsSizePerThread() const;
 
   protected:
+    void buildArgPatchPlan();
+    bool setArgFromPatchPlan(uint32_t argIndex, size_t argSize, const void *argVal);
+
     struct KernelConfig {
         Vec3<size_t> gws;
         Vec3<size_t> lws;
@@ -486,6 +495,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     std::vector<SimpleKernelArgInfo> kernelArguments;
     std::vector<KernelArgHandler> kernelArgHandlers;
+    std::vector<ArgPatchPlanEntry> argPatchPlan;
     std::vector<GraphicsAllocation *> kernelSvmGfxAllocations;
     std::vector<GraphicsAllocation *> kernelUnifiedMemoryGfxAllocations;
     std::vector<PatchInfoData> patchInfoDataList;
@@ -23,6 +23,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/migration_sync_data.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/cl_device/cl_device_get_cap.inl"
@@ -108,6 +109,17 @@ void Image::transferData(void *dest, size_t destRowPitch, size_t destSlicePitch,
         std::swap(copyRegion[1], copyRegion[2]);
     }
 
+    auto cpuCopyEngine = executionEnvironment ? executionEnvironment->getCpuCopyEngine() : nullptr;
+    if (cpuCopyEngine && DebugManager.flags.UseCpuCopyEngineForImageTransfer.get() != 0) {
+        auto regionOffset = [&](size_t rowPitch, size_t slicePitch) {
+            return slicePitch * copyOrigin[2] + rowPitch * copyOrigin[1] + copyOrigin[0] * pixelSize;
+        };
+        cpuCopyEngine->copyRegion(ptrOffset(dest, regionOffset(destRowPitch, destSlicePitch)), destRowPitch, destSlicePitch,
+                                  ptrOffset(src, regionOffset(srcRowPitch, srcSlicePitch)), srcRowPitch, srcSlicePitch,
+                                  lineWidth, copyRegion[1], copyRegion[2]);
+        return;
+    }
+
     for (size_t slice = copyOrigin[2]; slice < (copyOrigin[2] + copyRegion[2]); slice++) {
         auto srcSliceOffset = ptrOffset(src, srcSlicePitch * slice);
         auto dstSliceOffset = ptrOffset(dest, destSlicePitch * slice);
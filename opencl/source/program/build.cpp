@@ -14,6 +14,8 @@
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/addressing_mode_helper.h"
 #include "shared/source/helpers/compiler_options_parser.h"
+#include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
 #include "shared/source/utilities/logger.h"
@@ -25,7 +27,9 @@
 #include "opencl/source/platform/platform.h"
 #include "opencl/source/program/program.h"
 
+#include <algorithm>
 #include <cstring>
+#include <future>
 #include <iterator>
 #include <sstream>
 
@@ -130,31 +134,69 @@ cl_int Program::build(
             DBG_LOG(LogApiCalls,
                     "Build Options", inputArgs.apiOptions.begin(),
                     "\nBuild Internal Options", inputArgs.internalOptions.begin());
-            NEO::TranslationOutput compilerOuput = {};
+            // root devices with identical hardware share one compiled binary,
+            // distinct compile targets are built concurrently
+            std::vector<ClDevice *> compileTargets;
+            std::unordered_map<uint32_t, size_t> compileTargetOfRootDevice;
+            for (const auto &clDevice : deviceVector) {
+                auto rootDeviceIndex = clDevice->getRootDeviceIndex();
+                if (compileTargetOfRootDevice.find(rootDeviceIndex) != compileTargetOfRootDevice.end()) {
+                    continue;
+                }
+                auto target = std::find_if(compileTargets.begin(), compileTargets.end(), [&](const ClDevice *targetDevice) {
+                    return isSameCompileTarget(targetDevice->getDevice(), clDevice->getDevice());
+                });
+                if (target == compileTargets.end()) {
+                    target = compileTargets.insert(compileTargets.end(), clDevice);
+                }
+                compileTargetOfRootDevice[rootDeviceIndex] = static_cast<size_t>(std::distance(compileTargets.begin(), target));
+            }
+
+            std::vector<NEO::TranslationOutput> compilerOutputs(compileTargets.size());
+            std::vector<TranslationOutput::ErrorCode> compilerErrors(compileTargets.size(), TranslationOutput::ErrorCode::Success);
+            auto buildForTarget = [&](size_t target) {
+                compilerErrors[target] = pCompilerInterface->build(compileTargets[target]->getDevice(), inputArgs, compilerOutputs[target]);
+            };
+            if (compileTargets.size() > 1 && DebugManager.flags.EnableParallelProgramBuild.get() != 0) {
+                std::vector<std::future<void>> buildTasks;
+                for (size_t target = 1; target < compileTargets.size(); target++) {
+                    buildTasks.push_back(std::async(std::launch::async, buildForTarget, target));
+                }
+                buildForTarget(0);
+                for (auto &buildTask : buildTasks) {
+                    buildTask.wait();
+                }
+            } else {
+                for (size_t target = 0; target < compileTargets.size(); target++) {
+                    buildForTarget(target);
+                }
+            }
 
             for (const auto &clDevice : deviceVector) {
+                auto rootDeviceIndex = clDevice->getRootDeviceIndex();
+                auto target = compileTargetOfRootDevice[rootDeviceIndex];
+                auto &compilerOuput = compilerOutputs[target];
                 if (requiresRebuild && !shouldSuppressRebuildWarning) {
-                    this->updateBuildLog(clDevice->getRootDeviceIndex(), CompilerWarnings::recompiledFromIr.data(), CompilerWarnings::recompiledFromIr.length());
+                    this->updateBuildLog(rootDeviceIndex, CompilerWarnings::recompiledFromIr.data(), CompilerWarnings::recompiledFromIr.length());
                 }
-                auto compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
-                this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
-                this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.backendCompilerLog.c_str(), compilerOuput.backendCompilerLog.size());
-                retVal = asClError(compilerErr);
+                this->updateBuildLog(rootDeviceIndex, compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
+                this->updateBuildLog(rootDeviceIndex, compilerOuput.backendCompilerLog.c_str(), compilerOuput.backendCompilerLog.size());
+                retVal = asClError(compilerErrors[target]);
                 if (retVal != CL_SUCCESS) {
                     break;
                 }
-                if (inputArgs.srcType == IGC::CodeType::oclC) {
+                if (inputArgs.srcType == IGC::CodeType::oclC && compilerOuput.intermediateRepresentation.mem) {
                     this->irBinary = std::move(compilerOuput.intermediateRepresentation.mem);
                     this->irBinarySize = compilerOuput.intermediateRepresentation.size;
                     this->isSpirV = compilerOuput.intermediateCodeType == IGC::CodeType::spirV;
                 }
-                this->buildInfos[clDevice->getRootDeviceIndex()].debugData = std::move(compilerOuput.debugData.mem);
-                this->buildInfos[clDevice->getRootDeviceIndex()].debugDataSize = compilerOuput.debugData.size;
-                if (BuildPhase::BinaryCreation == phaseReached[clDevice->getRootDeviceIndex()]) {
+                this->buildInfos[rootDeviceIndex].debugData = makeCopy(compilerOuput.debugData.mem.get(), compilerOuput.debugData.size);
+                this->buildInfos[rootDeviceIndex].debugDataSize = compilerOuput.debugData.size;
+                if (BuildPhase::BinaryCreation == phaseReached[rootDeviceIndex]) {
                     continue;
                 }
-                this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, clDevice->getRootDeviceIndex());
-                phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::BinaryCreation;
+                this->replaceDeviceBinary(makeCopy(compilerOuput.deviceBinary.mem.get(), compilerOuput.deviceBinary.size), compilerOuput.deviceBinary.size, rootDeviceIndex);
+                phaseReached[rootDeviceIndex] = BuildPhase::BinaryCreation;
             }
             if (retVal != CL_SUCCESS) {
                 break;
@@ -250,6 +292,19 @@ void Program::extractInternalOptions(const std::string &options, std::string &in
     }
 }
 
+bool Program::isSameCompileTarget(const Device &device, const Device &otherDevice) {
+    auto &hwInfo = device.getHardwareInfo();
+    auto &otherHwInfo = otherDevice.getHardwareInfo();
+    // everything passed to the compiler device context has to match
+    return 0 == memcmp(&hwInfo.platform, &otherHwInfo.platform, sizeof(PLATFORM)) &&
+           hwInfo.ipVersion.value == otherHwInfo.ipVersion.value &&
+           hwInfo.capabilityTable.clVersionSupport == otherHwInfo.capabilityTable.clVersionSupport &&
+           hwInfo.featureTable.asHash() == otherHwInfo.featureTable.asHash() &&
+           hwInfo.workaroundTable.asHash() == otherHwInfo.workaroundTable.asHash() &&
+           0 == memcmp(&hwInfo.gtSystemInfo, &otherHwInfo.gtSystemInfo, sizeof(GT_SYSTEM_INFO)) &&
+           device.getDeviceInfo().outProfilingTimerResolution == otherDevice.getDeviceInfo().outProfilingTimerResolution;
+}
+
 void Program::debugNotify(const ClDeviceVector &deviceVector, std::unordered_map<uint32_t, BuildPhase> &phasesReached) {
     for (auto &clDevice : deviceVector) {
         auto rootDeviceIndex = clDevice->getRootDeviceIndex();
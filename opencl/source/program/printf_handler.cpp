@@ -107,7 +107,8 @@ bool PrintfHandler::printEnqueueOutput() {
     }
 
     PrintFormatter printFormatter(printfOutputBuffer, printfOutputSize, kernel->is32Bit(),
-                                  usesStringMap ? &kernel->getDescriptor().kernelMetadata.printfStringsMap : nullptr);
+                                  usesStringMap ? &kernel->getDescriptor().kernelMetadata.printfStringsMap : nullptr,
+                                  &kernel->getKernelInfo().printfFormatPlans);
     printFormatter.printKernelOutput();
 
     return true;
@@ -32,6 +32,7 @@ class CompilerInterface;
 class Device;
 class ExecutionEnvironment;
 class Program;
+struct HardwareInfo;
 struct KernelInfo;
 template <>
 struct OpenCLObjectMapper<_cl_program> {
@@ -298,6 +299,7 @@ class Program : public BaseObject<_cl_program> {
     MOCKABLE_VIRTUAL bool isOptionValueValid(ConstStringRef option, ConstStringRef value);
 
     MOCKABLE_VIRTUAL bool appendKernelDebugOptions(ClDevice &clDevice, std::string &internalOptions);
+    static bool isSameCompileTarget(const Device &device, const Device &otherDevice);
     void notifyDebuggerWithSourceCode(ClDevice &clDevice, std::string &filename);
     void prependFilePathToOptions(const std::string &filename);
 
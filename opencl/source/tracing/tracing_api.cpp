@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,59 +10,130 @@
 #include "opencl/source/tracing/tracing_handle.h"
 #include "opencl/source/tracing/tracing_notify.h"
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
 namespace HostSideTracing {
 
-// [XYZZ..Z] - { X - enabled/disabled bit, Y - locked/unlocked bit, ZZ..Z - client count bits }
+// [X000..0] - { X - enabled/disabled bit }
 std::atomic<uint32_t> tracingState(0);
-TracingHandle *tracingHandle[TRACING_MAX_HANDLE_COUNT] = {nullptr};
+thread_local const TracingHandleTable *tracingHandleSnapshot = nullptr;
 std::atomic<uint32_t> tracingCorrelationId(0);
 
-bool addTracingClient() {
-    uint32_t state = tracingState.load(std::memory_order_acquire);
-    state = TRACING_SET_ENABLED_BIT(state);
-    state = TRACING_UNSET_LOCKED_BIT(state);
-    AtomicBackoff backoff;
-    while (!tracingState.compare_exchange_weak(state, state + 1, std::memory_order_release,
-                                               std::memory_order_acquire)) {
-        if (!TRACING_GET_ENABLED_BIT(state)) {
-            return false;
-        } else if (TRACING_GET_LOCKED_BIT(state)) {
-            DEBUG_BREAK_IF(TRACING_GET_CLIENT_COUNTER(state) != 0);
-            state = TRACING_UNSET_LOCKED_BIT(state);
-            backoff.pause();
-        } else {
+namespace {
+class ThreadPrivateTracingData {
+  public:
+    ~ThreadPrivateTracingData();
+    void pinTable(const TracingHandleTable *table) {
+        if (!onList) {
+            addToList();
+        }
+        pinnedTable.store(table, std::memory_order_seq_cst);
+    }
+
+    std::atomic<const TracingHandleTable *> pinnedTable{nullptr};
+    uint32_t nestingLevel = 0u;
+
+  protected:
+    void addToList();
+    bool onList = false;
+};
+
+const TracingHandleTable emptyTracingHandleTable = {};
+std::atomic<const TracingHandleTable *> activeTracingHandleTable(&emptyTracingHandleTable);
+std::mutex tracingHandleTableMutex;
+
+std::mutex threadTracingDataListMutex;
+std::vector<ThreadPrivateTracingData *> threadTracingDataList;
+
+thread_local ThreadPrivateTracingData threadTracingData;
+
+void ThreadPrivateTracingData::addToList() {
+    std::lock_guard<std::mutex> lock(threadTracingDataListMutex);
+    threadTracingDataList.push_back(this);
+    onList = true;
+}
+
+ThreadPrivateTracingData::~ThreadPrivateTracingData() {
+    if (onList) {
+        std::lock_guard<std::mutex> lock(threadTracingDataListMutex);
+        threadTracingDataList.erase(std::remove(threadTracingDataList.begin(), threadTracingDataList.end(), this), threadTracingDataList.end());
+        onList = false;
+    }
+}
+
+// Waits until no thread pins a table other than the given one, after that older tables can be released.
+// A reader may briefly pin a table which is already released before it notices a newer one,
+// so pinned pointers are only compared and never dereferenced here.
+void waitForTracingReaders(const TracingHandleTable *currentTable) {
+    std::lock_guard<std::mutex> lock(threadTracingDataListMutex);
+    for (auto threadData : threadTracingDataList) {
+        AtomicBackoff backoff;
+        auto pinnedTable = threadData->pinnedTable.load(std::memory_order_seq_cst);
+        while (pinnedTable != nullptr && pinnedTable != currentTable) {
             backoff.pause();
+            pinnedTable = threadData->pinnedTable.load(std::memory_order_seq_cst);
         }
     }
-    return true;
 }
 
-void removeTracingClient() {
-    DEBUG_BREAK_IF(!TRACING_GET_ENABLED_BIT(tracingState.load(std::memory_order_acquire)));
-    DEBUG_BREAK_IF(TRACING_GET_LOCKED_BIT(tracingState.load(std::memory_order_acquire)));
-    DEBUG_BREAK_IF(TRACING_GET_CLIENT_COUNTER(tracingState.load(std::memory_order_acquire)) == 0);
-    tracingState.fetch_sub(1, std::memory_order_acq_rel);
+// Must be called with tracingHandleTableMutex held
+void publishTracingHandleTable(std::unique_ptr<TracingHandleTable> newTable) {
+    auto oldTable = activeTracingHandleTable.load(std::memory_order_relaxed);
+    newTable->version = oldTable->version + 1;
+    bool tracingEnabled = newTable->handles[0] != nullptr;
+
+    const TracingHandleTable *currentTable = newTable.release();
+    activeTracingHandleTable.store(currentTable, std::memory_order_seq_cst);
+    if (tracingEnabled) {
+        tracingState.fetch_or(TRACING_STATE_ENABLED_BIT, std::memory_order_acq_rel);
+    } else {
+        tracingState.fetch_and(~TRACING_STATE_ENABLED_BIT, std::memory_order_acq_rel);
+    }
+
+    waitForTracingReaders(currentTable);
+    if (oldTable != &emptyTracingHandleTable) {
+        delete oldTable;
+    }
 }
+} // namespace
 
-static void lockTracingState() {
-    uint32_t state = tracingState.load(std::memory_order_acquire);
-    state = TRACING_ZERO_CLIENT_COUNTER(state);
-    state = TRACING_UNSET_LOCKED_BIT(state);
-    AtomicBackoff backoff;
-    while (!tracingState.compare_exchange_weak(state, TRACING_SET_LOCKED_BIT(state),
-                                               std::memory_order_release, std::memory_order_acquire)) {
-        state = TRACING_ZERO_CLIENT_COUNTER(state);
-        state = TRACING_UNSET_LOCKED_BIT(state);
-        backoff.pause();
-    }
-    DEBUG_BREAK_IF(!TRACING_GET_LOCKED_BIT(tracingState.load(std::memory_order_acquire)));
-    DEBUG_BREAK_IF(TRACING_GET_CLIENT_COUNTER(tracingState.load(std::memory_order_acquire)) > 0);
+bool addTracingClient() {
+    auto &threadData = threadTracingData;
+    if (threadData.nestingLevel > 0) {
+        threadData.nestingLevel++;
+        return true;
+    }
+
+    auto table = activeTracingHandleTable.load(std::memory_order_seq_cst);
+    while (true) {
+        threadData.pinTable(table);
+        auto latestTable = activeTracingHandleTable.load(std::memory_order_seq_cst);
+        if (latestTable == table) {
+            break;
+        }
+        table = latestTable;
+    }
+
+    if (table->handles[0] == nullptr) {
+        threadData.pinnedTable.store(nullptr, std::memory_order_release);
+        return false;
+    }
+
+    tracingHandleSnapshot = table;
+    threadData.nestingLevel = 1;
+    return true;
 }
 
-static void unlockTracingState() {
-    DEBUG_BREAK_IF(!TRACING_GET_LOCKED_BIT(tracingState.load(std::memory_order_acquire)));
-    DEBUG_BREAK_IF(TRACING_GET_CLIENT_COUNTER(tracingState.load(std::memory_order_acquire)) > 0);
-    tracingState.fetch_and(~TRACING_STATE_LOCKED_BIT, std::memory_order_acq_rel);
+void removeTracingClient() {
+    auto &threadData = threadTracingData;
+    DEBUG_BREAK_IF(threadData.nestingLevel == 0);
+    threadData.nestingLevel--;
+    if (threadData.nestingLevel == 0) {
+        tracingHandleSnapshot = nullptr;
+        threadData.pinnedTable.store(nullptr, std::memory_order_release);
+    }
 }
 
 } // namespace HostSideTracing
@@ -104,6 +175,17 @@ cl_int CL_API_CALL clSetTracingPointINTEL(cl_tracing_handle handle, cl_function_
     return CL_SUCCESS;
 }
 
+cl_int CL_API_CALL clSetTracingBatchCallbackINTEL(cl_tracing_handle handle, cl_tracing_batch_callback callback, cl_uint batchSize) {
+    if (handle == nullptr || (callback != nullptr && batchSize == 0)) {
+        return CL_INVALID_VALUE;
+    }
+
+    DEBUG_BREAK_IF(handle->handle == nullptr);
+    handle->handle->setBatchCallback(callback, batchSize);
+
+    return CL_SUCCESS;
+}
+
 cl_int CL_API_CALL clDestroyTracingHandleINTEL(cl_tracing_handle handle) {
     if (handle == nullptr) {
         return CL_INVALID_VALUE;
@@ -121,30 +203,27 @@ cl_int CL_API_CALL clEnableTracingINTEL(cl_tracing_handle handle) {
         return CL_INVALID_VALUE;
     }
 
-    lockTracingState();
+    std::lock_guard<std::mutex> lock(tracingHandleTableMutex);
+    auto table = activeTracingHandleTable.load(std::memory_order_relaxed);
 
     size_t i = 0;
     DEBUG_BREAK_IF(handle->handle == nullptr);
-    while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-        if (tracingHandle[i] == handle->handle) {
-            unlockTracingState();
+    while (i < TRACING_MAX_HANDLE_COUNT && table->handles[i] != nullptr) {
+        if (table->handles[i] == handle->handle) {
             return CL_INVALID_VALUE;
         }
         ++i;
     }
 
     if (i == TRACING_MAX_HANDLE_COUNT) {
-        unlockTracingState();
         return CL_OUT_OF_RESOURCES;
     }
 
-    DEBUG_BREAK_IF(tracingHandle[i] != nullptr);
-    tracingHandle[i] = handle->handle;
-    if (i == 0) {
-        tracingState.fetch_or(TRACING_STATE_ENABLED_BIT, std::memory_order_acq_rel);
-    }
+    auto newTable = std::make_unique<TracingHandleTable>(*table);
+    DEBUG_BREAK_IF(newTable->handles[i] != nullptr);
+    newTable->handles[i] = handle->handle;
+    publishTracingHandleTable(std::move(newTable));
 
-    unlockTracingState();
     return CL_SUCCESS;
 }
 
@@ -153,32 +232,29 @@ cl_int CL_API_CALL clDisableTracingINTEL(cl_tracing_handle handle) {
         return CL_INVALID_VALUE;
     }
 
-    lockTracingState();
+    std::lock_guard<std::mutex> lock(tracingHandleTableMutex);
+    auto table = activeTracingHandleTable.load(std::memory_order_relaxed);
 
     size_t size = 0;
-    while (size < TRACING_MAX_HANDLE_COUNT && tracingHandle[size] != nullptr) {
+    while (size < TRACING_MAX_HANDLE_COUNT && table->handles[size] != nullptr) {
         ++size;
     }
 
     size_t i = 0;
     DEBUG_BREAK_IF(handle->handle == nullptr);
-    while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-        if (tracingHandle[i] == handle->handle) {
-            if (size == 1) {
-                DEBUG_BREAK_IF(i != 0);
-                tracingState.fetch_and(~TRACING_STATE_ENABLED_BIT, std::memory_order_acq_rel);
-                tracingHandle[i] = nullptr;
-            } else {
-                tracingHandle[i] = tracingHandle[size - 1];
-                tracingHandle[size - 1] = nullptr;
-            }
-            unlockTracingState();
+    while (i < size) {
+        if (table->handles[i] == handle->handle) {
+            auto newTable = std::make_unique<TracingHandleTable>(*table);
+            newTable->handles[i] = newTable->handles[size - 1];
+            newTable->handles[size - 1] = nullptr;
+            publishTracingHandleTable(std::move(newTable));
+
+            handle->handle->flushRecords();
             return CL_SUCCESS;
         }
         ++i;
     }
 
-    unlockTracingState();
     return CL_INVALID_VALUE;
 }
 
@@ -187,20 +263,20 @@ cl_int CL_API_CALL clGetTracingStateINTEL(cl_tracing_handle handle, cl_bool *ena
         return CL_INVALID_VALUE;
     }
 
-    lockTracingState();
+    std::lock_guard<std::mutex> lock(tracingHandleTableMutex);
+    auto table = activeTracingHandleTable.load(std::memory_order_relaxed);
 
     *enable = CL_FALSE;
 
     size_t i = 0;
     DEBUG_BREAK_IF(handle->handle == nullptr);
-    while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-        if (tracingHandle[i] == handle->handle) {
+    while (i < TRACING_MAX_HANDLE_COUNT && table->handles[i] != nullptr) {
+        if (table->handles[i] == handle->handle) {
             *enable = CL_TRUE;
             break;
         }
         ++i;
     }
 
-    unlockTracingState();
     return CL_SUCCESS;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,23 @@ cl_int CL_API_CALL clCreateTracingHandleINTEL(cl_device_id device, cl_tracing_ca
 */
 cl_int CL_API_CALL clSetTracingPointINTEL(cl_tracing_handle handle, cl_function_id fid, cl_bool enable);
 
+/*!
+    Function switches the tracing handle into batching mode. Instead of calling
+    the tracing callback around every traced function, trace records are
+    collected per thread and delivered to the batching callback in bulk, once
+    a thread collected batchSize records. Remaining records are delivered when
+    tracing is disabled for the handle or the handle is destroyed.
+    Must be called while tracing is disabled for the handle
+    \param[in] handle Tracing handle object
+    \param[in] callback Batching callback, zero switches back to per call mode
+    \param[in] batchSize Number of records delivered at once, must be greater
+                         than zero
+    \return Status code for current operation
+
+    Thread Safety: no
+*/
+cl_int CL_API_CALL clSetTracingBatchCallbackINTEL(cl_tracing_handle handle, cl_tracing_batch_callback callback, cl_uint batchSize);
+
 /*!
     Function destroys the tracing handle object and releases all the associated
     resources
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/tracing/tracing_handle.h"
+
+#include <array>
+#include <chrono>
+
+namespace HostSideTracing {
+
+namespace {
+std::atomic<uint64_t> tracingHandleInstanceCounter{0u};
+
+struct ThreadBatchCacheEntry {
+    uint64_t instanceId = 0u;
+    void *batch = nullptr;
+};
+constexpr size_t threadBatchCacheSize = 4u;
+thread_local std::array<ThreadBatchCacheEntry, threadBatchCacheSize> threadBatchCache;
+thread_local size_t threadBatchCacheNextEntry = 0u;
+} // namespace
+
+TracingHandle::TracingHandle(cl_tracing_callback callback, void *userData) : callback(callback), userData(userData),
+                                                                              instanceId(++tracingHandleInstanceCounter) {}
+
+TracingHandle::~TracingHandle() {
+    flushRecords();
+}
+
+void TracingHandle::setBatchCallback(cl_tracing_batch_callback batchCallback, uint32_t batchSize) {
+    flushRecords();
+    this->batchCallback = batchCallback;
+    this->batchSize = batchSize;
+}
+
+TracingHandle::RecordBatch *TracingHandle::getThreadBatch() {
+    for (auto &entry : threadBatchCache) {
+        if (entry.instanceId == instanceId) {
+            return reinterpret_cast<RecordBatch *>(entry.batch);
+        }
+    }
+
+    RecordBatch *threadBatch = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(batchesMutex);
+        auto threadId = std::this_thread::get_id();
+        for (auto &batch : batches) {
+            if (batch->threadId == threadId) {
+                threadBatch = batch.get();
+                break;
+            }
+        }
+        if (threadBatch == nullptr) {
+            auto batch = std::make_unique<RecordBatch>();
+            batch->threadId = threadId;
+            batch->threadIndex = static_cast<uint32_t>(batches.size());
+            batch->records.reserve(batchSize);
+            threadBatch = batch.get();
+            batches.push_back(std::move(batch));
+        }
+    }
+
+    auto &entry = threadBatchCache[threadBatchCacheNextEntry];
+    threadBatchCacheNextEntry = (threadBatchCacheNextEntry + 1) % threadBatchCacheSize;
+    entry.instanceId = instanceId;
+    entry.batch = threadBatch;
+    return threadBatch;
+}
+
+void TracingHandle::addRecord(cl_function_id fid, const cl_callback_data *callbackData) {
+    auto batch = getThreadBatch();
+
+    cl_tracing_record record = {};
+    record.functionId = fid;
+    record.site = callbackData->site;
+    record.correlationId = callbackData->correlationId;
+    record.threadIndex = batch->threadIndex;
+    record.timestamp = static_cast<cl_ulong>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+
+    bool batchFull = false;
+    {
+        std::lock_guard<std::mutex> lock(batch->mutex);
+        batch->records.push_back(record);
+        batchFull = batch->records.size() >= batchSize;
+    }
+    if (batchFull) {
+        deliverRecords(*batch);
+    }
+}
+
+void TracingHandle::deliverRecords(RecordBatch &batch) {
+    std::vector<cl_tracing_record> records;
+    records.reserve(batchSize);
+    {
+        std::lock_guard<std::mutex> lock(batch.mutex);
+        records.swap(batch.records);
+    }
+    if (!records.empty() && batchCallback != nullptr) {
+        batchCallback(records.data(), static_cast<cl_uint>(records.size()), userData);
+    }
+}
+
+void TracingHandle::flushRecords() {
+    std::lock_guard<std::mutex> lock(batchesMutex);
+    for (auto &batch : batches) {
+        deliverRecords(*batch);
+    }
+}
+
+} // namespace HostSideTracing
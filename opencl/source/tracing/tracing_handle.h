@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,16 +11,26 @@
 
 #include "opencl/source/tracing/tracing_types.h"
 
+#include <atomic>
 #include <bitset>
+#include <memory>
+#include <mutex>
 #include <stdint.h>
+#include <thread>
+#include <vector>
 
 namespace HostSideTracing {
 
 struct TracingHandle {
   public:
-    TracingHandle(cl_tracing_callback callback, void *userData) : callback(callback), userData(userData) {}
+    TracingHandle(cl_tracing_callback callback, void *userData);
+    ~TracingHandle();
 
     void call(cl_function_id fid, cl_callback_data *callbackData) {
+        if (batchCallback != nullptr) {
+            addRecord(fid, callbackData);
+            return;
+        }
         callback(fid, callbackData, userData);
     }
 
@@ -34,10 +44,31 @@ struct TracingHandle {
         return mask[static_cast<uint32_t>(fid)];
     }
 
+    void setBatchCallback(cl_tracing_batch_callback batchCallback, uint32_t batchSize);
+    void flushRecords();
+
   private:
+    struct RecordBatch {
+        std::mutex mutex;
+        std::vector<cl_tracing_record> records;
+        std::thread::id threadId;
+        uint32_t threadIndex = 0u;
+    };
+
+    void addRecord(cl_function_id fid, const cl_callback_data *callbackData);
+    RecordBatch *getThreadBatch();
+    void deliverRecords(RecordBatch &batch);
+
     cl_tracing_callback callback;
     void *userData;
     std::bitset<CL_FUNCTION_COUNT> mask;
+
+    cl_tracing_batch_callback batchCallback = nullptr;
+    uint32_t batchSize = 0u;
+    const uint64_t instanceId;
+    // one batch per recording thread, so recording threads never contend with each other
+    std::mutex batchesMutex;
+    std::vector<std::unique_ptr<RecordBatch>> batches;
 };
 
 } // namespace HostSideTracing
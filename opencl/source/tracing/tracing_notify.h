@@ -21,13 +21,6 @@ namespace HostSideTracing {
 #define TRACING_UNSET_ENABLED_BIT(state) ((state) & (~HostSideTracing::TRACING_STATE_ENABLED_BIT))
 #define TRACING_GET_ENABLED_BIT(state) ((state) & (HostSideTracing::TRACING_STATE_ENABLED_BIT))
 
-#define TRACING_SET_LOCKED_BIT(state) ((state) | (HostSideTracing::TRACING_STATE_LOCKED_BIT))
-#define TRACING_UNSET_LOCKED_BIT(state) ((state) & (~HostSideTracing::TRACING_STATE_LOCKED_BIT))
-#define TRACING_GET_LOCKED_BIT(state) ((state) & (HostSideTracing::TRACING_STATE_LOCKED_BIT))
-
-#define TRACING_ZERO_CLIENT_COUNTER(state) ((state) & (HostSideTracing::TRACING_STATE_ENABLED_BIT | HostSideTracing::TRACING_STATE_LOCKED_BIT))
-#define TRACING_GET_CLIENT_COUNTER(state) ((state) & (~(HostSideTracing::TRACING_STATE_ENABLED_BIT | HostSideTracing::TRACING_STATE_LOCKED_BIT)))
-
 #define TRACING_ENTER(name, ...)                                                                  \
     bool isHostSideTracingEnabled_##name = false;                                                 \
     HostSideTracing::name##Tracer tracer_##name;                                                  \
@@ -53,10 +46,18 @@ typedef enum _tracing_notify_state_t {
 inline constexpr size_t TRACING_MAX_HANDLE_COUNT = 16;
 
 inline constexpr uint32_t TRACING_STATE_ENABLED_BIT = 0x80000000u;
-inline constexpr uint32_t TRACING_STATE_LOCKED_BIT = 0x40000000u;
+
+// Enabled handles are published as immutable, versioned tables. Every API call being traced
+// pins the table current at its start in tracingHandleSnapshot (nested calls reuse it), so
+// readers never write shared state. Enabling/disabling a handle publishes a new table and
+// waits only for threads still pinning an older one before releasing it.
+struct TracingHandleTable {
+    TracingHandle *handles[TRACING_MAX_HANDLE_COUNT] = {};
+    uint64_t version = 0u;
+};
 
 extern std::atomic<uint32_t> tracingState;
-extern TracingHandle *tracingHandle[TRACING_MAX_HANDLE_COUNT];
+extern thread_local const TracingHandleTable *tracingHandleSnapshot;
 extern std::atomic<uint32_t> tracingCorrelationId;
 
 bool addTracingClient();
@@ -108,9 +109,9 @@ class ClBuildProgramTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clBuildProgram)) {
                 data.correlationData = correlationData + i;
@@ -128,9 +129,9 @@ class ClBuildProgramTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clBuildProgram)) {
                 data.correlationData = correlationData + i;
@@ -171,9 +172,9 @@ class ClCloneKernelTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCloneKernel)) {
                 data.correlationData = correlationData + i;
@@ -191,9 +192,9 @@ class ClCloneKernelTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCloneKernel)) {
                 data.correlationData = correlationData + i;
@@ -248,9 +249,9 @@ class ClCompileProgramTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCompileProgram)) {
                 data.correlationData = correlationData + i;
@@ -268,9 +269,9 @@ class ClCompileProgramTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCompileProgram)) {
                 data.correlationData = correlationData + i;
@@ -317,9 +318,9 @@ class ClCreateBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateBuffer)) {
                 data.correlationData = correlationData + i;
@@ -337,9 +338,9 @@ class ClCreateBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateBuffer)) {
                 data.correlationData = correlationData + i;
@@ -384,9 +385,9 @@ class ClCreateCommandQueueTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -404,9 +405,9 @@ class ClCreateCommandQueueTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -451,9 +452,9 @@ class ClCreateCommandQueueWithPropertiesTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateCommandQueueWithProperties)) {
                 data.correlationData = correlationData + i;
@@ -471,9 +472,9 @@ class ClCreateCommandQueueWithPropertiesTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateCommandQueueWithProperties)) {
                 data.correlationData = correlationData + i;
@@ -522,9 +523,9 @@ class ClCreateContextTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateContext)) {
                 data.correlationData = correlationData + i;
@@ -542,9 +543,9 @@ class ClCreateContextTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateContext)) {
                 data.correlationData = correlationData + i;
@@ -591,9 +592,9 @@ class ClCreateContextFromTypeTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateContextFromType)) {
                 data.correlationData = correlationData + i;
@@ -611,9 +612,9 @@ class ClCreateContextFromTypeTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateContextFromType)) {
                 data.correlationData = correlationData + i;
@@ -662,9 +663,9 @@ class ClCreateImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateImage)) {
                 data.correlationData = correlationData + i;
@@ -682,9 +683,9 @@ class ClCreateImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateImage)) {
                 data.correlationData = correlationData + i;
@@ -737,9 +738,9 @@ class ClCreateImage2DTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateImage2D)) {
                 data.correlationData = correlationData + i;
@@ -757,9 +758,9 @@ class ClCreateImage2DTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateImage2D)) {
                 data.correlationData = correlationData + i;
@@ -816,9 +817,9 @@ class ClCreateImage3DTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateImage3D)) {
                 data.correlationData = correlationData + i;
@@ -836,9 +837,9 @@ class ClCreateImage3DTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateImage3D)) {
                 data.correlationData = correlationData + i;
@@ -881,9 +882,9 @@ class ClCreateKernelTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateKernel)) {
                 data.correlationData = correlationData + i;
@@ -901,9 +902,9 @@ class ClCreateKernelTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateKernel)) {
                 data.correlationData = correlationData + i;
@@ -948,9 +949,9 @@ class ClCreateKernelsInProgramTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateKernelsInProgram)) {
                 data.correlationData = correlationData + i;
@@ -968,9 +969,9 @@ class ClCreateKernelsInProgramTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateKernelsInProgram)) {
                 data.correlationData = correlationData + i;
@@ -1019,9 +1020,9 @@ class ClCreatePipeTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreatePipe)) {
                 data.correlationData = correlationData + i;
@@ -1039,9 +1040,9 @@ class ClCreatePipeTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreatePipe)) {
                 data.correlationData = correlationData + i;
@@ -1092,9 +1093,9 @@ class ClCreateProgramWithBinaryTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithBinary)) {
                 data.correlationData = correlationData + i;
@@ -1112,9 +1113,9 @@ class ClCreateProgramWithBinaryTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithBinary)) {
                 data.correlationData = correlationData + i;
@@ -1161,9 +1162,9 @@ class ClCreateProgramWithBuiltInKernelsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithBuiltInKernels)) {
                 data.correlationData = correlationData + i;
@@ -1181,9 +1182,9 @@ class ClCreateProgramWithBuiltInKernelsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithBuiltInKernels)) {
                 data.correlationData = correlationData + i;
@@ -1228,9 +1229,9 @@ class ClCreateProgramWithIlTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithIL)) {
                 data.correlationData = correlationData + i;
@@ -1248,9 +1249,9 @@ class ClCreateProgramWithIlTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithIL)) {
                 data.correlationData = correlationData + i;
@@ -1297,9 +1298,9 @@ class ClCreateProgramWithSourceTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithSource)) {
                 data.correlationData = correlationData + i;
@@ -1317,9 +1318,9 @@ class ClCreateProgramWithSourceTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateProgramWithSource)) {
                 data.correlationData = correlationData + i;
@@ -1366,9 +1367,9 @@ class ClCreateSamplerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateSampler)) {
                 data.correlationData = correlationData + i;
@@ -1386,9 +1387,9 @@ class ClCreateSamplerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateSampler)) {
                 data.correlationData = correlationData + i;
@@ -1431,9 +1432,9 @@ class ClCreateSamplerWithPropertiesTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateSamplerWithProperties)) {
                 data.correlationData = correlationData + i;
@@ -1451,9 +1452,9 @@ class ClCreateSamplerWithPropertiesTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateSamplerWithProperties)) {
                 data.correlationData = correlationData + i;
@@ -1500,9 +1501,9 @@ class ClCreateSubBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateSubBuffer)) {
                 data.correlationData = correlationData + i;
@@ -1520,9 +1521,9 @@ class ClCreateSubBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateSubBuffer)) {
                 data.correlationData = correlationData + i;
@@ -1563,9 +1564,9 @@ class ClCreateUserEventTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateUserEvent)) {
                 data.correlationData = correlationData + i;
@@ -1583,9 +1584,9 @@ class ClCreateUserEventTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateUserEvent)) {
                 data.correlationData = correlationData + i;
@@ -1624,9 +1625,9 @@ class ClEnqueueBarrierTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueBarrier)) {
                 data.correlationData = correlationData + i;
@@ -1644,9 +1645,9 @@ class ClEnqueueBarrierTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueBarrier)) {
                 data.correlationData = correlationData + i;
@@ -1691,9 +1692,9 @@ class ClEnqueueBarrierWithWaitListTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueBarrierWithWaitList)) {
                 data.correlationData = correlationData + i;
@@ -1711,9 +1712,9 @@ class ClEnqueueBarrierWithWaitListTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueBarrierWithWaitList)) {
                 data.correlationData = correlationData + i;
@@ -1768,9 +1769,9 @@ class ClEnqueueCopyBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyBuffer)) {
                 data.correlationData = correlationData + i;
@@ -1788,9 +1789,9 @@ class ClEnqueueCopyBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyBuffer)) {
                 data.correlationData = correlationData + i;
@@ -1853,9 +1854,9 @@ class ClEnqueueCopyBufferRectTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyBufferRect)) {
                 data.correlationData = correlationData + i;
@@ -1873,9 +1874,9 @@ class ClEnqueueCopyBufferRectTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyBufferRect)) {
                 data.correlationData = correlationData + i;
@@ -1930,9 +1931,9 @@ class ClEnqueueCopyBufferToImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyBufferToImage)) {
                 data.correlationData = correlationData + i;
@@ -1950,9 +1951,9 @@ class ClEnqueueCopyBufferToImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyBufferToImage)) {
                 data.correlationData = correlationData + i;
@@ -2007,9 +2008,9 @@ class ClEnqueueCopyImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyImage)) {
                 data.correlationData = correlationData + i;
@@ -2027,9 +2028,9 @@ class ClEnqueueCopyImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyImage)) {
                 data.correlationData = correlationData + i;
@@ -2084,9 +2085,9 @@ class ClEnqueueCopyImageToBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyImageToBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2104,9 +2105,9 @@ class ClEnqueueCopyImageToBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueCopyImageToBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2161,9 +2162,9 @@ class ClEnqueueFillBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueFillBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2181,9 +2182,9 @@ class ClEnqueueFillBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueFillBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2236,9 +2237,9 @@ class ClEnqueueFillImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueFillImage)) {
                 data.correlationData = correlationData + i;
@@ -2256,9 +2257,9 @@ class ClEnqueueFillImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueFillImage)) {
                 data.correlationData = correlationData + i;
@@ -2315,9 +2316,9 @@ class ClEnqueueMapBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMapBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2335,9 +2336,9 @@ class ClEnqueueMapBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMapBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2398,9 +2399,9 @@ class ClEnqueueMapImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMapImage)) {
                 data.correlationData = correlationData + i;
@@ -2418,9 +2419,9 @@ class ClEnqueueMapImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMapImage)) {
                 data.correlationData = correlationData + i;
@@ -2461,9 +2462,9 @@ class ClEnqueueMarkerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMarker)) {
                 data.correlationData = correlationData + i;
@@ -2481,9 +2482,9 @@ class ClEnqueueMarkerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMarker)) {
                 data.correlationData = correlationData + i;
@@ -2528,9 +2529,9 @@ class ClEnqueueMarkerWithWaitListTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMarkerWithWaitList)) {
                 data.correlationData = correlationData + i;
@@ -2548,9 +2549,9 @@ class ClEnqueueMarkerWithWaitListTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMarkerWithWaitList)) {
                 data.correlationData = correlationData + i;
@@ -2601,9 +2602,9 @@ class ClEnqueueMigrateMemObjectsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMigrateMemObjects)) {
                 data.correlationData = correlationData + i;
@@ -2621,9 +2622,9 @@ class ClEnqueueMigrateMemObjectsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueMigrateMemObjects)) {
                 data.correlationData = correlationData + i;
@@ -2678,9 +2679,9 @@ class ClEnqueueNdRangeKernelTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueNDRangeKernel)) {
                 data.correlationData = correlationData + i;
@@ -2698,9 +2699,9 @@ class ClEnqueueNdRangeKernelTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueNDRangeKernel)) {
                 data.correlationData = correlationData + i;
@@ -2757,9 +2758,9 @@ class ClEnqueueNativeKernelTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueNativeKernel)) {
                 data.correlationData = correlationData + i;
@@ -2777,9 +2778,9 @@ class ClEnqueueNativeKernelTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueNativeKernel)) {
                 data.correlationData = correlationData + i;
@@ -2834,9 +2835,9 @@ class ClEnqueueReadBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReadBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2854,9 +2855,9 @@ class ClEnqueueReadBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReadBuffer)) {
                 data.correlationData = correlationData + i;
@@ -2921,9 +2922,9 @@ class ClEnqueueReadBufferRectTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReadBufferRect)) {
                 data.correlationData = correlationData + i;
@@ -2941,9 +2942,9 @@ class ClEnqueueReadBufferRectTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReadBufferRect)) {
                 data.correlationData = correlationData + i;
@@ -3002,9 +3003,9 @@ class ClEnqueueReadImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReadImage)) {
                 data.correlationData = correlationData + i;
@@ -3022,9 +3023,9 @@ class ClEnqueueReadImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReadImage)) {
                 data.correlationData = correlationData + i;
@@ -3077,9 +3078,9 @@ class ClEnqueueSvmFreeTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMFree)) {
                 data.correlationData = correlationData + i;
@@ -3097,9 +3098,9 @@ class ClEnqueueSvmFreeTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMFree)) {
                 data.correlationData = correlationData + i;
@@ -3152,9 +3153,9 @@ class ClEnqueueSvmMapTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMap)) {
                 data.correlationData = correlationData + i;
@@ -3172,9 +3173,9 @@ class ClEnqueueSvmMapTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMap)) {
                 data.correlationData = correlationData + i;
@@ -3227,9 +3228,9 @@ class ClEnqueueSvmMemFillTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMemFill)) {
                 data.correlationData = correlationData + i;
@@ -3247,9 +3248,9 @@ class ClEnqueueSvmMemFillTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMemFill)) {
                 data.correlationData = correlationData + i;
@@ -3302,9 +3303,9 @@ class ClEnqueueSvmMemcpyTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMemcpy)) {
                 data.correlationData = correlationData + i;
@@ -3322,9 +3323,9 @@ class ClEnqueueSvmMemcpyTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMemcpy)) {
                 data.correlationData = correlationData + i;
@@ -3377,9 +3378,9 @@ class ClEnqueueSvmMigrateMemTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMigrateMem)) {
                 data.correlationData = correlationData + i;
@@ -3397,9 +3398,9 @@ class ClEnqueueSvmMigrateMemTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMMigrateMem)) {
                 data.correlationData = correlationData + i;
@@ -3446,9 +3447,9 @@ class ClEnqueueSvmUnmapTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMUnmap)) {
                 data.correlationData = correlationData + i;
@@ -3466,9 +3467,9 @@ class ClEnqueueSvmUnmapTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueSVMUnmap)) {
                 data.correlationData = correlationData + i;
@@ -3515,9 +3516,9 @@ class ClEnqueueTaskTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueTask)) {
                 data.correlationData = correlationData + i;
@@ -3535,9 +3536,9 @@ class ClEnqueueTaskTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueTask)) {
                 data.correlationData = correlationData + i;
@@ -3586,9 +3587,9 @@ class ClEnqueueUnmapMemObjectTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueUnmapMemObject)) {
                 data.correlationData = correlationData + i;
@@ -3606,9 +3607,9 @@ class ClEnqueueUnmapMemObjectTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueUnmapMemObject)) {
                 data.correlationData = correlationData + i;
@@ -3651,9 +3652,9 @@ class ClEnqueueWaitForEventsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWaitForEvents)) {
                 data.correlationData = correlationData + i;
@@ -3671,9 +3672,9 @@ class ClEnqueueWaitForEventsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWaitForEvents)) {
                 data.correlationData = correlationData + i;
@@ -3728,9 +3729,9 @@ class ClEnqueueWriteBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWriteBuffer)) {
                 data.correlationData = correlationData + i;
@@ -3748,9 +3749,9 @@ class ClEnqueueWriteBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWriteBuffer)) {
                 data.correlationData = correlationData + i;
@@ -3815,9 +3816,9 @@ class ClEnqueueWriteBufferRectTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWriteBufferRect)) {
                 data.correlationData = correlationData + i;
@@ -3835,9 +3836,9 @@ class ClEnqueueWriteBufferRectTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWriteBufferRect)) {
                 data.correlationData = correlationData + i;
@@ -3896,9 +3897,9 @@ class ClEnqueueWriteImageTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWriteImage)) {
                 data.correlationData = correlationData + i;
@@ -3916,9 +3917,9 @@ class ClEnqueueWriteImageTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueWriteImage)) {
                 data.correlationData = correlationData + i;
@@ -3957,9 +3958,9 @@ class ClFinishTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clFinish)) {
                 data.correlationData = correlationData + i;
@@ -3977,9 +3978,9 @@ class ClFinishTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clFinish)) {
                 data.correlationData = correlationData + i;
@@ -4018,9 +4019,9 @@ class ClFlushTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clFlush)) {
                 data.correlationData = correlationData + i;
@@ -4038,9 +4039,9 @@ class ClFlushTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clFlush)) {
                 data.correlationData = correlationData + i;
@@ -4087,9 +4088,9 @@ class ClGetCommandQueueInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetCommandQueueInfo)) {
                 data.correlationData = correlationData + i;
@@ -4107,9 +4108,9 @@ class ClGetCommandQueueInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetCommandQueueInfo)) {
                 data.correlationData = correlationData + i;
@@ -4156,9 +4157,9 @@ class ClGetContextInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetContextInfo)) {
                 data.correlationData = correlationData + i;
@@ -4176,9 +4177,9 @@ class ClGetContextInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetContextInfo)) {
                 data.correlationData = correlationData + i;
@@ -4221,9 +4222,9 @@ class ClGetDeviceAndHostTimerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetDeviceAndHostTimer)) {
                 data.correlationData = correlationData + i;
@@ -4241,9 +4242,9 @@ class ClGetDeviceAndHostTimerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetDeviceAndHostTimer)) {
                 data.correlationData = correlationData + i;
@@ -4290,9 +4291,9 @@ class ClGetDeviceIDsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetDeviceIDs)) {
                 data.correlationData = correlationData + i;
@@ -4310,9 +4311,9 @@ class ClGetDeviceIDsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetDeviceIDs)) {
                 data.correlationData = correlationData + i;
@@ -4359,9 +4360,9 @@ class ClGetDeviceInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetDeviceInfo)) {
                 data.correlationData = correlationData + i;
@@ -4379,9 +4380,9 @@ class ClGetDeviceInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetDeviceInfo)) {
                 data.correlationData = correlationData + i;
@@ -4428,9 +4429,9 @@ class ClGetEventInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetEventInfo)) {
                 data.correlationData = correlationData + i;
@@ -4448,9 +4449,9 @@ class ClGetEventInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetEventInfo)) {
                 data.correlationData = correlationData + i;
@@ -4497,9 +4498,9 @@ class ClGetEventProfilingInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetEventProfilingInfo)) {
                 data.correlationData = correlationData + i;
@@ -4517,9 +4518,9 @@ class ClGetEventProfilingInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetEventProfilingInfo)) {
                 data.correlationData = correlationData + i;
@@ -4558,9 +4559,9 @@ class ClGetExtensionFunctionAddressTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetExtensionFunctionAddress)) {
                 data.correlationData = correlationData + i;
@@ -4578,9 +4579,9 @@ class ClGetExtensionFunctionAddressTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetExtensionFunctionAddress)) {
                 data.correlationData = correlationData + i;
@@ -4621,9 +4622,9 @@ class ClGetExtensionFunctionAddressForPlatformTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetExtensionFunctionAddressForPlatform)) {
                 data.correlationData = correlationData + i;
@@ -4641,9 +4642,9 @@ class ClGetExtensionFunctionAddressForPlatformTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetExtensionFunctionAddressForPlatform)) {
                 data.correlationData = correlationData + i;
@@ -4684,9 +4685,9 @@ class ClGetHostTimerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetHostTimer)) {
                 data.correlationData = correlationData + i;
@@ -4704,9 +4705,9 @@ class ClGetHostTimerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetHostTimer)) {
                 data.correlationData = correlationData + i;
@@ -4753,9 +4754,9 @@ class ClGetImageInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetImageInfo)) {
                 data.correlationData = correlationData + i;
@@ -4773,9 +4774,9 @@ class ClGetImageInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetImageInfo)) {
                 data.correlationData = correlationData + i;
@@ -4824,9 +4825,9 @@ class ClGetKernelArgInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelArgInfo)) {
                 data.correlationData = correlationData + i;
@@ -4844,9 +4845,9 @@ class ClGetKernelArgInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelArgInfo)) {
                 data.correlationData = correlationData + i;
@@ -4893,9 +4894,9 @@ class ClGetKernelInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelInfo)) {
                 data.correlationData = correlationData + i;
@@ -4913,9 +4914,9 @@ class ClGetKernelInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelInfo)) {
                 data.correlationData = correlationData + i;
@@ -4968,9 +4969,9 @@ class ClGetKernelSubGroupInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelSubGroupInfo)) {
                 data.correlationData = correlationData + i;
@@ -4988,9 +4989,9 @@ class ClGetKernelSubGroupInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelSubGroupInfo)) {
                 data.correlationData = correlationData + i;
@@ -5039,9 +5040,9 @@ class ClGetKernelWorkGroupInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelWorkGroupInfo)) {
                 data.correlationData = correlationData + i;
@@ -5059,9 +5060,9 @@ class ClGetKernelWorkGroupInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetKernelWorkGroupInfo)) {
                 data.correlationData = correlationData + i;
@@ -5108,9 +5109,9 @@ class ClGetMemObjectInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetMemObjectInfo)) {
                 data.correlationData = correlationData + i;
@@ -5128,9 +5129,9 @@ class ClGetMemObjectInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetMemObjectInfo)) {
                 data.correlationData = correlationData + i;
@@ -5177,9 +5178,9 @@ class ClGetPipeInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetPipeInfo)) {
                 data.correlationData = correlationData + i;
@@ -5197,9 +5198,9 @@ class ClGetPipeInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetPipeInfo)) {
                 data.correlationData = correlationData + i;
@@ -5242,9 +5243,9 @@ class ClGetPlatformIDsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetPlatformIDs)) {
                 data.correlationData = correlationData + i;
@@ -5262,9 +5263,9 @@ class ClGetPlatformIDsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetPlatformIDs)) {
                 data.correlationData = correlationData + i;
@@ -5311,9 +5312,9 @@ class ClGetPlatformInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetPlatformInfo)) {
                 data.correlationData = correlationData + i;
@@ -5331,9 +5332,9 @@ class ClGetPlatformInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetPlatformInfo)) {
                 data.correlationData = correlationData + i;
@@ -5382,9 +5383,9 @@ class ClGetProgramBuildInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetProgramBuildInfo)) {
                 data.correlationData = correlationData + i;
@@ -5402,9 +5403,9 @@ class ClGetProgramBuildInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetProgramBuildInfo)) {
                 data.correlationData = correlationData + i;
@@ -5451,9 +5452,9 @@ class ClGetProgramInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetProgramInfo)) {
                 data.correlationData = correlationData + i;
@@ -5471,9 +5472,9 @@ class ClGetProgramInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetProgramInfo)) {
                 data.correlationData = correlationData + i;
@@ -5520,9 +5521,9 @@ class ClGetSamplerInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetSamplerInfo)) {
                 data.correlationData = correlationData + i;
@@ -5540,9 +5541,9 @@ class ClGetSamplerInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetSamplerInfo)) {
                 data.correlationData = correlationData + i;
@@ -5591,9 +5592,9 @@ class ClGetSupportedImageFormatsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetSupportedImageFormats)) {
                 data.correlationData = correlationData + i;
@@ -5611,9 +5612,9 @@ class ClGetSupportedImageFormatsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetSupportedImageFormats)) {
                 data.correlationData = correlationData + i;
@@ -5668,9 +5669,9 @@ class ClLinkProgramTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clLinkProgram)) {
                 data.correlationData = correlationData + i;
@@ -5688,9 +5689,9 @@ class ClLinkProgramTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clLinkProgram)) {
                 data.correlationData = correlationData + i;
@@ -5729,9 +5730,9 @@ class ClReleaseCommandQueueTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -5749,9 +5750,9 @@ class ClReleaseCommandQueueTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -5790,9 +5791,9 @@ class ClReleaseContextTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseContext)) {
                 data.correlationData = correlationData + i;
@@ -5810,9 +5811,9 @@ class ClReleaseContextTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseContext)) {
                 data.correlationData = correlationData + i;
@@ -5851,9 +5852,9 @@ class ClReleaseDeviceTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseDevice)) {
                 data.correlationData = correlationData + i;
@@ -5871,9 +5872,9 @@ class ClReleaseDeviceTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseDevice)) {
                 data.correlationData = correlationData + i;
@@ -5912,9 +5913,9 @@ class ClReleaseEventTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseEvent)) {
                 data.correlationData = correlationData + i;
@@ -5932,9 +5933,9 @@ class ClReleaseEventTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseEvent)) {
                 data.correlationData = correlationData + i;
@@ -5973,9 +5974,9 @@ class ClReleaseKernelTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseKernel)) {
                 data.correlationData = correlationData + i;
@@ -5993,9 +5994,9 @@ class ClReleaseKernelTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseKernel)) {
                 data.correlationData = correlationData + i;
@@ -6034,9 +6035,9 @@ class ClReleaseMemObjectTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseMemObject)) {
                 data.correlationData = correlationData + i;
@@ -6054,9 +6055,9 @@ class ClReleaseMemObjectTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseMemObject)) {
                 data.correlationData = correlationData + i;
@@ -6095,9 +6096,9 @@ class ClReleaseProgramTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseProgram)) {
                 data.correlationData = correlationData + i;
@@ -6115,9 +6116,9 @@ class ClReleaseProgramTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseProgram)) {
                 data.correlationData = correlationData + i;
@@ -6156,9 +6157,9 @@ class ClReleaseSamplerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseSampler)) {
                 data.correlationData = correlationData + i;
@@ -6176,9 +6177,9 @@ class ClReleaseSamplerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clReleaseSampler)) {
                 data.correlationData = correlationData + i;
@@ -6217,9 +6218,9 @@ class ClRetainCommandQueueTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -6237,9 +6238,9 @@ class ClRetainCommandQueueTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -6278,9 +6279,9 @@ class ClRetainContextTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainContext)) {
                 data.correlationData = correlationData + i;
@@ -6298,9 +6299,9 @@ class ClRetainContextTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainContext)) {
                 data.correlationData = correlationData + i;
@@ -6339,9 +6340,9 @@ class ClRetainDeviceTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainDevice)) {
                 data.correlationData = correlationData + i;
@@ -6359,9 +6360,9 @@ class ClRetainDeviceTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainDevice)) {
                 data.correlationData = correlationData + i;
@@ -6400,9 +6401,9 @@ class ClRetainEventTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainEvent)) {
                 data.correlationData = correlationData + i;
@@ -6420,9 +6421,9 @@ class ClRetainEventTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainEvent)) {
                 data.correlationData = correlationData + i;
@@ -6461,9 +6462,9 @@ class ClRetainKernelTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainKernel)) {
                 data.correlationData = correlationData + i;
@@ -6481,9 +6482,9 @@ class ClRetainKernelTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainKernel)) {
                 data.correlationData = correlationData + i;
@@ -6522,9 +6523,9 @@ class ClRetainMemObjectTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainMemObject)) {
                 data.correlationData = correlationData + i;
@@ -6542,9 +6543,9 @@ class ClRetainMemObjectTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainMemObject)) {
                 data.correlationData = correlationData + i;
@@ -6583,9 +6584,9 @@ class ClRetainProgramTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainProgram)) {
                 data.correlationData = correlationData + i;
@@ -6603,9 +6604,9 @@ class ClRetainProgramTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainProgram)) {
                 data.correlationData = correlationData + i;
@@ -6644,9 +6645,9 @@ class ClRetainSamplerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainSampler)) {
                 data.correlationData = correlationData + i;
@@ -6664,9 +6665,9 @@ class ClRetainSamplerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clRetainSampler)) {
                 data.correlationData = correlationData + i;
@@ -6711,9 +6712,9 @@ class ClSvmAllocTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSVMAlloc)) {
                 data.correlationData = correlationData + i;
@@ -6731,9 +6732,9 @@ class ClSvmAllocTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSVMAlloc)) {
                 data.correlationData = correlationData + i;
@@ -6774,9 +6775,9 @@ class ClSvmFreeTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSVMFree)) {
                 data.correlationData = correlationData + i;
@@ -6794,9 +6795,9 @@ class ClSvmFreeTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSVMFree)) {
                 data.correlationData = correlationData + i;
@@ -6841,9 +6842,9 @@ class ClSetCommandQueuePropertyTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetCommandQueueProperty)) {
                 data.correlationData = correlationData + i;
@@ -6861,9 +6862,9 @@ class ClSetCommandQueuePropertyTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetCommandQueueProperty)) {
                 data.correlationData = correlationData + i;
@@ -6906,9 +6907,9 @@ class ClSetDefaultDeviceCommandQueueTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetDefaultDeviceCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -6926,9 +6927,9 @@ class ClSetDefaultDeviceCommandQueueTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetDefaultDeviceCommandQueue)) {
                 data.correlationData = correlationData + i;
@@ -6973,9 +6974,9 @@ class ClSetEventCallbackTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetEventCallback)) {
                 data.correlationData = correlationData + i;
@@ -6993,9 +6994,9 @@ class ClSetEventCallbackTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetEventCallback)) {
                 data.correlationData = correlationData + i;
@@ -7040,9 +7041,9 @@ class ClSetKernelArgTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetKernelArg)) {
                 data.correlationData = correlationData + i;
@@ -7060,9 +7061,9 @@ class ClSetKernelArgTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetKernelArg)) {
                 data.correlationData = correlationData + i;
@@ -7105,9 +7106,9 @@ class ClSetKernelArgSvmPointerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetKernelArgSVMPointer)) {
                 data.correlationData = correlationData + i;
@@ -7125,9 +7126,9 @@ class ClSetKernelArgSvmPointerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetKernelArgSVMPointer)) {
                 data.correlationData = correlationData + i;
@@ -7172,9 +7173,9 @@ class ClSetKernelExecInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetKernelExecInfo)) {
                 data.correlationData = correlationData + i;
@@ -7192,9 +7193,9 @@ class ClSetKernelExecInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetKernelExecInfo)) {
                 data.correlationData = correlationData + i;
@@ -7237,9 +7238,9 @@ class ClSetMemObjectDestructorCallbackTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetMemObjectDestructorCallback)) {
                 data.correlationData = correlationData + i;
@@ -7257,9 +7258,9 @@ class ClSetMemObjectDestructorCallbackTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetMemObjectDestructorCallback)) {
                 data.correlationData = correlationData + i;
@@ -7300,9 +7301,9 @@ class ClSetUserEventStatusTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetUserEventStatus)) {
                 data.correlationData = correlationData + i;
@@ -7320,9 +7321,9 @@ class ClSetUserEventStatusTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clSetUserEventStatus)) {
                 data.correlationData = correlationData + i;
@@ -7359,9 +7360,9 @@ class ClUnloadCompilerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clUnloadCompiler)) {
                 data.correlationData = correlationData + i;
@@ -7379,9 +7380,9 @@ class ClUnloadCompilerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clUnloadCompiler)) {
                 data.correlationData = correlationData + i;
@@ -7419,9 +7420,9 @@ class ClUnloadPlatformCompilerTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clUnloadPlatformCompiler)) {
                 data.correlationData = correlationData + i;
@@ -7439,9 +7440,9 @@ class ClUnloadPlatformCompilerTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clUnloadPlatformCompiler)) {
                 data.correlationData = correlationData + i;
@@ -7482,9 +7483,9 @@ class ClWaitForEventsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clWaitForEvents)) {
                 data.correlationData = correlationData + i;
@@ -7502,9 +7503,9 @@ class ClWaitForEventsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clWaitForEvents)) {
                 data.correlationData = correlationData + i;
@@ -7549,9 +7550,9 @@ class ClCreateFromGlBufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLBuffer)) {
                 data.correlationData = correlationData + i;
@@ -7569,9 +7570,9 @@ class ClCreateFromGlBufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLBuffer)) {
                 data.correlationData = correlationData + i;
@@ -7616,9 +7617,9 @@ class ClCreateFromGlRenderbufferTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLRenderbuffer)) {
                 data.correlationData = correlationData + i;
@@ -7636,9 +7637,9 @@ class ClCreateFromGlRenderbufferTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLRenderbuffer)) {
                 data.correlationData = correlationData + i;
@@ -7687,9 +7688,9 @@ class ClCreateFromGlTextureTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLTexture)) {
                 data.correlationData = correlationData + i;
@@ -7707,9 +7708,9 @@ class ClCreateFromGlTextureTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLTexture)) {
                 data.correlationData = correlationData + i;
@@ -7758,9 +7759,9 @@ class ClCreateFromGlTexture2DTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLTexture2D)) {
                 data.correlationData = correlationData + i;
@@ -7778,9 +7779,9 @@ class ClCreateFromGlTexture2DTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLTexture2D)) {
                 data.correlationData = correlationData + i;
@@ -7829,9 +7830,9 @@ class ClCreateFromGlTexture3DTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLTexture3D)) {
                 data.correlationData = correlationData + i;
@@ -7849,9 +7850,9 @@ class ClCreateFromGlTexture3DTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clCreateFromGLTexture3D)) {
                 data.correlationData = correlationData + i;
@@ -7900,9 +7901,9 @@ class ClEnqueueAcquireGlObjectsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueAcquireGLObjects)) {
                 data.correlationData = correlationData + i;
@@ -7920,9 +7921,9 @@ class ClEnqueueAcquireGlObjectsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueAcquireGLObjects)) {
                 data.correlationData = correlationData + i;
@@ -7971,9 +7972,9 @@ class ClEnqueueReleaseGlObjectsTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReleaseGLObjects)) {
                 data.correlationData = correlationData + i;
@@ -7991,9 +7992,9 @@ class ClEnqueueReleaseGlObjectsTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clEnqueueReleaseGLObjects)) {
                 data.correlationData = correlationData + i;
@@ -8036,9 +8037,9 @@ class ClGetGlObjectInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetGLObjectInfo)) {
                 data.correlationData = correlationData + i;
@@ -8056,9 +8057,9 @@ class ClGetGlObjectInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetGLObjectInfo)) {
                 data.correlationData = correlationData + i;
@@ -8105,9 +8106,9 @@ class ClGetGlTextureInfoTracer {
         data.functionReturnValue = nullptr;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetGLTextureInfo)) {
                 data.correlationData = correlationData + i;
@@ -8125,9 +8126,9 @@ class ClGetGlTextureInfoTracer {
         data.functionReturnValue = retVal;
 
         size_t i = 0;
-        DEBUG_BREAK_IF(tracingHandle[0] == nullptr);
-        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandle[i] != nullptr) {
-            TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(tracingHandleSnapshot->handles[0] == nullptr);
+        while (i < TRACING_MAX_HANDLE_COUNT && tracingHandleSnapshot->handles[i] != nullptr) {
+            TracingHandle *handle = tracingHandleSnapshot->handles[i];
             DEBUG_BREAK_IF(handle == nullptr);
             if (handle->getTracingPoint(CL_FUNCTION_clGetGLTextureInfo)) {
                 data.correlationData = correlationData + i;
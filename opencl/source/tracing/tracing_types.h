@@ -179,6 +179,34 @@ typedef enum _cl_function_id {
 */
 typedef void (*cl_tracing_callback)(cl_function_id fid, cl_callback_data *callbackData, void *userData);
 
+/*!
+    \brief Trace record delivered in batching mode
+
+    Batching mode only observes traced functions, so records carry no
+    function arguments or return values
+*/
+typedef struct _cl_tracing_record {
+    cl_function_id functionId; //!< Identifier of the traced function
+    cl_callback_site site;     //!< Call site, can be ENTER or EXIT
+    cl_uint correlationId;     //!< Correlation identifier, the same for ENTER
+                               //!< and EXIT records
+    cl_uint threadIndex;       //!< Index of the calling thread, unique among
+                               //!< threads traced by the handle
+    cl_ulong timestamp;        //!< Host timestamp in nanoseconds
+} cl_tracing_record;
+
+/*!
+    User-defined batching callback prototype
+    \param[in] records Trace records in the order they were recorded by a
+                       single thread
+    \param[in] recordCount Number of records
+    \param[in] userData User-defined data pointer passed through
+                        clCreateTracingHandleINTEL() function
+
+        Thread Safety: must be guaranteed by customer
+*/
+typedef void (*cl_tracing_batch_callback)(const cl_tracing_record *records, cl_uint recordCount, void *userData);
+
 typedef struct _cl_params_clBuildProgram {
     cl_program *program;
     cl_uint *numDevices;
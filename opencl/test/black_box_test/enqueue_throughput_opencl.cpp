@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "CL/cl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+void checkError(cl_int err, const char *message) {
+    if (err != CL_SUCCESS) {
+        cout << "Error " << err << ": " << message << endl;
+        abort();
+    }
+}
+
+enum class EnqueueMode {
+    withoutEvents,
+    withEvents,
+    blockedOnUserEvent
+};
+
+const char *getModeName(EnqueueMode mode) {
+    switch (mode) {
+    case EnqueueMode::withoutEvents:
+        return "without events";
+    case EnqueueMode::withEvents:
+        return "with events";
+    default:
+        return "blocked on user event";
+    }
+}
+
+double measureEnqueueThroughput(cl_context context, cl_command_queue queue, cl_kernel kernel, EnqueueMode mode, uint32_t enqueueCount) {
+    size_t gws[3] = {1, 1, 1};
+    vector<cl_event> events;
+    events.reserve(enqueueCount);
+
+    cl_event userEvent = nullptr;
+    cl_int err = CL_SUCCESS;
+    if (mode == EnqueueMode::blockedOnUserEvent) {
+        userEvent = clCreateUserEvent(context, &err);
+        checkError(err, "clCreateUserEvent");
+    }
+
+    auto start = chrono::steady_clock::now();
+    for (uint32_t i = 0; i < enqueueCount; i++) {
+        cl_event *outEvent = nullptr;
+        if (mode != EnqueueMode::withoutEvents) {
+            events.push_back(nullptr);
+            outEvent = &events.back();
+        }
+        cl_uint numEventsInWaitList = userEvent ? 1u : 0u;
+        const cl_event *eventWaitList = userEvent ? &userEvent : nullptr;
+        err = clEnqueueNDRangeKernel(queue, kernel, 1, nullptr, gws, nullptr, numEventsInWaitList, eventWaitList, outEvent);
+        checkError(err, "clEnqueueNDRangeKernel");
+    }
+    for (auto event : events) {
+        clReleaseEvent(event);
+    }
+    auto end = chrono::steady_clock::now();
+
+    if (userEvent) {
+        err = clSetUserEventStatus(userEvent, CL_COMPLETE);
+        checkError(err, "clSetUserEventStatus");
+    }
+    err = clFinish(queue);
+    checkError(err, "clFinish");
+    if (userEvent) {
+        clReleaseEvent(userEvent);
+    }
+
+    auto seconds = chrono::duration<double>(end - start).count();
+    return enqueueCount / seconds;
+}
+
+int main(int argc, char **argv) {
+    uint32_t enqueueCount = 100000u;
+    uint32_t blockedEnqueueCount = 10000u;
+    uint32_t iterations = 5u;
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "-n") == 0) {
+            enqueueCount = static_cast<uint32_t>(max(atoi(argv[i + 1]), 1));
+        } else if (strcmp(argv[i], "-b") == 0) {
+            blockedEnqueueCount = static_cast<uint32_t>(max(atoi(argv[i + 1]), 1));
+        } else if (strcmp(argv[i], "-i") == 0) {
+            iterations = static_cast<uint32_t>(max(atoi(argv[i + 1]), 1));
+        }
+    }
+
+    cl_int err = CL_SUCCESS;
+    cl_platform_id platform = nullptr;
+    err = clGetPlatformIDs(1, &platform, nullptr);
+    checkError(err, "clGetPlatformIDs");
+
+    cl_device_id device = nullptr;
+    err = clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, nullptr);
+    checkError(err, "clGetDeviceIDs");
+
+    cl_context context = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &err);
+    checkError(err, "clCreateContext");
+
+    cl_command_queue queue = clCreateCommandQueue(context, device, 0, &err);
+    checkError(err, "clCreateCommandQueue");
+
+    const char *source = "__kernel void empty(){}";
+    cl_program program = clCreateProgramWithSource(context, 1, &source, nullptr, &err);
+    checkError(err, "clCreateProgramWithSource");
+    err = clBuildProgram(program, 1, &device, nullptr, nullptr, nullptr);
+    checkError(err, "clBuildProgram");
+    cl_kernel kernel = clCreateKernel(program, "empty", &err);
+    checkError(err, "clCreateKernel");
+
+    for (auto mode : {EnqueueMode::withoutEvents, EnqueueMode::withEvents, EnqueueMode::blockedOnUserEvent}) {
+        auto count = mode == EnqueueMode::blockedOnUserEvent ? blockedEnqueueCount : enqueueCount;
+        double bestThroughput = 0.0;
+        for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+            bestThroughput = max(bestThroughput, measureEnqueueThroughput(context, queue, kernel, mode, count));
+        }
+        cout << "clEnqueueNDRangeKernel " << getModeName(mode) << ": " << static_cast<uint64_t>(bestThroughput) << " enqueues/s" << endl;
+    }
+
+    clReleaseKernel(kernel);
+    clReleaseProgram(program);
+    clReleaseCommandQueue(queue);
+    clReleaseContext(context);
+    return 0;
+}
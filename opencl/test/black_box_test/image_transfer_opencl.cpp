@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "CL/cl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+using namespace std;
+
+void checkError(cl_int err, const char *message) {
+    if (err != CL_SUCCESS) {
+        cout << "Error " << err << ": " << message << endl;
+        abort();
+    }
+}
+
+struct ImageFormat {
+    cl_image_format format;
+    size_t pixelSize;
+    const char *name;
+};
+
+struct ImageSize {
+    cl_mem_object_type type;
+    size_t width;
+    size_t height;
+    size_t depth;
+};
+
+double elapsedUs(chrono::steady_clock::time_point start, chrono::steady_clock::time_point end) {
+    return chrono::duration<double, micro>(end - start).count();
+}
+
+bool measureImageTransfer(cl_context context, cl_command_queue queue, const ImageFormat &format, const ImageSize &size, uint32_t iterations) {
+    cl_image_desc desc = {};
+    desc.image_type = size.type;
+    desc.image_width = size.width;
+    desc.image_height = size.height;
+    desc.image_depth = size.depth;
+
+    // host row pitch padded, so rows are not contiguous on the host side
+    const size_t hostRowPitch = size.width * format.pixelSize + 64u;
+    const size_t hostSlicePitch = hostRowPitch * size.height;
+    desc.image_row_pitch = hostRowPitch;
+    desc.image_slice_pitch = size.type == CL_MEM_OBJECT_IMAGE3D ? hostSlicePitch : 0u;
+
+    vector<uint8_t> hostData(hostSlicePitch * size.depth);
+    for (size_t i = 0; i < hostData.size(); i++) {
+        hostData[i] = static_cast<uint8_t>(i * 13 + i / 4093);
+    }
+
+    double minCreateUs = numeric_limits<double>::max();
+    double minMapUs = numeric_limits<double>::max();
+    bool validationSuccessful = true;
+    cl_int err = CL_SUCCESS;
+
+    for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+        auto start = chrono::steady_clock::now();
+        cl_mem image = clCreateImage(context, CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, &format.format, &desc, hostData.data(), &err);
+        auto end = chrono::steady_clock::now();
+        checkError(err, "clCreateImage CL_MEM_COPY_HOST_PTR");
+        minCreateUs = min(minCreateUs, elapsedUs(start, end));
+
+        if (iteration == 0) {
+            size_t origin[3] = {0, 0, 0};
+            size_t region[3] = {size.width, size.height, size.depth};
+            vector<uint8_t> readData(hostData.size(), 0u);
+            err = clEnqueueReadImage(queue, image, CL_TRUE, origin, region, hostRowPitch, desc.image_slice_pitch, readData.data(), 0, nullptr, nullptr);
+            checkError(err, "clEnqueueReadImage");
+            for (size_t slice = 0; slice < size.depth; slice++) {
+                for (size_t row = 0; row < size.height; row++) {
+                    auto offset = slice * hostSlicePitch + row * hostRowPitch;
+                    validationSuccessful &= memcmp(readData.data() + offset, hostData.data() + offset, size.width * format.pixelSize) == 0;
+                }
+            }
+        }
+        clReleaseMemObject(image);
+
+        image = clCreateImage(context, CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, &format.format, &desc, hostData.data(), &err);
+        checkError(err, "clCreateImage CL_MEM_USE_HOST_PTR");
+        size_t origin[3] = {0, 0, 0};
+        size_t region[3] = {size.width, size.height, size.depth};
+        size_t rowPitch = 0;
+        size_t slicePitch = 0;
+
+        start = chrono::steady_clock::now();
+        auto mappedPtr = clEnqueueMapImage(queue, image, CL_TRUE, CL_MAP_READ | CL_MAP_WRITE, origin, region, &rowPitch, &slicePitch, 0, nullptr, nullptr, &err);
+        checkError(err, "clEnqueueMapImage");
+        err = clEnqueueUnmapMemObject(queue, image, mappedPtr, 0, nullptr, nullptr);
+        checkError(err, "clEnqueueUnmapMemObject");
+        err = clFinish(queue);
+        checkError(err, "clFinish");
+        end = chrono::steady_clock::now();
+        minMapUs = min(minMapUs, elapsedUs(start, end));
+
+        clReleaseMemObject(image);
+    }
+
+    const auto imageSizeMB = static_cast<double>(size.width * size.height * size.depth * format.pixelSize) / (1024 * 1024);
+    cout << format.name << " " << size.width << "x" << size.height << "x" << size.depth << " (" << imageSizeMB << " MB)"
+         << ": clCreateImage COPY_HOST_PTR " << minCreateUs << " us"
+         << ", map/unmap USE_HOST_PTR " << minMapUs << " us"
+         << (validationSuccessful ? "" : " VALIDATION FAILED") << endl;
+    return validationSuccessful;
+}
+
+int main(int argc, char **argv) {
+    uint32_t iterations = 5u;
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "-i") == 0) {
+            iterations = static_cast<uint32_t>(max(atoi(argv[i + 1]), 1));
+        }
+    }
+
+    cl_int err = CL_SUCCESS;
+    cl_platform_id platform = nullptr;
+    err = clGetPlatformIDs(1, &platform, nullptr);
+    checkError(err, "clGetPlatformIDs");
+
+    cl_device_id device = nullptr;
+    err = clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, nullptr);
+    checkError(err, "clGetDeviceIDs");
+
+    cl_context context = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &err);
+    checkError(err, "clCreateContext");
+
+    cl_command_queue queue = clCreateCommandQueue(context, device, 0, &err);
+    checkError(err, "clCreateCommandQueue");
+
+    const ImageFormat formats[] = {
+        {{CL_R, CL_UNORM_INT8}, 1u, "CL_R/CL_UNORM_INT8"},
+        {{CL_RGBA, CL_UNORM_INT8}, 4u, "CL_RGBA/CL_UNORM_INT8"},
+        {{CL_RGBA, CL_FLOAT}, 16u, "CL_RGBA/CL_FLOAT"}};
+    const ImageSize sizes[] = {
+        {CL_MEM_OBJECT_IMAGE2D, 256u, 256u, 1u},
+        {CL_MEM_OBJECT_IMAGE2D, 1920u, 1080u, 1u},
+        {CL_MEM_OBJECT_IMAGE2D, 4096u, 4096u, 1u},
+        {CL_MEM_OBJECT_IMAGE3D, 64u, 64u, 64u},
+        {CL_MEM_OBJECT_IMAGE3D, 256u, 256u, 128u}};
+
+    bool validationSuccessful = true;
+    for (auto &format : formats) {
+        for (auto &size : sizes) {
+            validationSuccessful &= measureImageTransfer(context, queue, format, size, iterations);
+        }
+    }
+
+    clReleaseCommandQueue(queue);
+    clReleaseContext(context);
+
+    cout << "\nImage transfer " << (validationSuccessful ? "PASSED" : "FAILED") << endl;
+    return validationSuccessful ? 0 : 1;
+}
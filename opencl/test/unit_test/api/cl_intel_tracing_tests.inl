@@ -940,4 +940,104 @@ TEST_F(IntelClGetDeviceInfoTwoHandlesTracingCollectTest, GivenTwoHandlesWhenTrac
     EXPECT_EQ(2u, exitCount);
 }
 
+struct IntelTracingBatchTest : public IntelTracingTest {
+  protected:
+    static void batchCallback(const cl_tracing_record *records, cl_uint recordCount, void *userData) {
+        auto test = reinterpret_cast<IntelTracingBatchTest *>(userData);
+        test->batchSizes.push_back(recordCount);
+        test->records.insert(test->records.end(), records, records + recordCount);
+    }
+
+    void callTracedFunction() {
+        cl_uint computeUnits = 0;
+        status = clGetDeviceInfo(testedClDevice, CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(computeUnits), &computeUnits, nullptr);
+        EXPECT_EQ(CL_SUCCESS, status);
+    }
+
+    std::vector<cl_uint> batchSizes;
+    std::vector<cl_tracing_record> records;
+};
+
+TEST_F(IntelTracingBatchTest, GivenInvalidParamsWhenSettingBatchCallbackThenInvalidValueErrorIsReturned) {
+    status = clSetTracingBatchCallbackINTEL(nullptr, batchCallback, 1u);
+    EXPECT_EQ(CL_INVALID_VALUE, status);
+
+    status = clCreateTracingHandleINTEL(testedClDevice, callback, this, &handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    status = clSetTracingBatchCallbackINTEL(handle, batchCallback, 0u);
+    EXPECT_EQ(CL_INVALID_VALUE, status);
+
+    status = clSetTracingBatchCallbackINTEL(handle, nullptr, 0u);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    status = clDestroyTracingHandleINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+}
+
+TEST_F(IntelTracingBatchTest, GivenBatchCallbackWhenTracingThenRecordsAreDeliveredInBatchesAndRemainingOnesOnDisable) {
+    status = clCreateTracingHandleINTEL(testedClDevice, callback, this, &handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+    status = clSetTracingPointINTEL(handle, CL_FUNCTION_clGetDeviceInfo, CL_TRUE);
+    EXPECT_EQ(CL_SUCCESS, status);
+    status = clSetTracingBatchCallbackINTEL(handle, batchCallback, 4u);
+    EXPECT_EQ(CL_SUCCESS, status);
+    status = clEnableTracingINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    callTracedFunction();
+    EXPECT_TRUE(batchSizes.empty());
+
+    callTracedFunction();
+    callTracedFunction();
+    ASSERT_EQ(1u, batchSizes.size());
+    EXPECT_EQ(4u, batchSizes[0]);
+
+    status = clDisableTracingINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+    ASSERT_EQ(2u, batchSizes.size());
+    EXPECT_EQ(2u, batchSizes[1]);
+
+    ASSERT_EQ(6u, records.size());
+    for (size_t i = 0; i < records.size(); i += 2) {
+        EXPECT_EQ(CL_FUNCTION_clGetDeviceInfo, records[i].functionId);
+        EXPECT_EQ(CL_CALLBACK_SITE_ENTER, records[i].site);
+        EXPECT_EQ(CL_CALLBACK_SITE_EXIT, records[i + 1].site);
+        EXPECT_EQ(records[i].correlationId, records[i + 1].correlationId);
+        EXPECT_EQ(records[i].threadIndex, records[i + 1].threadIndex);
+        EXPECT_LE(records[i].timestamp, records[i + 1].timestamp);
+    }
+
+    status = clDestroyTracingHandleINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+    EXPECT_EQ(2u, batchSizes.size());
+}
+
+TEST_F(IntelTracingTest, GivenTracingEnabledWhenHandleIsDisabledAndEnabledAgainThenTracingFollowsLatestHandleTable) {
+    status = clCreateTracingHandleINTEL(testedClDevice, callback, this, &handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    EXPECT_EQ(0u, HostSideTracing::tracingState.load() & HostSideTracing::TRACING_STATE_ENABLED_BIT);
+
+    for (int i = 0; i < 3; i++) {
+        status = clEnableTracingINTEL(handle);
+        EXPECT_EQ(CL_SUCCESS, status);
+        EXPECT_NE(0u, HostSideTracing::tracingState.load() & HostSideTracing::TRACING_STATE_ENABLED_BIT);
+
+        EXPECT_TRUE(HostSideTracing::addTracingClient());
+        ASSERT_NE(nullptr, HostSideTracing::tracingHandleSnapshot);
+        EXPECT_EQ(handle->handle, HostSideTracing::tracingHandleSnapshot->handles[0]);
+        HostSideTracing::removeTracingClient();
+        EXPECT_EQ(nullptr, HostSideTracing::tracingHandleSnapshot);
+
+        status = clDisableTracingINTEL(handle);
+        EXPECT_EQ(CL_SUCCESS, status);
+        EXPECT_EQ(0u, HostSideTracing::tracingState.load() & HostSideTracing::TRACING_STATE_ENABLED_BIT);
+        EXPECT_FALSE(HostSideTracing::addTracingClient());
+    }
+
+    status = clDestroyTracingHandleINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+}
+
 } // namespace ULT
@@ -924,6 +924,28 @@ HWTEST_F(CommandQueueTests, givenMultipleCommandQueuesWhenMarkerIsEmittedThenGra
     EXPECT_EQ(commandStreamGraphicsAllocation, commandStreamGraphicsAllocation2);
 }
 
+HWTEST_F(CommandQueueTests, givenDeferredEngineResourcesCreationWhenQueueWithBcsEngineIsCreatedThenBcsEngineAllocationsAreCreated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DeferOsContextInitialization.set(1);
+    DebugManager.flags.DeferEngineResourcesCreation.set(1);
+    DebugManager.flags.EnableBlitterForEnqueueOperations.set(1);
+    DebugManager.flags.DeferCmdQBcsInitialization.set(0);
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo));
+    REQUIRE_FULL_BLITTER_OR_SKIP(device->getRootDeviceEnvironment());
+
+    MockCommandQueueHw<FamilyType> cmdQ(nullptr, device.get(), nullptr);
+    ASSERT_TRUE(cmdQ.bcsQueueEngineType.has_value());
+
+    auto bcsCsr = cmdQ.getBcsCommandStreamReceiver(*cmdQ.bcsQueueEngineType);
+    ASSERT_NE(nullptr, bcsCsr);
+    EXPECT_TRUE(bcsCsr->getOsContext().isInitialized());
+    EXPECT_FALSE(bcsCsr->areEngineAllocationsDeferred());
+    EXPECT_NE(nullptr, bcsCsr->getTagAllocation());
+}
+
 HWTEST_F(CommandQueueTests, givenEngineUsageHintSetWithInvalidValueWhenCreatingCommandQueueThenReturnSuccess) {
     DebugManagerStateRestore restore;
     DebugManager.flags.EngineUsageHint.set(static_cast<int32_t>(EngineUsage::EngineUsageCount));
@@ -668,6 +668,41 @@ TEST(DeviceGetEngineTest, givenDeferredContextInitializationDisabledWhenCreating
     }
 }
 
+TEST(DeviceGetEngineTest, givenDeferredEngineResourcesCreationEnabledWhenCreatingEnginesThenAllocationsOfDeferredContextsAreCreatedOnFirstUse) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.DeferOsContextInitialization.set(1);
+    DebugManager.flags.DeferEngineResourcesCreation.set(1);
+
+    auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
+    EXPECT_NE(0u, device->getAllEngines().size());
+    for (const EngineControl &engine : device->getAllEngines()) {
+        auto csr = engine.commandStreamReceiver;
+        EXPECT_EQ(!engine.osContext->isInitialized(), csr->areEngineAllocationsDeferred());
+        if (!csr->areEngineAllocationsDeferred()) {
+            continue;
+        }
+        EXPECT_EQ(nullptr, csr->getPreemptionAllocation());
+        EXPECT_EQ(nullptr, csr->getGlobalFenceAllocation());
+        EXPECT_NE(nullptr, csr->getTagAllocation());
+
+        EXPECT_TRUE(csr->initializeResources());
+        EXPECT_FALSE(csr->areEngineAllocationsDeferred());
+        EXPECT_TRUE(engine.osContext->isInitialized());
+        EXPECT_EQ(engine.osContext->getPreemptionMode() == PreemptionMode::MidThread, csr->getPreemptionAllocation() != nullptr);
+    }
+}
+
+TEST(DeviceGetEngineTest, givenDeferredEngineResourcesCreationEnabledAndContextsInitializedImmediatelyWhenCreatingEnginesThenAllocationsAreNotDeferred) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.DeferOsContextInitialization.set(0);
+    DebugManager.flags.DeferEngineResourcesCreation.set(1);
+
+    auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
+    for (const EngineControl &engine : device->getAllEngines()) {
+        EXPECT_FALSE(engine.commandStreamReceiver->areEngineAllocationsDeferred());
+    }
+}
+
 TEST(DeviceGetEngineTest, givenNonHwCsrModeWhenGetEngineThenDefaultEngineIsReturned) {
     DebugManagerStateRestore dbgRestorer;
     DebugManager.flags.SetCommandStreamReceiver.set(CommandStreamReceiverType::CSR_AUB);
@@ -55,6 +55,17 @@ TEST(Event, GivenEventWhenCheckingTraitThenEventIsNotAssignable) {
     EXPECT_FALSE(std::is_copy_assignable<Event>::value);
 }
 
+TEST(Event, givenReleasedEventWhenCreatingNewEventThenMemoryOfReleasedEventIsReused) {
+    auto event = new Event(nullptr, CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+    EXPECT_TRUE(isAligned(reinterpret_cast<uintptr_t>(event), MemoryConstants::cacheLineSize));
+    void *releasedEventAddress = event;
+    event->release();
+
+    auto newEvent = new Event(nullptr, CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+    EXPECT_EQ(releasedEventAddress, static_cast<void *>(newEvent));
+    newEvent->release();
+}
+
 TEST(Event, WhenPeekIsCalledThenExecutionIsNotUpdated) {
     auto mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
     MockContext ctx;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -365,3 +365,72 @@ TYPED_TEST(KernelArgImmediateTest, givenMultiplePatchesAndOneSourceOffsetBeyondA
         EXPECT_EQ(CL_SUCCESS, retVal);
     }
 }
+
+TYPED_TEST(KernelArgImmediateTest, givenSingleElementArgumentsWhenKernelIsInitializedThenPatchPlanCoversTheirCrossThreadDataRange) {
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        auto pKernel = this->pKernel[rootDeviceIndex];
+        ASSERT_EQ(4u, pKernel->argPatchPlan.size());
+
+        for (uint32_t argIndex = 0; argIndex < 3; argIndex++) {
+            EXPECT_EQ(this->pKernelInfo->argAsVal(argIndex).elements[0].offset, pKernel->argPatchPlan[argIndex].crossThreadDataOffset);
+            EXPECT_EQ(sizeof(TypeParam), pKernel->argPatchPlan[argIndex].size);
+        }
+        EXPECT_EQ(0u, pKernel->argPatchPlan[3].size);
+    }
+}
+
+TYPED_TEST(KernelArgImmediateTest, givenPatchedArgumentWhenSettingItAgainWithSameSizeThenValueIsStoredWithoutChangingArgumentState) {
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        auto pKernel = this->pKernel[rootDeviceIndex];
+        auto pKernelArg = reinterpret_cast<TypeParam *>(pKernel->getCrossThreadData() + this->pKernelInfo->argAsVal(1).elements[0].offset);
+
+        auto val = static_cast<TypeParam>(0xaaaaaaaaULL);
+        EXPECT_EQ(CL_SUCCESS, pKernel->setArg(1, sizeof(TypeParam), &val));
+        EXPECT_EQ(val, *pKernelArg);
+
+        auto argInfoBefore = pKernel->getKernelArgInfo(1);
+
+        val = static_cast<TypeParam>(0xbbbbbbbbULL);
+        EXPECT_EQ(CL_SUCCESS, pKernel->setArg(1, sizeof(TypeParam), &val));
+        EXPECT_EQ(val, *pKernelArg);
+
+        auto &argInfoAfter = pKernel->getKernelArgInfo(1);
+        EXPECT_TRUE(argInfoAfter.isPatched);
+        EXPECT_EQ(argInfoBefore.size, argInfoAfter.size);
+        EXPECT_EQ(argInfoBefore.type, argInfoAfter.type);
+        EXPECT_FALSE(pKernel->isPatched());
+    }
+}
+
+TYPED_TEST(KernelArgImmediateTest, givenPatchedArgumentWhenSettingItAgainWithDifferentSizeThenArgumentIsSetThroughHandler) {
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        auto pKernel = this->pKernel[rootDeviceIndex];
+        auto pKernelArg = reinterpret_cast<TypeParam *>(pKernel->getCrossThreadData() + this->pKernelInfo->argAsVal(0).elements[0].offset);
+
+        TypeParam memory[2];
+        std::memset(&memory[0], 0xaa, sizeof(TypeParam));
+        std::memset(&memory[1], 0xbb, sizeof(TypeParam));
+        EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(TypeParam), &memory[0]));
+        EXPECT_EQ(sizeof(TypeParam), pKernel->getKernelArgInfo(0).size);
+
+        EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(memory), &memory[1]));
+        EXPECT_EQ(sizeof(memory), pKernel->getKernelArgInfo(0).size);
+        EXPECT_EQ(memory[1], *pKernelArg);
+    }
+}
+
+TYPED_TEST(KernelArgImmediateTest, givenUnsetArgumentWhenSettingItAgainThenArgumentIsMarkedAsPatched) {
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        auto pKernel = this->pKernel[rootDeviceIndex];
+
+        auto val = static_cast<TypeParam>(0xaaaaaaaaULL);
+        EXPECT_EQ(CL_SUCCESS, pKernel->setArg(2, sizeof(TypeParam), &val));
+        EXPECT_TRUE(pKernel->getKernelArgInfo(2).isPatched);
+
+        pKernel->unsetArg(2);
+        EXPECT_FALSE(pKernel->getKernelArgInfo(2).isPatched);
+
+        EXPECT_EQ(CL_SUCCESS, pKernel->setArg(2, sizeof(TypeParam), &val));
+        EXPECT_TRUE(pKernel->getKernelArgInfo(2).isPatched);
+    }
+}
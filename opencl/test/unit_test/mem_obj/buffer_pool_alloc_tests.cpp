@@ -6,7 +6,7 @@
  */
 
 #include "shared/source/helpers/gfx_core_helper.h"
-#include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/pool_chunk_allocator.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/test_macros/hw_test.h"
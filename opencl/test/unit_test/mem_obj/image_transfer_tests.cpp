@@ -190,3 +190,25 @@ TEST_F(ImageHostPtrTransferTests, given1dArrayImageWhenTransferFromHostPtrCalled
 
     EXPECT_TRUE(memcmp(image->getCpuAddress(), expectedImageData.get(), imageSlicePitch * imgDesc->image_array_size) == 0);
 }
+
+TEST_F(ImageHostPtrTransferTests, givenCpuCopyEngineForImageTransferDisabledWhenTransferFromHostPtrCalledThenCopyRequestedRegionAndOriginOnly) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ForceLinearImages.set(true);
+    DebugManager.flags.UseCpuCopyEngineForImageTransfer.set(0);
+
+    createImageAndSetTestParams<Image3dDefaults>();
+
+    std::array<size_t, 3> copyOrigin = {{imgDesc->image_width / 2, imgDesc->image_height / 2, imgDesc->image_depth / 2}};
+    std::array<size_t, 3> copyRegion = copyOrigin;
+
+    std::unique_ptr<uint8_t> expectedImageData(new uint8_t[imageSlicePitch * imgDesc->image_depth]);
+    memset(image->getHostPtr(), 123, hostPtrSlicePitch * imgDesc->image_depth);
+    memset(expectedImageData.get(), 0, imageSlicePitch * imgDesc->image_depth);
+    memset(image->getCpuAddress(), 0, imageSlicePitch * imgDesc->image_depth);
+
+    setExpectedData(expectedImageData.get(), imageSlicePitch, imageRowPitch, copyOrigin, copyRegion);
+
+    image->transferDataFromHostPtr(copyRegion, copyOrigin);
+
+    EXPECT_TRUE(memcmp(image->getCpuAddress(), expectedImageData.get(), imageSlicePitch * imgDesc->image_depth) == 0);
+}
@@ -97,6 +97,7 @@ class MockKernel : public Kernel {
     using Kernel::addAllocationToCacheFlushVector;
     using Kernel::allBufferArgsStateful;
     using Kernel::anyKernelArgumentUsingSystemMemory;
+    using Kernel::argPatchPlan;
     using Kernel::auxTranslationRequired;
     using Kernel::containsStatelessWrites;
     using Kernel::dataParameterSimdSize;
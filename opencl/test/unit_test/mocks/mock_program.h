@@ -62,6 +62,7 @@ class MockProgram : public Program {
     using Program::irBinarySize;
     using Program::isBuiltIn;
     using Program::isCreatedFromBinary;
+    using Program::isSameCompileTarget;
     using Program::isSpirV;
     using Program::kernelDebugEnabled;
     using Program::linkBinary;
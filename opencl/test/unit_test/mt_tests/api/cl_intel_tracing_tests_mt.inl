@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -122,4 +122,107 @@ TEST_F(IntelTracingMtTest, WhenTracingFromMultipleThreadsThenAllThreadsAreCreate
     EXPECT_EQ(numThreads * iterationCount * callsPerIteration * callbacksPerCall, count);
 }
 
+struct IntelTracingBatchMtTest : public IntelTracingMtTest {
+  protected:
+    static void batchCallback(const cl_tracing_record *records, cl_uint recordCount, void *userData) {
+        auto test = reinterpret_cast<IntelTracingBatchMtTest *>(userData);
+        for (cl_uint i = 0; i < recordCount; i++) {
+            if (records[i].functionId == CL_FUNCTION_clGetDeviceInfo ||
+                records[i].functionId == CL_FUNCTION_clGetPlatformInfo) {
+                ++test->count;
+            }
+        }
+    }
+};
+
+TEST_F(IntelTracingBatchMtTest, WhenTracingInBatchingModeFromMultipleThreadsThenAllRecordsAreDelivered) {
+    status = clCreateTracingHandleINTEL(testedClDevice, callback, this, &handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    status = clSetTracingPointINTEL(handle, CL_FUNCTION_clGetDeviceInfo, CL_TRUE);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    status = clSetTracingPointINTEL(handle, CL_FUNCTION_clGetPlatformInfo, CL_TRUE);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    status = clSetTracingBatchCallbackINTEL(handle, batchCallback, 100u);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    status = clEnableTracingINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    int numThreads = 4;
+    int iterationCount = 1024;
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < numThreads; ++i) {
+        threads.push_back(std::thread(threadBody, iterationCount, this));
+    }
+
+    started = true;
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    status = clDisableTracingINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    status = clDestroyTracingHandleINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    int callsPerIteration = 4;
+    int recordsPerCall = 2;
+    EXPECT_EQ(numThreads * iterationCount * callsPerIteration * recordsPerCall, count);
+}
+
+TEST_F(IntelTracingMtTest, WhenTracingIsEnabledAndDisabledWhileOtherThreadsCallApiThenCallbacksAreCalledInPairs) {
+    std::atomic<int> enterCount{0};
+    std::atomic<int> exitCount{0};
+    struct Counters {
+        std::atomic<int> *enterCount;
+        std::atomic<int> *exitCount;
+    } counters = {&enterCount, &exitCount};
+
+    auto countingCallback = [](cl_function_id fid, cl_callback_data *callbackData, void *userData) {
+        auto counters = reinterpret_cast<Counters *>(userData);
+        if (callbackData->site == CL_CALLBACK_SITE_ENTER) {
+            ++(*counters->enterCount);
+        } else {
+            ++(*counters->exitCount);
+        }
+    };
+
+    status = clCreateTracingHandleINTEL(testedClDevice, countingCallback, &counters, &handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    status = clSetTracingPointINTEL(handle, CL_FUNCTION_clGetDeviceInfo, CL_TRUE);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    int numThreads = 4;
+    int iterationCount = 256;
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < numThreads; ++i) {
+        threads.push_back(std::thread(threadBody, iterationCount, this));
+    }
+
+    started = true;
+
+    for (int i = 0; i < 64; ++i) {
+        status = clEnableTracingINTEL(handle);
+        EXPECT_EQ(CL_SUCCESS, status);
+        status = clDisableTracingINTEL(handle);
+        EXPECT_EQ(CL_SUCCESS, status);
+        EXPECT_EQ(enterCount.load(), exitCount.load());
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    status = clDestroyTracingHandleINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+}
+
 } // namespace ULT
\ No newline at end of file
@@ -61,6 +61,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -3259,6 +3260,85 @@ TEST(BuildProgramTest, givenMultiDeviceProgramWhenBuildingThenStoreAndProcessBin
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+struct MockCompilerInterfaceCountingBuilds : MockCompilerInterfaceCaptureBuildOptions {
+    TranslationOutput::ErrorCode build(const NEO::Device &device, const TranslationInput &input, TranslationOutput &out) override {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            builtDevices.push_back(&device);
+        }
+        return MockCompilerInterfaceCaptureBuildOptions::build(device, input, out);
+    }
+
+    std::mutex mtx;
+    std::vector<const NEO::Device *> builtDevices;
+};
+
+TEST(BuildProgramTest, givenMultiDeviceProgramWithIdenticalRootDevicesWhenBuildingThenBinaryIsCompiledOnceAndCopiedToEachRootDevice) {
+    MockUnrestrictiveContextMultiGPU context;
+    auto cip = new MockCompilerInterfaceCountingBuilds();
+    const char binary[] = "binary";
+    cip->output.intermediateRepresentation.mem = makeCopy(binary, sizeof(binary));
+    cip->output.intermediateRepresentation.size = sizeof(binary);
+    auto defaultDevice = context.getDevice(0);
+    defaultDevice->getExecutionEnvironment()->rootDeviceEnvironments[defaultDevice->getRootDeviceIndex()]->compilerInterface.reset(cip);
+
+    const char *sources[] = {"some source code"};
+    size_t sourceSize = strlen(sources[0]);
+    cl_int retVal = CL_INVALID_PROGRAM;
+    auto pProgram = Program::create<SucceedingGenBinaryProgram>(&context, 1, sources, &sourceSize, retVal);
+    ASSERT_NE(nullptr, pProgram);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = pProgram->build(pProgram->getDevices(), nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    ASSERT_EQ(1u, cip->builtDevices.size());
+    EXPECT_EQ(&defaultDevice->getDevice(), cip->builtDevices[0]);
+
+    const char *firstBinary = nullptr;
+    for (auto &rootDeviceIndex : context.getRootDeviceIndices()) {
+        auto &buildInfo = pProgram->buildInfos[rootDeviceIndex];
+        EXPECT_EQ(1, pProgram->replaceDeviceBinaryCalledPerRootDevice[rootDeviceIndex]);
+        ASSERT_EQ(sizeof(binary), buildInfo.packedDeviceBinarySize);
+        EXPECT_EQ(0, memcmp(binary, buildInfo.packedDeviceBinary.get(), sizeof(binary)));
+        EXPECT_NE(firstBinary, buildInfo.packedDeviceBinary.get());
+        firstBinary = buildInfo.packedDeviceBinary.get();
+    }
+    pProgram->release();
+}
+
+TEST(BuildProgramTest, givenDevicesWhenCheckingCompileTargetThenDevicesDifferingInAnyCompilerInputAreDistinctTargets) {
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    std::unique_ptr<MockDevice> otherDevice(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    auto &hwInfo = *device->getRootDeviceEnvironmentRef().getMutableHardwareInfo();
+    auto &otherHwInfo = *otherDevice->getRootDeviceEnvironmentRef().getMutableHardwareInfo();
+    EXPECT_TRUE(MockProgram::isSameCompileTarget(*device, *otherDevice));
+
+    otherHwInfo.platform.usRevId++;
+    EXPECT_FALSE(MockProgram::isSameCompileTarget(*device, *otherDevice));
+
+    otherHwInfo = hwInfo;
+    otherHwInfo.ipVersion.value++;
+    EXPECT_FALSE(MockProgram::isSameCompileTarget(*device, *otherDevice));
+
+    otherHwInfo = hwInfo;
+    otherHwInfo.capabilityTable.clVersionSupport++;
+    EXPECT_FALSE(MockProgram::isSameCompileTarget(*device, *otherDevice));
+
+    otherHwInfo = hwInfo;
+    otherHwInfo.featureTable.flags.ftrLocalMemory = !hwInfo.featureTable.flags.ftrLocalMemory;
+    EXPECT_FALSE(MockProgram::isSameCompileTarget(*device, *otherDevice));
+
+    otherHwInfo = hwInfo;
+    otherHwInfo.gtSystemInfo.EUCount++;
+    EXPECT_FALSE(MockProgram::isSameCompileTarget(*device, *otherDevice));
+
+    otherHwInfo = hwInfo;
+    EXPECT_TRUE(MockProgram::isSameCompileTarget(*device, *otherDevice));
+    otherDevice->deviceInfo.outProfilingTimerResolution++;
+    EXPECT_FALSE(MockProgram::isSameCompileTarget(*device, *otherDevice));
+}
+
 TEST(BuildProgramTest, givenMultiDeviceProgramWhenBuildingThenStoreKernelInfoPerEachRootDevice) {
     MockProgram *pProgram = nullptr;
     std::unique_ptr<char[]> pSource = nullptr;
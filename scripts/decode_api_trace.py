@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (C) 2023 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+
+# Renders binary API trace written with LogApiCallsBinary=1 in the LogApiCalls text format.
+# Usage: decode_api_trace.py igdrcl.log.bin [--timestamps]
+
+import struct
+import sys
+
+MAGIC = b"NEOTRC01"
+RECORD = struct.Struct("<QIIiB3x")
+
+FUNCTION_NAME = 0
+API_ENTER = 1
+API_LEAVE = 2
+DROPPED = 3
+
+
+def decode(data, with_timestamps):
+    if not data.startswith(MAGIC):
+        raise ValueError("not a binary API trace")
+
+    names = {}
+    offset = len(MAGIC)
+    while offset + RECORD.size <= len(data):
+        timestamp, thread_id, function_id, value, record_type = RECORD.unpack_from(data, offset)
+        offset += RECORD.size
+
+        if record_type == FUNCTION_NAME:
+            names[function_id] = data[offset:offset + value].decode()
+            offset += value
+        elif record_type in (API_ENTER, API_LEAVE):
+            prefix = "[%d] " % timestamp if with_timestamps else ""
+            if record_type == API_ENTER:
+                action = "Function Enter: "
+            else:
+                action = "Function Leave (%d): " % value
+            yield "%sThreadID: %d %s%s" % (prefix, thread_id, action, names.get(function_id, ""))
+        elif record_type == DROPPED:
+            yield "Dropped records: %d" % value
+        else:
+            raise ValueError("unknown record type %d at offset %d" % (record_type, offset - RECORD.size))
+
+
+def main(args):
+    if len(args) < 1:
+        print("Usage: decode_api_trace.py <trace file> [--timestamps]")
+        return 1
+    with open(args[0], "rb") as trace:
+        data = trace.read()
+    for line in decode(data, "--timestamps" in args[1:]):
+        print(line)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -66,6 +66,11 @@ struct EncodeDispatchKernelArgs {
     bool isKernelDispatchedFromImmediateCmdList = false;
     bool isRcs = false;
     bool dcFlushEnable = false;
+
+    // locations of encoded cross thread data, filled in by encode
+    void *outCrossThreadDataPtr = nullptr;
+    void *outInlineDataPtr = nullptr;
+    uint32_t outInlineDataSize = 0u;
 };
 
 enum class MiPredicateType : uint32_t {
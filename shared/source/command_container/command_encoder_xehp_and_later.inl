@@ -74,41 +74,68 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     WALKER_TYPE walkerCmd = Family::cmdInitGpgpuWalker;
     auto &idd = walkerCmd.getInterfaceDescriptor();
 
-    EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
-                                             sizePerThreadData, hwInfo);
-    auto &productHelper = args.device->getProductHelper();
-    productHelper.updateIddCommand(&idd, kernelDescriptor.kernelAttributes.numGrfRequired,
-                                   kernelDescriptor.kernelAttributes.threadArbitrationPolicy);
-
     bool localIdsGenerationByRuntime = args.dispatchInterface->requiresGenerationOfLocalIdsByRuntime();
     auto requiredWorkgroupOrder = args.dispatchInterface->getRequiredWorkgroupOrder();
     bool inlineDataProgramming = EncodeDispatchKernel<Family>::inlineDataProgrammingRequired(kernelDescriptor);
-    {
-        auto alloc = args.dispatchInterface->getIsaAllocation();
-        UNRECOVERABLE_IF(nullptr == alloc);
-        auto offset = alloc->getGpuAddressToPatch();
-        if (!localIdsGenerationByRuntime) {
-            offset += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
-        }
-        idd.setKernelStartPointer(offset);
+
+    auto alloc = args.dispatchInterface->getIsaAllocation();
+    UNRECOVERABLE_IF(nullptr == alloc);
+    auto kernelStartPointer = alloc->getGpuAddressToPatch() + args.dispatchInterface->getIsaOffsetInParentAllocation();
+    if (!localIdsGenerationByRuntime) {
+        kernelStartPointer += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
     }
 
     auto threadsPerThreadGroup = args.dispatchInterface->getNumThreadsPerThreadGroup();
-    idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
-    idd.setDenormMode(INTERFACE_DESCRIPTOR_DATA::DENORM_MODE_SETBYKERNEL);
 
-    EncodeDispatchKernel<Family>::programBarrierEnable(idd,
-                                                       kernelDescriptor.kernelAttributes.barrierCount,
-                                                       hwInfo);
+    static_assert(sizeof(INTERFACE_DESCRIPTOR_DATA) <= InterfaceDescriptorTemplate::maxInterfaceDescriptorSize);
+    InterfaceDescriptorTemplate *iddTemplate = nullptr;
+    InterfaceDescriptorTemplate::Key iddTemplateKey = {};
+    if (DebugManager.flags.EnableInterfaceDescriptorTemplates.get() != 0) {
+        iddTemplate = args.dispatchInterface->getInterfaceDescriptorTemplate();
+    }
+    if (iddTemplate) {
+        iddTemplateKey.kernelStartPointer = kernelStartPointer;
+        iddTemplateKey.threadsPerThreadGroup = threadsPerThreadGroup;
+        iddTemplateKey.slmTotalSize = args.dispatchInterface->getSlmTotalSize();
+        iddTemplateKey.crossThreadDataSize = sizeCrossThreadData;
+        iddTemplateKey.perThreadDataSize = sizePerThreadData;
+        iddTemplateKey.numGrf = kernelDescriptor.kernelAttributes.numGrfRequired;
+        iddTemplateKey.barrierCount = kernelDescriptor.kernelAttributes.barrierCount;
+        iddTemplateKey.slmSizeOverride = DebugManager.flags.OverrideSlmAllocationSize.get();
+        iddTemplateKey.threadArbitrationPolicy = static_cast<uint32_t>(kernelDescriptor.kernelAttributes.threadArbitrationPolicy);
+        iddTemplateKey.preemptionMode = static_cast<uint32_t>(args.preemptionMode);
+    }
+
+    if (iddTemplate == nullptr || !iddTemplate->load(iddTemplateKey, &idd, sizeof(idd))) {
+        EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
+                                                 sizePerThreadData, hwInfo);
+        auto &productHelper = args.device->getProductHelper();
+        productHelper.updateIddCommand(&idd, kernelDescriptor.kernelAttributes.numGrfRequired,
+                                       kernelDescriptor.kernelAttributes.threadArbitrationPolicy);
+
+        idd.setKernelStartPointer(kernelStartPointer);
+        idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
+        idd.setDenormMode(INTERFACE_DESCRIPTOR_DATA::DENORM_MODE_SETBYKERNEL);
+
+        EncodeDispatchKernel<Family>::programBarrierEnable(idd,
+                                                           kernelDescriptor.kernelAttributes.barrierCount,
+                                                           hwInfo);
+
+        auto &gfxCoreHelper = args.device->getGfxCoreHelper();
+        auto slmSize = static_cast<SHARED_LOCAL_MEMORY_SIZE>(
+            gfxCoreHelper.computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize()));
+
+        if (DebugManager.flags.OverrideSlmAllocationSize.get() != -1) {
+            slmSize = static_cast<SHARED_LOCAL_MEMORY_SIZE>(DebugManager.flags.OverrideSlmAllocationSize.get());
+        }
+        idd.setSharedLocalMemorySize(slmSize);
 
-    auto &gfxCoreHelper = args.device->getGfxCoreHelper();
-    auto slmSize = static_cast<SHARED_LOCAL_MEMORY_SIZE>(
-        gfxCoreHelper.computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize()));
+        PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, args.preemptionMode);
 
-    if (DebugManager.flags.OverrideSlmAllocationSize.get() != -1) {
-        slmSize = static_cast<SHARED_LOCAL_MEMORY_SIZE>(DebugManager.flags.OverrideSlmAllocationSize.get());
+        if (iddTemplate) {
+            iddTemplate->store(iddTemplateKey, &idd, sizeof(idd));
+        }
     }
-    idd.setSharedLocalMemorySize(slmSize);
 
     auto bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
     uint32_t bindingTablePointer = 0u;
@@ -129,8 +156,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     }
     idd.setBindingTablePointer(bindingTablePointer);
 
-    PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, args.preemptionMode);
-
     uint32_t samplerCount = 0;
 
     if constexpr (Family::supportsSampler) {
@@ -175,6 +200,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         sizeCrossThreadData -= inlineDataProgrammingOffset;
         crossThreadData = ptrOffset(crossThreadData, inlineDataProgrammingOffset);
         inlineDataProgramming = inlineDataProgrammingOffset != 0;
+        args.outInlineDataSize = inlineDataProgrammingOffset;
     }
 
     uint32_t sizeThreadData = sizePerThreadDataForWholeGroup + sizeCrossThreadData;
@@ -199,6 +225,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             ptr = NEO::ImplicitArgsHelper::patchImplicitArgs(ptr, *pImplicitArgs, kernelDescriptor, std::make_pair(localIdsGenerationByRuntime, requiredWorkgroupOrder));
         }
 
+        args.outCrossThreadDataPtr = ptr;
         if (sizeCrossThreadData > 0) {
             memcpy_s(ptr, sizeCrossThreadData,
                      crossThreadData, sizeCrossThreadData);
@@ -331,6 +358,9 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         args.partitionCount = 1;
         auto buffer = listCmdBufferStream->getSpace(sizeof(walkerCmd));
         *(decltype(walkerCmd) *)buffer = walkerCmd;
+        if (inlineDataProgramming) {
+            args.outInlineDataPtr = reinterpret_cast<decltype(walkerCmd) *>(buffer)->getInlineDataPointer();
+        }
     }
 
     PreemptionHelper::applyPreemptionWaCmdsEnd<Family>(listCmdBufferStream, *args.device);
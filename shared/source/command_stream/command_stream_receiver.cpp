@@ -25,6 +25,7 @@
 #include "shared/source/gmm_helper/page_table_mngr.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/array_count.h"
+#include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/flat_batch_buffer_helper.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/gfx_core_helper.h"
@@ -276,6 +277,20 @@ bool CommandStreamReceiver::initializeResources() {
             if (!osContext->ensureContextInitialized()) {
                 return false;
             }
+            if (this->engineAllocationsDeferred) {
+                if (!createEngineAllocations()) {
+                    return false;
+                }
+                this->engineAllocationsDeferred = false;
+
+                if (DebugManager.flags.PrintEngineResourcesCreation.get()) {
+                    printf("Engine allocations created on first use: contextId=%u usage=%s type=%s size=%zu\n",
+                           osContext->getContextId(),
+                           EngineHelpers::engineUsageToString(osContext->getEngineUsage()).c_str(),
+                           EngineHelpers::engineTypeToString(osContext->getEngineType()).c_str(),
+                           getEngineAllocationsSize());
+                }
+            }
             this->fillReusableAllocationsList();
             this->resourcesInitialized = true;
         }
@@ -824,6 +839,29 @@ bool CommandStreamReceiver::createPreemptionAllocation() {
     return this->preemptionAllocation != nullptr;
 }
 
+bool CommandStreamReceiver::createEngineAllocations() {
+    if (!createGlobalFenceAllocation()) {
+        return false;
+    }
+
+    createKernelArgsBufferAllocation();
+
+    if (osContext->getPreemptionMode() == PreemptionMode::MidThread && !createPreemptionAllocation()) {
+        return false;
+    }
+    return true;
+}
+
+size_t CommandStreamReceiver::getEngineAllocationsSize() const {
+    size_t size = 0u;
+    for (auto allocation : {globalFenceAllocation, kernelArgsBufferAllocation, preemptionAllocation}) {
+        if (allocation) {
+            size += allocation->getUnderlyingBufferSize();
+        }
+    }
+    return size;
+}
+
 std::unique_lock<CommandStreamReceiver::MutexType> CommandStreamReceiver::obtainUniqueOwnership() {
     return std::unique_lock<CommandStreamReceiver::MutexType>(this->ownershipMutex);
 }
@@ -213,6 +213,10 @@ class CommandStreamReceiver {
     MOCKABLE_VIRTUAL bool createPreemptionAllocation();
     MOCKABLE_VIRTUAL bool createPerDssBackedBuffer(Device &device);
     virtual void createKernelArgsBufferAllocation() = 0;
+    bool createEngineAllocations();
+    size_t getEngineAllocationsSize() const;
+    void deferEngineAllocations() { engineAllocationsDeferred = true; }
+    bool areEngineAllocationsDeferred() const { return engineAllocationsDeferred; }
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<MutexType> obtainUniqueOwnership();
 
     bool peekTimestampPacketWriteEnabled() const { return timestampPacketWriteEnabled; }
@@ -539,6 +543,7 @@ class CommandStreamReceiver {
     bool dcFlushSupport = false;
     bool forceSkipResourceCleanupRequired = false;
     volatile bool resourcesInitialized = false;
+    bool engineAllocationsDeferred = false;
     bool doubleSbaWa = false;
 };
 
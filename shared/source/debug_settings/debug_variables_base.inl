@@ -129,6 +129,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, GpuScratchRegWriteAfterWalker, -1, "-1: disabled
 DECLARE_DEBUG_VARIABLE(int32_t, GpuScratchRegWriteRegisterOffset, 0, "register offset for GPU scratch register write after walker")
 DECLARE_DEBUG_VARIABLE(int32_t, GpuScratchRegWriteRegisterData, 0, "register data for GPU scratch register write after walker")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideSlmAllocationSize, -1, "-1: default, >=0: program value for shared local memory size")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableInterfaceDescriptorTemplates, -1, "-1: default, 0: program interface descriptor data on every dispatch, 1: reuse per kernel interface descriptor templates")
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerLogBitmask, 0, "0: logs disabled, 1 - INFO, 2 - ERROR, 1<<10 - Dump elf, see DebugVariables::DEBUGGER_LOG_BITMASK")
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerOptDisable, -1, "-1: default from debugger query, 0: do not add opt-disable, 1: add opt-disable")
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerForceSbaTrackingMode, -1, "-1: default, 0: per context address spaces, 1: single address space")
@@ -215,6 +216,16 @@ DECLARE_DEBUG_VARIABLE(int32_t, SetVmAdviseAtomicAttribute, -1, "-1: default - a
 DECLARE_DEBUG_VARIABLE(int32_t, SetVmAdvisePreferredLocation, -1, "-1: default - device, 0: system, 1: device, 2: none. Set preferred location for kmd-migrated shared allocation")
 DECLARE_DEBUG_VARIABLE(int32_t, ReadBackCommandBufferAllocation, -1, "Read command buffer allocation back on the host side. -1: default, 0 - disabled, 1 - local memory only, 2 - local and system memory")
 DECLARE_DEBUG_VARIABLE(int32_t, UseContextEndOffsetForEventCompletion, -1, "Use Context End or Context Start for event completion signalling. -1: default: platform dependent, 0 - Use Context Start, 1 - Use Context End")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEventPoolRecycling, -1, "-1: default (disabled), 0: disabled, >0: max number of allocations of destroyed L0 event pools kept per driver and reused by new event pools of the same size, flags and devices")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableModuleIsaPacking, -1, "-1: default (disabled), 0: disabled, >0: pack ISA of L0 user module kernels into shared allocations of at most given size in KB, each uploaded with one transfer")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanDrmClientIndex, -1, "-1: default (disabled), 0: disabled, 1: keep index of DRM clients between Sysman process state queries and re-read only data that can change, >1: additionally stop refreshing known clients after given time in microseconds and report them from the index")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDebuggerStateSaveAreaCache, -1, "-1: default (disabled), 0: disabled, 1: L0 debugger reads only state save area slots of threads being resumed and caches thread slots for register reads until the thread is resumed")
+DECLARE_DEBUG_VARIABLE(int32_t, UseCpuCopyEngineForImageTransfer, -1, "-1: default (enabled), 0: disabled, 1: enabled. Copy host pointer image regions with CPU copy engine, which coalesces contiguous rows and splits large copies across worker threads")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableGmmResourceInfoCache, -1, "-1: default (disabled), 0: disabled, 1: enabled with default capacity (256 entries), >1: enabled with given capacity. Reuse GMM resource descriptions created for identical resource creation parameters within root device")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelProgramBuild, -1, "-1: default (enabled), 0: disabled, 1: enabled. Build OpenCL program for devices with distinct hardware concurrently")
+DECLARE_DEBUG_VARIABLE(int32_t, PrintfOutputFlushThreshold, -1, "-1: default (1MB), 0: print output of each printf call separately, >0: size in bytes of formatted printf output buffered before printing")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDrmQuerySnapshot, -1, "-1: default (disabled), 0: disabled, 1: enabled. Serve static DRM queries (topology, engine info, hwconfig table) during startup from snapshot in cache directory, verified asynchronously after startup")
+DECLARE_DEBUG_VARIABLE(bool, PrintDrmStartupTimes, false, "Print time spent in DRM device initialization phases and DRM query snapshot statistics")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceWddmLowPriorityContextValue, -1, "Force scheduling priority value during Wddm low priority context creation. -1 - default.")
 DECLARE_DEBUG_VARIABLE(int32_t, FailBuildProgramWithStatefulAccess, -1, "-1: default, 0: disable, 1: enable, Fail build program/module creation whenever stateful access is discovered (except built in kernels).")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceImagesSupport, -1, "-1: default, 0: disable, 1: enable. Override support for Images.")
@@ -244,6 +255,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, DebugSetMemoryDiagnosticsDelay, -1, "-1: default
 /*LOGGING FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, PrintDriverDiagnostics, -1, "prints driver diagnostics messages to standard output, value corresponds to hint level")
 DECLARE_DEBUG_VARIABLE(bool, PrintOsContextInitializations, false, "print initialized OsContexts to standard output")
+DECLARE_DEBUG_VARIABLE(bool, PrintEngineResourcesCreation, false, "print engines creation time and allocations created on first use of engine to standard output")
 DECLARE_DEBUG_VARIABLE(bool, PrintDeviceAndEngineIdOnSubmission, false, "print submissions device and engine IDs to standard output")
 DECLARE_DEBUG_VARIABLE(bool, PrintExecutionBuffer, false, "print execution buffer information to standard output")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOsForSubmit, false, "print all BOs passed to submission")
@@ -253,6 +265,9 @@ DECLARE_DEBUG_VARIABLE(bool, DumpZEBin, false, "Enables dumping zebin (elf) to a
 DECLARE_DEBUG_VARIABLE(bool, DumpKernels, false, "Enables dumping kernels' program source code to text files and program from binary to bin file")
 DECLARE_DEBUG_VARIABLE(bool, DumpKernelArgs, false, "Enables dumping kernels args to binary files")
 DECLARE_DEBUG_VARIABLE(bool, LogApiCalls, false, "Enables logging api function calls, inputs and outputs to file")
+DECLARE_DEBUG_VARIABLE(bool, LogApiCallsBinary, false, "Enables low overhead logging of api function calls as binary records drained to <log file>.bin by a background thread, decode offline with scripts/decode_api_trace.py")
+DECLARE_DEBUG_VARIABLE(bool, PerfProfilerHistograms, false, "Record per api and per system call latencies in per thread histograms, dumped to PerfHistograms.txt at exit")
+DECLARE_DEBUG_VARIABLE(int32_t, PerfProfilerHistogramsDumpSignal, -1, "If greater than 0, with PerfProfilerHistograms enabled, signal number (e.g. 10 for SIGUSR1) on which latency histograms are dumped to PerfHistograms.txt")
 DECLARE_DEBUG_VARIABLE(bool, LogPatchTokens, false, "Enables logging patch tokens, inputs and outputs to file")
 DECLARE_DEBUG_VARIABLE(bool, LogZEInfo, false, "Enables logging ZE Info to file")
 DECLARE_DEBUG_VARIABLE(bool, LogTaskCounts, false, "Enables logging taskCounts and taskLevels to file")
@@ -325,10 +340,13 @@ DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsSize, -1, "-1: default, >=0: Size to app
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMask, 0, "0: default, >0: bitmask: indicates bcs engines for split")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMaskH2D, 0, "0: default, >0: bitmask: indicates bcs engines for H2D split")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMaskD2H, 0, "0: default, >0: bitmask: indicates bcs engines for D2H split")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsWeighted, -1, "-1: default, 0: disabled, 1: enabled. When enabled, BCS split chunks are weighted by measured per-engine throughput and aligned to 64KB")
 DECLARE_DEBUG_VARIABLE(int32_t, ReuseKernelBinaries, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver reuses kernel binaries.")
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocations, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of command buffers and heaps at initialization of immediate command list.")
 DECLARE_DEBUG_VARIABLE(int32_t, UseHighAlignmentForHeapExtended, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver aligns HEAP_EXTENDED allocations to GPU VA that is next power of 2 for a given size, if disables GPU VA is using 2MB/64KB alignment.")
 DECLARE_DEBUG_VARIABLE(int32_t, DispatchCmdlistCmdBufferPrimary, -1, "-1: default, 0: dispatch command buffers as seconadry, 1: dispatch command buffers as primary and chain")
+DECLARE_DEBUG_VARIABLE(int32_t, PreloadAllBuiltinsAsync, -1, "-1: default, 0: disabled, 1: enabled. When enabled, L0 builtin modules and kernels are created for a device in parallel in the background at device init")
+DECLARE_DEBUG_VARIABLE(int32_t, ShareBuiltinBinariesAcrossDevices, -1, "-1: default, 0: disabled, 1: enabled. When enabled, native L0 builtin binaries built for one root device are reused by other root devices of the same product")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -388,6 +406,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceRunAloneContext, -1, "Control creation of r
 DECLARE_DEBUG_VARIABLE(int32_t, AddClGlSharing, -1, "Add cl-gl extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelTunning, -1, "Perform a tunning of enqueue kernel, -1:default(disabled), 0:disable, 1:enable simple kernel tunning, 2:enable full kernel tunning")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBOMmapCreate, -1, "Create BOs using mmap, -1:default, 0:disable(GEM_USERPTR), 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBufferObjectRecycling, -1, "-1: default (disabled), 0: disabled, 1: enabled. Keep freed mmap backed BOs together with their CPU mapping and GPU VA and reuse them for allocations of the same size class")
+DECLARE_DEBUG_VARIABLE(int64_t, BufferObjectRecyclingMaxSize, -1, "-1: default (256MB), >0: max total size in bytes of freed BOs kept for recycling, least recently freed BOs are released first")
+DECLARE_DEBUG_VARIABLE(bool, PrintBufferObjectRecyclingStatistics, false, "Print BO recycling hits, misses, released BOs and avoided ioctls on memory manager cleanup")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableGemCloseWorker, -1, "Use asynchronous gem object closing, -1:default, 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrValidation, -1, "Validate BO from GEM_USERPTR, -1:default(enable), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_motion_estimation extension")
@@ -474,9 +495,17 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableCustomLocalMemoryAlignment, 0,
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableDeviceAllocationCache, -1, "Experimentally enable allocation cache.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalH2DCpuCopyThreshold, -1, "Override default threshold (in bytes) for H2D CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override default threshold (in bytes) for D2H CPU copy.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCopyThresholdCalibration, -1, "-1: default (disabled), 0: disabled, 1: enabled. Learn CPU copy thresholds of immediate command lists from measured copy latencies and persist them in cache directory")
+DECLARE_DEBUG_VARIABLE(bool, PrintCopyThresholdCalibration, false, "Print learned CPU copy thresholds and latency samples on device destruction")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyEngineWorkerCount, -1, "-1: default (min of 3 and available hw threads - 1), >=0: number of worker threads splitting large CPU copies to or from locked device memory, 0 disables splitting")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyEngineSplitThreshold, -1, "-1: default (4MB), >0: size in bytes from which CPU copies to or from locked device memory are split across worker threads")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableStreamingCpuCopy, -1, "-1: default (enabled), 0: disabled, 1: enabled. Use non-temporal loads and stores for CPU copies to or from locked device memory")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalForceCopyThroughLock, -1, "Force copy through lock pointer on zeAppendMemoryCopy for all cases -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimentally enable pool allocator for clCreateBuffer under 4KB.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostUsmAllocationPool, -1, "-1: default (disabled), 0: disabled, >0: size in MB of the pool servicing small L0 host USM allocations")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceUsmAllocationPool, -1, "-1: default (disabled), 0: disabled, >0: size in MB of the per device pool servicing small L0 device USM allocations")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmAllocationPoolMaxServicedSize, -1, "-1: default (4KB), >0: largest USM allocation in bytes serviced from USM allocation pools")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLockWaitlistSizeThreshold, -1, "If less than given value, driver will wait for Waitlist on host, instead of sending appendBarrier. If 0, always use barrier.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableSourceLevelDebugger, false, "Experimentally enable source level debugger.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API. When enabled - Level Zero debugging is disabled.")
@@ -531,6 +560,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, UpdateTaskCountFromWait, -1, " Do not update tas
 DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampWaitForQueues, -1, "Wait on queues using timestamps, -1: default(disabled), 0: disabled, 1: enabled where UpdateTaskCountFromWait enabled, 2: enabled on gpgpu engine with direct submission, 3: enabled on any direct submission, 4: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampWaitForEvents, -1, "Wait on events using timestamps, -1: default(disabled), 0: disabled, 1: enabled where UpdateTaskCountFromWait enabled, 2: enabled on gpgpu engine with direct submission, 3: enabled on any direct submission, 4: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferOsContextInitialization, -1, "-1: default, 0: create all contexts immediately, 1: defer, if possible")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferEngineResourcesCreation, -1, "-1: default, 0: create all engine allocations at device creation, 1: create preemption, global fence and kernel args allocations of engines with deferred OsContext initialization on first use")
 DECLARE_DEBUG_VARIABLE(int32_t, UsmInitialPlacement, -1, "-1: default, 0: optimize for first CPU access, 1: optimize for first GPU access")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceHostPointerImport, -1, "-1: default, 0: disable, 1: enable, Forces the driver to import every host pointer coming into driver, WARNING this is not spec compliant.")
 DECLARE_DEBUG_VARIABLE(int32_t, ProgramExtendedPipeControlPriorToNonPipelinedStateCommand, -1, "-1: default, 0: disable, 1: enable, Program additional extended version of PIPE CONTROL command before non pipelined state command")
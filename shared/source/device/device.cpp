@@ -30,6 +30,8 @@
 #include "shared/source/source_level_debugger/source_level_debugger.h"
 #include "shared/source/utilities/software_tags_manager.h"
 
+#include <chrono>
+
 namespace NEO {
 
 decltype(&PerformanceCounters::create) Device::createPerformanceCountersFunc = PerformanceCounters::create;
@@ -228,10 +230,24 @@ bool Device::createDeviceImpl() {
         getGmmHelper()->forceAllResourcesUncached();
     }
 
+    auto enginesCreationStart = std::chrono::steady_clock::now();
     if (!createEngines()) {
         return false;
     }
 
+    if (DebugManager.flags.PrintEngineResourcesCreation.get()) {
+        auto enginesCreationTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - enginesCreationStart).count();
+        uint32_t deferredEngines = 0u;
+        size_t engineAllocationsSize = 0u;
+        for (auto &engine : allEngines) {
+            deferredEngines += engine.commandStreamReceiver->areEngineAllocationsDeferred() ? 1u : 0u;
+            engineAllocationsSize += engine.commandStreamReceiver->getEngineAllocationsSize();
+        }
+        printf("Engines creation: rootDeviceIndex=%u deviceBitfield=0x%lx engines=%zu deferred=%u time=%lld us allocations size=%zu\n",
+               getRootDeviceIndex(), static_cast<unsigned long>(getDeviceBitfield().to_ulong()), allEngines.size(), deferredEngines,
+               static_cast<long long>(enginesCreationTime), engineAllocationsSize);
+    }
+
     getDefaultEngine().osContext->setDefaultContext(true);
 
     for (auto &engine : allEngines) {
@@ -371,7 +387,8 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
 
     auto osContext = executionEnvironment->memoryManager->createAndRegisterOsContext(commandStreamReceiver.get(), engineDescriptor);
     commandStreamReceiver->setupContext(*osContext);
-    if (osContext->isImmediateContextInitializationEnabled(isDefaultEngine)) {
+    const bool immediateContextInitialization = osContext->isImmediateContextInitializationEnabled(isDefaultEngine);
+    if (immediateContextInitialization) {
         if (!commandStreamReceiver->initializeResources()) {
             return false;
         }
@@ -381,13 +398,9 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
         return false;
     }
 
-    if (!commandStreamReceiver->createGlobalFenceAllocation()) {
-        return false;
-    }
-
-    commandStreamReceiver->createKernelArgsBufferAllocation();
-
-    if (preemptionMode == PreemptionMode::MidThread && !commandStreamReceiver->createPreemptionAllocation()) {
+    if (!immediateContextInitialization && isEngineResourcesCreationDeferred()) {
+        commandStreamReceiver->deferEngineAllocations();
+    } else if (!commandStreamReceiver->createEngineAllocations()) {
         return false;
     }
 
@@ -454,6 +467,13 @@ bool Device::isInitDeviceWithFirstSubmissionSupported(CommandStreamReceiverType
            Device::isInitDeviceWithFirstSubmissionEnabled(csrType);
 }
 
+bool Device::isEngineResourcesCreationDeferred() const {
+    if (getDebugger()) {
+        return false;
+    }
+    return DebugManager.flags.DeferEngineResourcesCreation.get() == 1;
+}
+
 double Device::getPlatformHostTimerResolution() const {
     if (getOSTime()) {
         return getOSTime()->getHostTimerResolution();
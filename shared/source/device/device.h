@@ -115,6 +115,7 @@ class Device : public ReferenceTrackedObject<Device> {
     static bool isInitDeviceWithFirstSubmissionEnabled(CommandStreamReceiverType csrType);
     bool isBcsSplitSupported();
     bool isInitDeviceWithFirstSubmissionSupported(CommandStreamReceiverType csrType);
+    bool isEngineResourcesCreationDeferred() const;
     bool areSharedSystemAllocationsAllowed() const;
     template <typename SpecializedDeviceT>
     void setSpecializedDevice(SpecializedDeviceT *specializedDevice) {
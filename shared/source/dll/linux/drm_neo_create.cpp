@@ -42,6 +42,7 @@ Drm *Drm::create(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceId, RootDeviceEnvironm
     if (!drm->queryDeviceIdAndRevision()) {
         return nullptr;
     }
+    drm->markStartupPhase("queryDeviceIdAndRevision");
     auto hwInfo = rootDeviceEnvironment.getMutableHardwareInfo();
     if (!DeviceFactory::isAllowedDeviceId(hwInfo->platform.usDeviceID, DebugManager.flags.FilterDeviceId.get())) {
         return nullptr;
@@ -63,6 +64,7 @@ Drm *Drm::create(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceId, RootDeviceEnvironm
             return nullptr;
         }
         hwInfo->capabilityTable.deviceName = deviceName;
+        drm->markStartupPhase("setupHardwareInfo");
     } else {
         printDebugString(DebugManager.flags.PrintDebugMessages.get(), stderr,
                          "FATAL: Unknown device: deviceId: %04x, revisionId: %04x\n", hwInfo->platform.usDeviceID, hwInfo->platform.usRevId);
@@ -88,16 +90,19 @@ Drm *Drm::create(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceId, RootDeviceEnvironm
     if (ret != 0) {
         printDebugString(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "WARNING: Failed to request OCL Turbo Boost\n");
     }
+    drm->markStartupPhase("queryDeviceParameters");
 
     if (!drm->queryMemoryInfo()) {
         drm->setPerContextVMRequired(true);
         printDebugString(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "WARNING: Failed to query memory info\n");
     }
+    drm->markStartupPhase("queryMemoryInfo");
 
     if (!drm->queryEngineInfo()) {
         drm->setPerContextVMRequired(true);
         printDebugString(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "WARNING: Failed to query engine info\n");
     }
+    drm->markStartupPhase("queryEngineInfo");
 
     drm->checkContextDebugSupport();
 
@@ -116,6 +121,7 @@ Drm *Drm::create(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceId, RootDeviceEnvironm
     }
 
     drm->isSetPairAvailable();
+    drm->markStartupPhase("queryFeatureSupport");
 
     if (!drm->isPerContextVMRequired()) {
         if (!drm->createVirtualMemoryAddressSpace(GfxCoreHelper::getSubDevicesCount(rootDeviceEnvironment.getHardwareInfo()))) {
@@ -124,6 +130,7 @@ Drm *Drm::create(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceId, RootDeviceEnvironm
     }
 
     drm->queryAdapterBDF();
+    drm->markStartupPhase("createVirtualMemoryAddressSpace");
 
     return drm.release();
 }
@@ -22,11 +22,13 @@
 #include "shared/source/os_interface/os_environment.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
 #include "shared/source/utilities/wait_util.h"
 
 namespace NEO {
 ExecutionEnvironment::ExecutionEnvironment() {
     WaitUtils::init();
+    cpuCopyEngine = std::make_unique<CpuCopyEngine>();
     this->configureNeoEnvironment();
 }
 
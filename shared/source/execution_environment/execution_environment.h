@@ -13,6 +13,7 @@
 #include <vector>
 
 namespace NEO {
+class CpuCopyEngine;
 class DirectSubmissionController;
 class MemoryManager;
 struct OsEnvironment;
@@ -50,10 +51,12 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     bool isFP64EmulationEnabled() const { return fp64EmulationEnabled; }
 
     DirectSubmissionController *initializeDirectSubmissionController();
+    CpuCopyEngine *getCpuCopyEngine() const { return cpuCopyEngine.get(); }
 
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<DirectSubmissionController> directSubmissionController;
     std::unique_ptr<OsEnvironment> osEnvironment;
+    std::unique_ptr<CpuCopyEngine> cpuCopyEngine;
     std::vector<std::unique_ptr<RootDeviceEnvironment>> rootDeviceEnvironments;
     void releaseRootDeviceEnvironmentResources(RootDeviceEnvironment *rootDeviceEnvironment);
 
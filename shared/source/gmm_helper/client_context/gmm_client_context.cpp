@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,8 +7,10 @@
 
 #include "shared/source/gmm_helper/client_context/gmm_client_context.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/client_context/gmm_handle_allocator.h"
+#include "shared/source/gmm_helper/client_context/gmm_resource_info_cache.h"
 #include "shared/source/gmm_helper/gmm_interface.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hw_info.h"
@@ -43,8 +45,16 @@ GmmClientContext::GmmClientContext(const RootDeviceEnvironment &rootDeviceEnviro
     UNRECOVERABLE_IF(ret != GMM_SUCCESS);
 
     clientContext = outArgs.pGmmClientContext;
+
+    if (DebugManager.flags.EnableGmmResourceInfoCache.get() > 0) {
+        auto capacity = DebugManager.flags.EnableGmmResourceInfoCache.get() == 1 ? GmmResourceInfoCache::defaultCapacity
+                                                                                 : static_cast<size_t>(DebugManager.flags.EnableGmmResourceInfoCache.get());
+        resourceInfoCache = std::make_unique<GmmResourceInfoCache>(*this, capacity);
+    }
 }
 GmmClientContext::~GmmClientContext() {
+    resourceInfoCache.reset();
+
     GMM_INIT_OUT_ARGS outArgs;
     outArgs.pGmmClientContext = clientContext;
 
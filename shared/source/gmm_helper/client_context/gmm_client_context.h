@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,7 @@ namespace NEO {
 class GmmClientContext;
 struct RootDeviceEnvironment;
 class GmmHandleAllocator;
+class GmmResourceInfoCache;
 
 class GmmClientContext {
   public:
@@ -43,8 +44,13 @@ class GmmClientContext {
         return handleAllocator.get();
     }
 
+    GmmResourceInfoCache *getResourceInfoCache() const {
+        return resourceInfoCache.get();
+    }
+
   protected:
     GMM_CLIENT_CONTEXT *clientContext;
     std::unique_ptr<GmmHandleAllocator> handleAllocator;
+    std::unique_ptr<GmmResourceInfoCache> resourceInfoCache;
 };
 } // namespace NEO
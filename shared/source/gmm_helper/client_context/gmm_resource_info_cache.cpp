@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/gmm_helper/client_context/gmm_resource_info_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/gmm_helper/client_context/gmm_client_context.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+GmmResourceInfoCache::GmmResourceInfoCache(GmmClientContext &clientContext, size_t capacity) : clientContext(clientContext),
+                                                                                                capacity(std::max(capacity, static_cast<size_t>(1u))) {}
+
+GmmResourceInfoCache::~GmmResourceInfoCache() {
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr,
+                       "GMM resource info cache: hits %llu, misses %llu, evictions %llu, not cacheable %llu\n",
+                       static_cast<unsigned long long>(statistics.hits), static_cast<unsigned long long>(statistics.misses),
+                       static_cast<unsigned long long>(statistics.evictions), static_cast<unsigned long long>(statistics.notCacheable));
+    clear();
+}
+
+bool GmmResourceInfoCache::isCacheable(const GMM_RESCREATE_PARAMS &resourceCreateParams) {
+    // description of resource wrapping existing memory depends on that memory
+    return resourceCreateParams.Flags.Info.ExistingSysMem == 0u &&
+           resourceCreateParams.pExistingSysMem == 0u;
+}
+
+GmmResourceInfoCache::Key GmmResourceInfoCache::createKey(const GMM_RESCREATE_PARAMS &resourceCreateParams) {
+    Key key(sizeof(GMM_RESCREATE_PARAMS), '\0');
+    memcpy(&key[0], &resourceCreateParams, sizeof(GMM_RESCREATE_PARAMS));
+    return key;
+}
+
+GMM_RESOURCE_INFO *GmmResourceInfoCache::createResInfoObject(GMM_RESCREATE_PARAMS *resourceCreateParams) {
+    if (!isCacheable(*resourceCreateParams)) {
+        std::lock_guard<std::mutex> lock(mtx);
+        statistics.notCacheable++;
+        return clientContext.createResInfoObject(resourceCreateParams);
+    }
+
+    auto key = createKey(*resourceCreateParams);
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto entry = entries.find(key);
+        if (entry != entries.end()) {
+            statistics.hits++;
+            lruList.splice(lruList.begin(), lruList, entry->second.lruPosition);
+            return clientContext.copyResInfoObject(entry->second.prototype);
+        }
+        statistics.misses++;
+    }
+
+    // computed outside of the lock, concurrent misses for the same key keep the first prototype
+    auto resourceInfo = clientContext.createResInfoObject(resourceCreateParams);
+    if (resourceInfo == nullptr) {
+        return nullptr;
+    }
+    auto prototype = clientContext.copyResInfoObject(resourceInfo);
+    if (prototype == nullptr) {
+        return resourceInfo;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (entries.find(key) != entries.end()) {
+        clientContext.destroyResInfoObject(prototype);
+        return resourceInfo;
+    }
+    if (entries.size() >= capacity) {
+        auto &evictedKey = lruList.back();
+        auto evicted = entries.find(evictedKey);
+        UNRECOVERABLE_IF(evicted == entries.end());
+        clientContext.destroyResInfoObject(evicted->second.prototype);
+        entries.erase(evicted);
+        lruList.pop_back();
+        statistics.evictions++;
+    }
+    lruList.push_front(key);
+    entries.emplace(std::move(key), Entry{prototype, lruList.begin()});
+    return resourceInfo;
+}
+
+void GmmResourceInfoCache::clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &entry : entries) {
+        clientContext.destroyResInfoObject(entry.second.prototype);
+    }
+    entries.clear();
+    lruList.clear();
+}
+
+GmmResourceInfoCache::Statistics GmmResourceInfoCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+
+size_t GmmResourceInfoCache::getEntriesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+
+} // namespace NEO
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/gmm_helper/gmm_lib.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace NEO {
+class GmmClientContext;
+
+// Bounded LRU cache of GMM resource descriptions keyed by the bytes of GMM_RESCREATE_PARAMS.
+// The first resource created for given parameters is kept as a prototype, later resources
+// with identical parameters are copies of it, which skips size, alignment and cache policy
+// computations in GMM library. Resources backed by existing system memory are not cached.
+// Callers are expected to zero the whole parameters structure, including padding, before filling it.
+class GmmResourceInfoCache : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultCapacity = 256u;
+
+    struct Statistics {
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
+        uint64_t evictions = 0u;
+        uint64_t notCacheable = 0u;
+    };
+
+    GmmResourceInfoCache(GmmClientContext &clientContext, size_t capacity);
+    ~GmmResourceInfoCache();
+
+    GMM_RESOURCE_INFO *createResInfoObject(GMM_RESCREATE_PARAMS *resourceCreateParams);
+    void clear();
+
+    static bool isCacheable(const GMM_RESCREATE_PARAMS &resourceCreateParams);
+
+    Statistics getStatistics() const;
+    size_t getEntriesCount() const;
+    size_t getCapacity() const { return capacity; }
+
+  protected:
+    using Key = std::string;
+    struct Entry {
+        GMM_RESOURCE_INFO *prototype;
+        std::list<Key>::iterator lruPosition;
+    };
+
+    static Key createKey(const GMM_RESCREATE_PARAMS &resourceCreateParams);
+
+    GmmClientContext &clientContext;
+    const size_t capacity;
+
+    mutable std::mutex mtx;
+    std::unordered_map<Key, Entry> entries;
+    std::list<Key> lruList;
+    Statistics statistics;
+};
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,13 +7,16 @@
 
 #include "shared/source/gmm_helper/client_context/gmm_client_context.h"
 #include "shared/source/gmm_helper/client_context/gmm_handle_allocator.h"
+#include "shared/source/gmm_helper/client_context/gmm_resource_info_cache.h"
 #include "shared/source/gmm_helper/resource_info.h"
 #include "shared/source/helpers/debug_helpers.h"
 
 namespace NEO {
 
 GmmResourceInfo::GmmResourceInfo(GmmClientContext *clientContext, GMM_RESCREATE_PARAMS *resourceCreateParams) : clientContext(clientContext) {
-    auto resourceInfoPtr = clientContext->createResInfoObject(resourceCreateParams);
+    auto resourceInfoCache = clientContext->getResourceInfoCache();
+    auto resourceInfoPtr = resourceInfoCache ? resourceInfoCache->createResInfoObject(resourceCreateParams)
+                                             : clientContext->createResInfoObject(resourceCreateParams);
     createResourceInfo(resourceInfoPtr);
 }
 
@@ -0,0 +1,17 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/streaming_copy.h"
+
+namespace NEO {
+namespace StreamingCopy {
+
+CopyFunctionT copyToUncached = copyToUncachedSse4;
+CopyFunctionT copyFromUncached = copyFromUncachedSse4;
+
+} // namespace StreamingCopy
+} // namespace NEO
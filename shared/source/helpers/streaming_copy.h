@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+
+namespace NEO {
+namespace StreamingCopy {
+using CopyFunctionT = void (*)(void *dst, const void *src, size_t size);
+
+// Copies into uncached (write-combined) memory with non-temporal stores
+void copyToUncachedSse4(void *dst, const void *src, size_t size);
+// Copies from uncached (write-combined) memory with non-temporal (streaming) loads
+void copyFromUncachedSse4(void *dst, const void *src, size_t size);
+
+void copyToUncachedAvx2(void *dst, const void *src, size_t size);
+void copyFromUncachedAvx2(void *dst, const void *src, size_t size);
+
+// Selected based on CPU capabilities
+extern CopyFunctionT copyToUncached;
+extern CopyFunctionT copyFromUncached;
+} // namespace StreamingCopy
+} // namespace NEO
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/streaming_copy.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <immintrin.h>
+#endif
+
+namespace NEO {
+namespace StreamingCopy {
+
+namespace {
+constexpr size_t vectorSize = sizeof(__m128i);
+
+size_t getHeadSize(const void *ptr, size_t size) {
+    auto misalignment = reinterpret_cast<uintptr_t>(ptr) & (vectorSize - 1);
+    return std::min(size, misalignment ? vectorSize - misalignment : 0u);
+}
+} // namespace
+
+void copyToUncachedSse4(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto headSize = getHeadSize(dst, size);
+    memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    // full cache lines, so write-combining buffers are flushed whole
+    for (; size >= 4 * vectorSize; size -= 4 * vectorSize) {
+        auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes));
+        auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes + vectorSize));
+        auto v2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes + 2 * vectorSize));
+        auto v3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes + 3 * vectorSize));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes), v0);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes + vectorSize), v1);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes + 2 * vectorSize), v2);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes + 3 * vectorSize), v3);
+        dstBytes += 4 * vectorSize;
+        srcBytes += 4 * vectorSize;
+    }
+    for (; size >= vectorSize; size -= vectorSize) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes), _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes)));
+        dstBytes += vectorSize;
+        srcBytes += vectorSize;
+    }
+    memcpy(dstBytes, srcBytes, size);
+    _mm_sfence();
+}
+
+void copyFromUncachedSse4(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto headSize = getHeadSize(src, size);
+    memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    for (; size >= 4 * vectorSize; size -= 4 * vectorSize) {
+        auto v0 = _mm_stream_load_si128(reinterpret_cast<__m128i *>(const_cast<uint8_t *>(srcBytes)));
+        auto v1 = _mm_stream_load_si128(reinterpret_cast<__m128i *>(const_cast<uint8_t *>(srcBytes + vectorSize)));
+        auto v2 = _mm_stream_load_si128(reinterpret_cast<__m128i *>(const_cast<uint8_t *>(srcBytes + 2 * vectorSize)));
+        auto v3 = _mm_stream_load_si128(reinterpret_cast<__m128i *>(const_cast<uint8_t *>(srcBytes + 3 * vectorSize)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstBytes), v0);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstBytes + vectorSize), v1);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstBytes + 2 * vectorSize), v2);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstBytes + 3 * vectorSize), v3);
+        dstBytes += 4 * vectorSize;
+        srcBytes += 4 * vectorSize;
+    }
+    for (; size >= vectorSize; size -= vectorSize) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstBytes), _mm_stream_load_si128(reinterpret_cast<__m128i *>(const_cast<uint8_t *>(srcBytes))));
+        dstBytes += vectorSize;
+        srcBytes += vectorSize;
+    }
+    memcpy(dstBytes, srcBytes, size);
+}
+
+} // namespace StreamingCopy
+} // namespace NEO
@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/streaming_copy.h"
+
+#include "shared/source/utilities/cpu_info.h"
+
+namespace NEO {
+namespace StreamingCopy {
+
+CopyFunctionT copyToUncached = copyToUncachedSse4;
+CopyFunctionT copyFromUncached = copyFromUncachedSse4;
+
+namespace {
+// Initialize the function pointers based on CPU capabilities
+struct Initializer {
+    Initializer() {
+        if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+            copyToUncached = copyToUncachedAvx2;
+            copyFromUncached = copyFromUncachedAvx2;
+        }
+    }
+} initializer;
+} // namespace
+
+} // namespace StreamingCopy
+} // namespace NEO
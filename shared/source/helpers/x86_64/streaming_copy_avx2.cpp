@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/streaming_copy.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+
+namespace NEO {
+namespace StreamingCopy {
+
+#if __AVX2__
+namespace {
+constexpr size_t vectorSize = sizeof(__m256i);
+
+size_t getHeadSize(const void *ptr, size_t size) {
+    auto misalignment = reinterpret_cast<uintptr_t>(ptr) & (vectorSize - 1);
+    return std::min(size, misalignment ? vectorSize - misalignment : 0u);
+}
+} // namespace
+
+void copyToUncachedAvx2(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto headSize = getHeadSize(dst, size);
+    memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    for (; size >= 4 * vectorSize; size -= 4 * vectorSize) {
+        auto v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes));
+        auto v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + vectorSize));
+        auto v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + 2 * vectorSize));
+        auto v3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + 3 * vectorSize));
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes), v0);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + vectorSize), v1);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + 2 * vectorSize), v2);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + 3 * vectorSize), v3);
+        dstBytes += 4 * vectorSize;
+        srcBytes += 4 * vectorSize;
+    }
+    for (; size >= vectorSize; size -= vectorSize) {
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes)));
+        dstBytes += vectorSize;
+        srcBytes += vectorSize;
+    }
+    memcpy(dstBytes, srcBytes, size);
+    _mm_sfence();
+}
+
+void copyFromUncachedAvx2(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto headSize = getHeadSize(src, size);
+    memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    for (; size >= 4 * vectorSize; size -= 4 * vectorSize) {
+        auto v0 = _mm256_stream_load_si256(reinterpret_cast<const __m256i *>(srcBytes));
+        auto v1 = _mm256_stream_load_si256(reinterpret_cast<const __m256i *>(srcBytes + vectorSize));
+        auto v2 = _mm256_stream_load_si256(reinterpret_cast<const __m256i *>(srcBytes + 2 * vectorSize));
+        auto v3 = _mm256_stream_load_si256(reinterpret_cast<const __m256i *>(srcBytes + 3 * vectorSize));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes), v0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes + vectorSize), v1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes + 2 * vectorSize), v2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes + 3 * vectorSize), v3);
+        dstBytes += 4 * vectorSize;
+        srcBytes += 4 * vectorSize;
+    }
+    for (; size >= vectorSize; size -= vectorSize) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes), _mm256_stream_load_si256(reinterpret_cast<const __m256i *>(srcBytes)));
+        dstBytes += vectorSize;
+        srcBytes += vectorSize;
+    }
+    memcpy(dstBytes, srcBytes, size);
+}
+#else
+void copyToUncachedAvx2(void *dst, const void *src, size_t size) {
+    copyToUncachedSse4(dst, src, size);
+}
+
+void copyFromUncachedAvx2(void *dst, const void *src, size_t size) {
+    copyFromUncachedSse4(dst, src, size);
+}
+#endif
+
+} // namespace StreamingCopy
+} // namespace NEO
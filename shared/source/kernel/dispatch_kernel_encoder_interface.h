@@ -1,12 +1,14 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 
 namespace NEO {
 class GraphicsAllocation;
@@ -19,6 +21,66 @@ enum class SlmPolicy {
     SlmPolicyLargeData
 };
 
+// Interface descriptor data programmed once per kernel configuration and reused by
+// subsequent dispatches; only per-dispatch fields are patched on top of it.
+struct InterfaceDescriptorTemplate {
+    static constexpr size_t maxInterfaceDescriptorSize = 64u;
+
+    struct Key {
+        uint64_t kernelStartPointer = 0u;
+        uint32_t threadsPerThreadGroup = 0u;
+        uint32_t slmTotalSize = 0u;
+        uint32_t crossThreadDataSize = 0u;
+        uint32_t perThreadDataSize = 0u;
+        uint32_t numGrf = 0u;
+        uint32_t barrierCount = 0u;
+        int32_t slmSizeOverride = -1;
+        uint32_t threadArbitrationPolicy = 0u;
+        uint32_t preemptionMode = 0u;
+
+        bool operator==(const Key &other) const {
+            return kernelStartPointer == other.kernelStartPointer &&
+                   threadsPerThreadGroup == other.threadsPerThreadGroup &&
+                   slmTotalSize == other.slmTotalSize &&
+                   crossThreadDataSize == other.crossThreadDataSize &&
+                   perThreadDataSize == other.perThreadDataSize &&
+                   numGrf == other.numGrf &&
+                   barrierCount == other.barrierCount &&
+                   slmSizeOverride == other.slmSizeOverride &&
+                   threadArbitrationPolicy == other.threadArbitrationPolicy &&
+                   preemptionMode == other.preemptionMode;
+        }
+    };
+
+    // Returns false when the template is stale or another thread currently updates it.
+    bool load(const Key &requestedKey, void *interfaceDescriptor, size_t size) {
+        if (inUse.exchange(true)) {
+            return false;
+        }
+        bool hit = valid && (key == requestedKey);
+        if (hit) {
+            memcpy(interfaceDescriptor, data, size);
+        }
+        inUse.store(false);
+        return hit;
+    }
+
+    void store(const Key &newKey, const void *interfaceDescriptor, size_t size) {
+        if (size > maxInterfaceDescriptorSize || inUse.exchange(true)) {
+            return;
+        }
+        key = newKey;
+        memcpy(data, interfaceDescriptor, size);
+        valid = true;
+        inUse.store(false);
+    }
+
+    Key key = {};
+    bool valid = false;
+    std::atomic<bool> inUse{false};
+    alignas(8) uint8_t data[maxInterfaceDescriptorSize] = {};
+};
+
 struct DispatchKernelEncoderI {
     virtual ~DispatchKernelEncoderI() = default;
 
@@ -40,11 +102,14 @@ struct DispatchKernelEncoderI {
     virtual uint32_t getSurfaceStateHeapDataSize() const = 0;
 
     virtual GraphicsAllocation *getIsaAllocation() const = 0;
+    virtual uint64_t getIsaOffsetInParentAllocation() const { return 0lu; }
     virtual const uint8_t *getDynamicStateHeapData() const = 0;
 
     virtual uint32_t getRequiredWorkgroupOrder() const = 0;
     virtual bool requiresGenerationOfLocalIdsByRuntime() const = 0;
 
     virtual ImplicitArgs *getImplicitArgs() const = 0;
+
+    virtual InterfaceDescriptorTemplate *getInterfaceDescriptorTemplate() const { return nullptr; }
 };
 } // namespace NEO
@@ -187,6 +187,7 @@ class SVMAllocsManager {
     size_t getNumAllocs() const { return svmAllocs.getNumAllocs(); }
     MOCKABLE_VIRTUAL size_t getNumDeferFreeAllocs() const { return svmDeferFreeAllocs.getNumAllocs(); }
     MapBasedAllocationTracker *getSVMAllocs() { return &svmAllocs; }
+    MemoryManager *getMemoryManager() const { return memoryManager; }
 
     MOCKABLE_VIRTUAL void insertSvmMapOperation(void *regionSvmPtr, size_t regionSize, void *baseSvmPtr, size_t offset, bool readOnlyMap);
     void removeSvmMapOperation(const void *regionSvmPtr);
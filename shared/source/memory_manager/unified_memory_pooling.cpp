@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/unified_memory_pooling.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+namespace NEO {
+
+UsmMemAllocPool::~UsmMemAllocPool() {
+    cleanup();
+}
+
+size_t UsmMemAllocPool::getPoolSize(int32_t poolSizeInMbFlag) {
+    if (poolSizeInMbFlag > 0) {
+        return static_cast<size_t>(poolSizeInMbFlag) * MemoryConstants::megaByte;
+    }
+    return 0u;
+}
+
+size_t UsmMemAllocPool::getMaxServicedSize() {
+    if (DebugManager.flags.UsmAllocationPoolMaxServicedSize.get() != -1) {
+        return static_cast<size_t>(DebugManager.flags.UsmAllocationPoolMaxServicedSize.get());
+    }
+    return defaultMaxServicedSize;
+}
+
+bool UsmMemAllocPool::initialize(SVMAllocsManager *svmMemoryManager, const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties, size_t poolSize, size_t maxServicedSize) {
+    DEBUG_BREAK_IF(isInitialized());
+    if (poolSize == 0u || maxServicedSize == 0u || maxServicedSize > poolSize) {
+        return false;
+    }
+
+    auto poolProperties = memoryProperties;
+    poolProperties.alignment = PoolChunkAllocator::maxChunkAlignment;
+    void *pool = nullptr;
+    if (memoryProperties.memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY) {
+        pool = svmMemoryManager->createHostUnifiedMemoryAllocation(poolSize, poolProperties);
+    } else {
+        pool = svmMemoryManager->createUnifiedMemoryAllocation(poolSize, poolProperties);
+    }
+    if (pool == nullptr) {
+        return false;
+    }
+
+    this->svmMemoryManager = svmMemoryManager;
+    this->poolStart = pool;
+    this->poolEnd = ptrOffset(pool, poolSize);
+    this->maxServicedSize = maxServicedSize;
+    this->poolMemoryType = memoryProperties.memoryType;
+    this->device = memoryProperties.device;
+    this->allocationFlags = memoryProperties.allocationFlags.allFlags;
+    this->allocationAllocFlags = memoryProperties.allocationFlags.allAllocFlags;
+    this->chunkAllocator = std::make_unique<PoolChunkAllocator>(poolSize, chunkAlignment);
+    return true;
+}
+
+void UsmMemAllocPool::cleanup() {
+    if (isInitialized()) {
+        svmMemoryManager->freeSVMAlloc(poolStart, true);
+        poolStart = nullptr;
+        poolEnd = nullptr;
+        chunkAllocator.reset();
+        allocations.clear();
+        requestedBytesInUse = 0u;
+    }
+}
+
+bool UsmMemAllocPool::canBePooled(size_t size, const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties) const {
+    return isInitialized() &&
+           size > 0u &&
+           size <= maxServicedSize &&
+           memoryProperties.memoryType == poolMemoryType &&
+           memoryProperties.device == device &&
+           memoryProperties.allocationFlags.allFlags == allocationFlags &&
+           memoryProperties.allocationFlags.allAllocFlags == allocationAllocFlags &&
+           memoryProperties.allocationFlags.hostptr == 0u &&
+           memoryProperties.alignment <= PoolChunkAllocator::maxChunkAlignment;
+}
+
+void *UsmMemAllocPool::createUnifiedMemoryAllocation(size_t size, const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties) {
+    if (!canBePooled(size, memoryProperties)) {
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    AllocationInfo allocationInfo;
+    allocationInfo.requestedSize = size;
+    if (!chunkAllocator->allocate(size, memoryProperties.alignment, allocationInfo.offset, allocationInfo.allocatedSize)) {
+        if (!chunkAllocator->hasDeferredChunks()) {
+            return nullptr;
+        }
+        drain();
+        if (!chunkAllocator->allocate(size, memoryProperties.alignment, allocationInfo.offset, allocationInfo.allocatedSize)) {
+            return nullptr;
+        }
+    }
+    allocationInfo.allocId = svmMemoryManager->allocationsCounter++;
+
+    auto ptr = ptrOffset(poolStart, allocationInfo.offset);
+    allocations.insert({ptr, allocationInfo});
+    requestedBytesInUse += size;
+    return ptr;
+}
+
+bool UsmMemAllocPool::freeSVMAlloc(const void *ptr, bool blocking) {
+    if (!isInPool(ptr)) {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    auto allocationIt = allocations.find(ptr);
+    if (allocationIt == allocations.end()) {
+        return false;
+    }
+
+    if (blocking) {
+        auto poolData = svmMemoryManager->getSVMAlloc(poolStart);
+        UNRECOVERABLE_IF(poolData == nullptr);
+        for (auto &gpuAllocation : poolData->gpuAllocations.getGraphicsAllocations()) {
+            if (gpuAllocation) {
+                svmMemoryManager->getMemoryManager()->waitForEnginesCompletion(*gpuAllocation);
+            }
+        }
+    }
+
+    // chunk still accessed by the GPU is not handed out again until the pool is idle
+    if (!blocking && isPoolInUse()) {
+        chunkAllocator->deferFree(allocationIt->second.offset, allocationIt->second.allocatedSize);
+    } else {
+        chunkAllocator->free(allocationIt->second.offset, allocationIt->second.allocatedSize);
+    }
+    requestedBytesInUse -= allocationIt->second.requestedSize;
+    allocations.erase(allocationIt);
+    return true;
+}
+
+bool UsmMemAllocPool::isPoolInUse() {
+    auto poolData = svmMemoryManager->getSVMAlloc(poolStart);
+    UNRECOVERABLE_IF(poolData == nullptr);
+    for (auto &gpuAllocation : poolData->gpuAllocations.getGraphicsAllocations()) {
+        if (gpuAllocation && svmMemoryManager->getMemoryManager()->allocInUse(*gpuAllocation)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void UsmMemAllocPool::drain() {
+    if (isPoolInUse()) {
+        return;
+    }
+    chunkAllocator->releaseDeferredChunks();
+}
+
+bool UsmMemAllocPool::isInPool(const void *ptr) const {
+    return ptr >= poolStart && ptr < poolEnd;
+}
+
+std::map<const void *, UsmMemAllocPool::AllocationInfo>::iterator UsmMemAllocPool::findAllocation(const void *ptr) {
+    auto allocationIt = allocations.upper_bound(ptr);
+    if (allocationIt == allocations.begin()) {
+        return allocations.end();
+    }
+    --allocationIt;
+    if (ptr >= ptrOffset(allocationIt->first, allocationIt->second.requestedSize)) {
+        return allocations.end();
+    }
+    return allocationIt;
+}
+
+bool UsmMemAllocPool::isPooledAllocation(const void *ptr) {
+    if (!isInPool(ptr)) {
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(mtx);
+    return findAllocation(ptr) != allocations.end();
+}
+
+void *UsmMemAllocPool::getPooledAllocationBasePtr(const void *ptr) {
+    if (!isInPool(ptr)) {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(mtx);
+    auto allocationIt = findAllocation(ptr);
+    if (allocationIt == allocations.end()) {
+        return nullptr;
+    }
+    return const_cast<void *>(allocationIt->first);
+}
+
+size_t UsmMemAllocPool::getPooledAllocationSize(const void *ptr) {
+    if (!isInPool(ptr)) {
+        return 0u;
+    }
+    std::unique_lock<std::mutex> lock(mtx);
+    auto allocationIt = findAllocation(ptr);
+    if (allocationIt == allocations.end()) {
+        return 0u;
+    }
+    return allocationIt->second.requestedSize;
+}
+
+uint32_t UsmMemAllocPool::getPooledAllocationId(const void *ptr) {
+    if (!isInPool(ptr)) {
+        return SvmAllocationData::uninitializedAllocId;
+    }
+    std::unique_lock<std::mutex> lock(mtx);
+    auto allocationIt = findAllocation(ptr);
+    if (allocationIt == allocations.end()) {
+        return SvmAllocationData::uninitializedAllocId;
+    }
+    return allocationIt->second.allocId;
+}
+
+size_t UsmMemAllocPool::getOffsetInPool(const void *ptr) const {
+    DEBUG_BREAK_IF(!isInPool(ptr));
+    return ptrDiff(ptr, poolStart);
+}
+
+UsmMemAllocPoolStatistics UsmMemAllocPool::getStatistics() {
+    UsmMemAllocPoolStatistics statistics;
+    std::unique_lock<std::mutex> lock(mtx);
+    if (isInitialized()) {
+        auto &chunkStatistics = chunkAllocator->getStatistics();
+        statistics.allocationsInUse = chunkStatistics.allocationsInUse;
+        statistics.totalAllocations = chunkStatistics.totalAllocations;
+        statistics.failedAllocations = chunkStatistics.failedAllocations;
+        statistics.peakUsedPoolSize = chunkStatistics.peakUsedSize;
+        statistics.usedPoolSize = chunkAllocator->getUsedSize();
+        statistics.poolSize = chunkAllocator->getPoolSize();
+        statistics.requestedBytesInUse = requestedBytesInUse;
+    }
+    return statistics;
+}
+
+} // namespace NEO
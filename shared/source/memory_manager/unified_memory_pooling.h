@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/utilities/pool_chunk_allocator.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace NEO {
+
+struct UsmMemAllocPoolStatistics {
+    uint64_t allocationsInUse = 0u;
+    uint64_t totalAllocations = 0u;
+    uint64_t failedAllocations = 0u;
+    uint64_t requestedBytesInUse = 0u;
+    uint64_t usedPoolSize = 0u;
+    uint64_t peakUsedPoolSize = 0u;
+    uint64_t poolSize = 0u;
+};
+
+// Services small USM allocations of a single memory type out of one
+// backing SVM allocation, so they don't each need their own BO.
+class UsmMemAllocPool {
+  public:
+    static constexpr size_t chunkAlignment = MemoryConstants::cacheLineSize;
+    static constexpr size_t defaultMaxServicedSize = 4 * MemoryConstants::kiloByte;
+
+    struct AllocationInfo {
+        size_t offset = 0u;
+        size_t allocatedSize = 0u;
+        size_t requestedSize = 0u;
+        uint32_t allocId = SvmAllocationData::uninitializedAllocId;
+    };
+
+    UsmMemAllocPool() = default;
+    ~UsmMemAllocPool();
+
+    bool initialize(SVMAllocsManager *svmMemoryManager, const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties, size_t poolSize, size_t maxServicedSize);
+    bool isInitialized() const { return poolStart != nullptr; }
+    void cleanup();
+
+    bool canBePooled(size_t size, const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties) const;
+    void *createUnifiedMemoryAllocation(size_t size, const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties);
+    bool freeSVMAlloc(const void *ptr, bool blocking);
+
+    bool isInPool(const void *ptr) const;
+    bool isPooledAllocation(const void *ptr);
+    void *getPooledAllocationBasePtr(const void *ptr);
+    size_t getPooledAllocationSize(const void *ptr);
+    uint32_t getPooledAllocationId(const void *ptr);
+    size_t getOffsetInPool(const void *ptr) const;
+    void *getPoolAddress() const { return poolStart; }
+    UsmMemAllocPoolStatistics getStatistics();
+
+    static size_t getPoolSize(int32_t poolSizeInMbFlag);
+    static size_t getMaxServicedSize();
+
+  protected:
+    std::map<const void *, AllocationInfo>::iterator findAllocation(const void *ptr);
+    bool isPoolInUse();
+    void drain();
+
+    SVMAllocsManager *svmMemoryManager = nullptr;
+    void *poolStart = nullptr;
+    void *poolEnd = nullptr;
+    size_t maxServicedSize = 0u;
+    InternalMemoryType poolMemoryType = InternalMemoryType::NOT_SPECIFIED;
+    Device *device = nullptr;
+    uint32_t allocationFlags = 0u;
+    uint32_t allocationAllocFlags = 0u;
+    std::unique_ptr<PoolChunkAllocator> chunkAllocator;
+    std::map<const void *, AllocationInfo> allocations;
+    uint64_t requestedBytesInUse = 0u;
+    std::mutex mtx;
+};
+
+} // namespace NEO
@@ -134,6 +134,11 @@ class DrmAllocation : public GraphicsAllocation {
     MOCKABLE_VIRTUAL void markForCapture();
     MOCKABLE_VIRTUAL bool shouldAllocationPageFault(const Drm *drm);
     void registerMemoryToUnmap(void *pointer, size_t size, MemoryUnmapFunction unmapFunction);
+    const StackVec<MemoryToUnmap, 1> &getMemoryToUnmap() const { return memoryToUnmap; }
+    void clearMemoryToUnmap() { memoryToUnmap.clear(); }
+
+    void setBufferObjectRecyclable(bool recyclable) { bufferObjectRecyclable = recyclable; }
+    bool isBufferObjectRecyclable() const { return bufferObjectRecyclable; }
 
   protected:
     OsContextLinux *osContext = nullptr;
@@ -146,5 +151,6 @@ class DrmAllocation : public GraphicsAllocation {
 
     void *mmapPtr = nullptr;
     size_t mmapSize = 0u;
+    bool bufferObjectRecyclable = false;
 };
 } // namespace NEO
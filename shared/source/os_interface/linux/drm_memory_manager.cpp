@@ -68,6 +68,13 @@ DrmMemoryManager::DrmMemoryManager(gemCloseWorkerMode mode,
         alignmentSelector.addCandidateAlignment(customAlignment, true, AlignmentSelector::anyWastage, heapIndex);
     }
 
+    if (DebugManager.flags.EnableBufferObjectRecycling.get() == 1) {
+        maxRecycledBufferObjectsSize = defaultMaxRecycledBufferObjectsSize;
+        if (DebugManager.flags.BufferObjectRecyclingMaxSize.get() != -1) {
+            maxRecycledBufferObjectsSize = static_cast<size_t>(DebugManager.flags.BufferObjectRecyclingMaxSize.get());
+        }
+    }
+
     initialize(mode);
 }
 
@@ -137,6 +144,7 @@ void DrmMemoryManager::createDeviceSpecificMemResources(uint32_t rootDeviceIndex
 }
 
 DrmMemoryManager::~DrmMemoryManager() {
+    trimRecycledBufferObjects(0u);
     for (auto &memoryForPinBB : memoryForPinBBs) {
         if (memoryForPinBB) {
             MemoryManager::alignedFreeWrapper(memoryForPinBB);
@@ -159,6 +167,11 @@ void DrmMemoryManager::releaseBufferObject(uint32_t rootDeviceIndex) {
 }
 
 void DrmMemoryManager::commonCleanup() {
+    trimRecycledBufferObjects(0u);
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintBufferObjectRecyclingStatistics.get(), stdout, "BO recycling: hits: %llu, misses: %llu, released BOs: %llu, ioctls avoided: %llu\n",
+                       static_cast<unsigned long long>(bufferObjectRecyclingStatistics.hits), static_cast<unsigned long long>(bufferObjectRecyclingStatistics.misses),
+                       static_cast<unsigned long long>(bufferObjectRecyclingStatistics.releasedBufferObjects), static_cast<unsigned long long>(bufferObjectRecyclingStatistics.ioctlsAvoided));
+
     if (gemCloseWorker) {
         gemCloseWorker->close(true);
     }
@@ -1117,6 +1130,12 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation,
         memoryOperationsInterface->evictWithinOsContext(engine.osContext, *gfxAllocation);
     }
 
+    if (!isImported && recycleBufferObject(drmAlloc)) {
+        drmAlloc->freeRegisteredBOBindExtHandles(&getDrm(rootDeviceIndex));
+        delete gfxAllocation;
+        return;
+    }
+
     if (drmAlloc->getMmapPtr()) {
         this->munmapFunction(drmAlloc->getMmapPtr(), drmAlloc->getMmapSize());
     }
@@ -1978,12 +1997,23 @@ DrmAllocation *DrmMemoryManager::createAllocWithAlignment(const AllocationData &
     }
 
     if (useBooMmap) {
-        auto totalSizeToAlloc = alignedSize + alignment;
-        uint64_t preferredAddress = 0;
         auto gfxPartition = getGfxPartition(allocationData.rootDeviceIndex);
         auto canAllocateInHeapExtended = DebugManager.flags.AllocateHostAllocationsInHeapExtendedHost.get();
-        if (canAllocateInHeapExtended && allocationData.flags.isUSMHostAllocation && gfxPartition->getHeapLimit(HeapIndex::HEAP_EXTENDED_HOST) > 0u) {
+        bool allocateInHeapExtended = canAllocateInHeapExtended && allocationData.flags.isUSMHostAllocation && gfxPartition->getHeapLimit(HeapIndex::HEAP_EXTENDED_HOST) > 0u;
+
+        // BOs placed at a caller reserved GPU address can't be recycled
+        bool recyclable = isBufferObjectRecyclingEnabled() && gpuAddress == 0u;
+        if (recyclable) {
+            alignedSize = getRecyclingSizeClass(alignedSize);
+            auto recycledAllocation = allocateFromRecycledBufferObjects(allocationData, alignedSize, alignment, allocateInHeapExtended);
+            if (recycledAllocation) {
+                return recycledAllocation;
+            }
+        }
 
+        auto totalSizeToAlloc = alignedSize + alignment;
+        uint64_t preferredAddress = 0;
+        if (allocateInHeapExtended) {
             preferredAddress = acquireGpuRange(totalSizeToAlloc, allocationData.rootDeviceIndex, HeapIndex::HEAP_EXTENDED_HOST);
         }
 
@@ -1999,6 +2029,10 @@ DrmAllocation *DrmMemoryManager::createAllocWithAlignment(const AllocationData &
         auto pointerDiff = ptrDiff(cpuPointer, cpuBasePointer);
         std::unique_ptr<BufferObject, BufferObject::Deleter> bo(this->createBufferObjectInMemoryRegion(allocationData.rootDeviceIndex, nullptr, allocationData.type,
                                                                                                        reinterpret_cast<uintptr_t>(cpuPointer), alignedSize, 0u, maxOsContextCount, -1));
+        if (!bo && trimRecycledBufferObjects(0u)) {
+            bo.reset(this->createBufferObjectInMemoryRegion(allocationData.rootDeviceIndex, nullptr, allocationData.type,
+                                                            reinterpret_cast<uintptr_t>(cpuPointer), alignedSize, 0u, maxOsContextCount, -1));
+        }
 
         if (!bo) {
             releaseGpuRange(reinterpret_cast<void *>(preferredAddress), totalSizeToAlloc, allocationData.rootDeviceIndex);
@@ -2046,12 +2080,150 @@ DrmAllocation *DrmMemoryManager::createAllocWithAlignment(const AllocationData &
         bo.release();
         allocation->isShareableHostMemory = true;
         allocation->storageInfo = allocationData.storageInfo;
+        allocation->setBufferObjectRecyclable(recyclable);
         return allocation.release();
     } else {
         return createAllocWithAlignmentFromUserptr(allocationData, size, alignment, alignedSize, gpuAddress);
     }
 }
 
+size_t DrmMemoryManager::getRecyclingSizeClass(size_t size) {
+    // four size classes per power of two, so at most a quarter of a recycled BO is unused
+    auto granularity = std::max(MemoryConstants::pageSize, static_cast<size_t>(Math::prevPowerOfTwo(static_cast<uint64_t>(size))) / 4);
+    return alignUp(size, granularity);
+}
+
+DrmAllocation *DrmMemoryManager::allocateFromRecycledBufferObjects(const AllocationData &allocationData, size_t size, size_t alignment, bool extendedHostHeap) {
+    RecycledBufferObject recycledBufferObject{};
+    {
+        std::lock_guard<std::mutex> lock(recycledBufferObjectsMutex);
+        auto cacheRegion = static_cast<CacheRegion>(allocationData.cacheRegion);
+        auto it = std::find_if(recycledBufferObjects.rbegin(), recycledBufferObjects.rend(), [&](const RecycledBufferObject &entry) {
+            return entry.rootDeviceIndex == allocationData.rootDeviceIndex &&
+                   entry.size == size &&
+                   entry.allocationType == allocationData.type &&
+                   entry.cacheRegion == cacheRegion &&
+                   (entry.reservedAddress != nullptr) == extendedHostHeap &&
+                   isAligned(castToUint64(entry.cpuPtr), alignment);
+        });
+        if (it == recycledBufferObjects.rend()) {
+            bufferObjectRecyclingStatistics.misses++;
+            return nullptr;
+        }
+        recycledBufferObject = *it;
+        recycledBufferObjects.erase(std::next(it).base());
+        recycledBufferObjectsSize -= recycledBufferObject.size;
+        bufferObjectRecyclingStatistics.hits++;
+        bufferObjectRecyclingStatistics.ioctlsAvoided += ioctlsAvoidedPerRecycledBufferObject;
+    }
+
+    auto &drm = this->getDrm(allocationData.rootDeviceIndex);
+    auto gmmHelper = getGmmHelper(allocationData.rootDeviceIndex);
+    auto canonizedGpuAddress = gmmHelper->canonize(recycledBufferObject.bo->peekAddress());
+    auto allocation = std::make_unique<DrmAllocation>(allocationData.rootDeviceIndex, allocationData.type, recycledBufferObject.bo, recycledBufferObject.cpuPtr, canonizedGpuAddress, recycledBufferObject.size, MemoryPool::System4KBPages);
+    allocation->setMmapPtr(recycledBufferObject.cpuPtr);
+    allocation->setMmapSize(recycledBufferObject.size);
+    if (recycledBufferObject.unusedMappingSize != 0u) {
+        allocation->registerMemoryToUnmap(recycledBufferObject.unusedMappingPtr, recycledBufferObject.unusedMappingSize, this->munmapFunction);
+    }
+    allocation->setReservedAddressRange(recycledBufferObject.reservedAddress, recycledBufferObject.reservedSize);
+    if (!allocation->setCacheRegion(&drm, static_cast<CacheRegion>(allocationData.cacheRegion))) {
+        allocation->clearMemoryToUnmap();
+        releaseRecycledBufferObject(recycledBufferObject);
+        return nullptr;
+    }
+
+    allocation->isShareableHostMemory = true;
+    allocation->storageInfo = allocationData.storageInfo;
+    allocation->setBufferObjectRecyclable(true);
+    return allocation.release();
+}
+
+bool DrmMemoryManager::recycleBufferObject(DrmAllocation *drmAllocation) {
+    if (!isBufferObjectRecyclingEnabled() || !drmAllocation->isBufferObjectRecyclable()) {
+        return false;
+    }
+
+    auto bo = drmAllocation->getBO();
+    if (bo == nullptr || bo->peekIsReusableAllocation() || bo->getRefCount() != 1u ||
+        drmAllocation->peekSharedHandle() != Sharing::nonSharedResource ||
+        drmAllocation->getDefaultGmm() != nullptr ||
+        drmAllocation->getMmapSize() > maxRecycledBufferObjectsSize ||
+        drmAllocation->getMemoryToUnmap().size() > 1u) {
+        return false;
+    }
+
+    {
+        // BOs exported through IPC may be mapped by other processes
+        std::lock_guard<std::mutex> lock(mtx);
+        if (sharedBoHandles.find(bo->getHandle()) != sharedBoHandles.end()) {
+            return false;
+        }
+    }
+
+    RecycledBufferObject recycledBufferObject{};
+    recycledBufferObject.bo = bo;
+    recycledBufferObject.cpuPtr = drmAllocation->getMmapPtr();
+    recycledBufferObject.size = drmAllocation->getMmapSize();
+    recycledBufferObject.reservedAddress = drmAllocation->getReservedAddressPtr();
+    recycledBufferObject.reservedSize = drmAllocation->getReservedAddressSize();
+    if (!drmAllocation->getMemoryToUnmap().empty()) {
+        recycledBufferObject.unusedMappingPtr = drmAllocation->getMemoryToUnmap()[0].pointer;
+        recycledBufferObject.unusedMappingSize = drmAllocation->getMemoryToUnmap()[0].size;
+    }
+    recycledBufferObject.rootDeviceIndex = drmAllocation->getRootDeviceIndex();
+    recycledBufferObject.allocationType = drmAllocation->getAllocationType();
+    recycledBufferObject.cacheRegion = bo->peekCacheRegion();
+    drmAllocation->clearMemoryToUnmap();
+
+    {
+        std::lock_guard<std::mutex> lock(recycledBufferObjectsMutex);
+        recycledBufferObjects.push_back(recycledBufferObject);
+        recycledBufferObjectsSize += recycledBufferObject.size;
+    }
+    trimRecycledBufferObjects(maxRecycledBufferObjectsSize);
+    return true;
+}
+
+bool DrmMemoryManager::trimRecycledBufferObjects(size_t maxSize) {
+    std::vector<RecycledBufferObject> bufferObjectsToRelease;
+    {
+        std::lock_guard<std::mutex> lock(recycledBufferObjectsMutex);
+        auto it = recycledBufferObjects.begin();
+        while (recycledBufferObjectsSize > maxSize) {
+            recycledBufferObjectsSize -= it->size;
+            bufferObjectsToRelease.push_back(*it);
+            ++it;
+        }
+        recycledBufferObjects.erase(recycledBufferObjects.begin(), it);
+        bufferObjectRecyclingStatistics.releasedBufferObjects += bufferObjectsToRelease.size();
+    }
+
+    for (auto &recycledBufferObject : bufferObjectsToRelease) {
+        releaseRecycledBufferObject(recycledBufferObject);
+    }
+    return !bufferObjectsToRelease.empty();
+}
+
+void DrmMemoryManager::releaseRecycledBufferObject(RecycledBufferObject &recycledBufferObject) {
+    this->munmapFunction(recycledBufferObject.cpuPtr, recycledBufferObject.size);
+    unreference(recycledBufferObject.bo, true);
+    releaseGpuRange(recycledBufferObject.reservedAddress, recycledBufferObject.reservedSize, recycledBufferObject.rootDeviceIndex);
+    if (recycledBufferObject.unusedMappingSize != 0u) {
+        this->munmapFunction(recycledBufferObject.unusedMappingPtr, recycledBufferObject.unusedMappingSize);
+    }
+}
+
+size_t DrmMemoryManager::getRecycledBufferObjectsSize() {
+    std::lock_guard<std::mutex> lock(recycledBufferObjectsMutex);
+    return recycledBufferObjectsSize;
+}
+
+DrmMemoryManager::BufferObjectRecyclingStatistics DrmMemoryManager::getBufferObjectRecyclingStatistics() {
+    std::lock_guard<std::mutex> lock(recycledBufferObjectsMutex);
+    return bufferObjectRecyclingStatistics;
+}
+
 void *DrmMemoryManager::lockBufferObject(BufferObject *bo) {
     if (bo == nullptr) {
         return nullptr;
@@ -92,7 +92,41 @@ class DrmMemoryManager : public MemoryManager {
     void createDeviceSpecificMemResources(uint32_t rootDeviceIndex) override;
     bool allowIndirectAllocationsAsPack(uint32_t rootDeviceIndex) override;
 
+    struct BufferObjectRecyclingStatistics {
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
+        uint64_t releasedBufferObjects = 0u;
+        uint64_t ioctlsAvoided = 0u;
+    };
+
+    // GEM_CREATE, MMAP_OFFSET and GEM_CLOSE
+    static constexpr uint64_t ioctlsAvoidedPerRecycledBufferObject = 3u;
+    static constexpr size_t defaultMaxRecycledBufferObjectsSize = 256 * MemoryConstants::megaByte;
+
+    static size_t getRecyclingSizeClass(size_t size);
+    bool isBufferObjectRecyclingEnabled() const { return maxRecycledBufferObjectsSize > 0u; }
+    bool trimRecycledBufferObjects(size_t maxSize);
+    size_t getRecycledBufferObjectsSize();
+    BufferObjectRecyclingStatistics getBufferObjectRecyclingStatistics();
+
   protected:
+    struct RecycledBufferObject {
+        BufferObject *bo = nullptr;
+        void *cpuPtr = nullptr;
+        size_t size = 0u;
+        void *reservedAddress = nullptr;
+        size_t reservedSize = 0u;
+        void *unusedMappingPtr = nullptr;
+        size_t unusedMappingSize = 0u;
+        uint32_t rootDeviceIndex = 0u;
+        AllocationType allocationType = AllocationType::UNKNOWN;
+        CacheRegion cacheRegion = CacheRegion::Default;
+    };
+
+    DrmAllocation *allocateFromRecycledBufferObjects(const AllocationData &allocationData, size_t size, size_t alignment, bool extendedHostHeap);
+    bool recycleBufferObject(DrmAllocation *drmAllocation);
+    void releaseRecycledBufferObject(RecycledBufferObject &recycledBufferObject);
+
     void registerSharedBoHandleAllocation(DrmAllocation *drmAllocation);
     BufferObjectHandleWrapper tryToGetBoHandleWrapperWithSharedOwnership(int boHandle);
     void eraseSharedBoHandleWrapper(int boHandle);
@@ -168,5 +202,12 @@ class DrmMemoryManager : public MemoryManager {
     std::vector<std::vector<GraphicsAllocation *>> localMemAllocs;
     std::vector<GraphicsAllocation *> sysMemAllocs;
     std::mutex allocMutex;
+
+    // least recently freed first
+    std::vector<RecycledBufferObject> recycledBufferObjects;
+    size_t recycledBufferObjectsSize = 0u;
+    size_t maxRecycledBufferObjectsSize = 0u;
+    BufferObjectRecyclingStatistics bufferObjectRecyclingStatistics;
+    std::mutex recycledBufferObjectsMutex;
 };
 } // namespace NEO
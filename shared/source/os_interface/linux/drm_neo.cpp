@@ -8,6 +8,7 @@
 #include "shared/source/os_interface/linux/drm_neo.h"
 
 #include "shared/source/command_stream/submission_status.h"
+#include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
@@ -19,7 +20,9 @@
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/neo_driver_version.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/driver_info.h"
 #include "shared/source/os_interface/linux/cache_info.h"
@@ -28,6 +31,7 @@
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler_bind.h"
+#include "shared/source/os_interface/linux/drm_query_snapshot.h"
 #include "shared/source/os_interface/linux/drm_wrappers.h"
 #include "shared/source/os_interface/linux/engine_info.h"
 #include "shared/source/os_interface/linux/hw_device_id.h"
@@ -50,6 +54,7 @@
 #include <fstream>
 #include <map>
 #include <sstream>
+#include <sys/utsname.h>
 
 namespace NEO {
 
@@ -110,6 +115,8 @@ int Drm::ioctl(DrmIoctl request, void *arg) {
             end = std::chrono::steady_clock::now();
             long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
+            // ioctls are also issued from the query snapshot verification thread
+            std::lock_guard<std::mutex> lock(ioctlStatisticsMutex);
             IoctlStatisticsEntry ioctlData{};
             auto ioctlDataIt = this->ioctlStatistics.find(request);
             if (ioctlDataIt != this->ioctlStatistics.end()) {
@@ -438,6 +445,7 @@ int Drm::setupHardwareInfo(const DeviceDescriptor *device, bool setupFeatureTabl
     const auto productFamily = hwInfo->platform.eProductFamily;
     setupIoctlHelper(productFamily);
     ioctlHelper->setupIpVersion();
+    loadQuerySnapshot();
 
     Drm::QueryTopologyData topologyData = {};
 
@@ -596,6 +604,18 @@ std::string Drm::getDrmVersion(int fileDescriptor) {
 }
 
 std::vector<uint8_t> Drm::query(uint32_t queryId, uint32_t queryItemFlags) {
+    if (querySnapshot && querySnapshot->isCacheable(queryId)) {
+        std::vector<uint8_t> data;
+        if (!querySnapshot->find(queryId, queryItemFlags, data)) {
+            data = queryKmd(queryId, queryItemFlags);
+            querySnapshot->store(queryId, queryItemFlags, data);
+        }
+        return data;
+    }
+    return queryKmd(queryId, queryItemFlags);
+}
+
+std::vector<uint8_t> Drm::queryKmd(uint32_t queryId, uint32_t queryItemFlags) {
     Query query{};
     QueryItem queryItem{};
     queryItem.queryId = queryId;
@@ -624,6 +644,7 @@ void Drm::printIoctlStatistics() {
         return;
     }
 
+    std::lock_guard<std::mutex> lock(ioctlStatisticsMutex);
     printf("\n--- Ioctls statistics ---\n");
     printf("%41s %15s %10s %20s %20s %20s", "Request", "Total time(ns)", "Count", "Avg time per ioctl", "Min", "Max\n");
     for (const auto &ioctlData : this->ioctlStatistics) {
@@ -638,6 +659,96 @@ void Drm::printIoctlStatistics() {
     printf("\n");
 }
 
+void Drm::loadQuerySnapshot() {
+    if (DebugManager.flags.EnableDrmQuerySnapshot.get() != 1 || DebugManager.flags.EnableNullHardware.get() || querySnapshot) {
+        return;
+    }
+
+    auto cacheConfig = NEO::getDefaultCompilerCacheConfig();
+    if (!cacheConfig.enabled) {
+        return;
+    }
+
+    auto key = getQuerySnapshotKey();
+    std::stringstream filePath;
+    filePath << cacheConfig.cacheDir << PATH_SEPARATOR << "drm_query_snapshot_" << std::hex << Hash::hash(key.c_str(), key.size()) << ".bin";
+    querySnapshot = std::make_unique<DrmQuerySnapshot>(filePath.str(), key);
+
+    // memory regions are not part of snapshot, they report current usage of local memory
+    querySnapshot->addCacheableQuery(ioctlHelper->getDrmParamValue(DrmParam::QueryTopologyInfo));
+    querySnapshot->addCacheableQuery(ioctlHelper->getDrmParamValue(DrmParam::QueryEngineInfo));
+    querySnapshot->addCacheableQuery(ioctlHelper->getDrmParamValue(DrmParam::QueryHwconfigTable));
+    auto computeSlicesRequest = ioctlHelper->getDrmParamValue(DrmParam::QueryComputeSlices);
+    if (computeSlicesRequest != 0) {
+        querySnapshot->addCacheableQuery(computeSlicesRequest);
+    }
+    querySnapshot->load();
+}
+
+std::string Drm::getQuerySnapshotKey() {
+    auto hwInfo = rootDeviceEnvironment.getHardwareInfo();
+    std::string prelimVersion;
+    getPrelimVersion(prelimVersion);
+
+    std::stringstream key;
+    key << hwInfo->platform.usDeviceID << ":" << hwInfo->platform.usRevId << ":" << hwDeviceId->getPciPath() << ":" << prelimVersion << ":";
+
+    // driver name alone does not change when KMD is updated, version numbers and date do
+    DrmVersion version = {};
+    char name[32] = {};
+    char date[32] = {};
+    version.name = name;
+    version.nameLen = sizeof(name) - 1;
+    version.date = date;
+    version.dateLen = sizeof(date) - 1;
+    if (SysCalls::ioctl(getFileDescriptor(), getIoctlRequestValue(DrmIoctl::Version, nullptr), &version) == 0) {
+        key << name << ":" << version.versionMajor << "." << version.versionMinor << "." << version.versionPatch << ":" << date << ":";
+    }
+    struct utsname kernelInfo = {};
+    if (uname(&kernelInfo) == 0) {
+        key << kernelInfo.release << ":" << kernelInfo.version << ":";
+    }
+    key << driverVersion;
+    return key.str();
+}
+
+void Drm::markStartupPhase(const char *phaseName) {
+    if (!DebugManager.flags.PrintDrmStartupTimes.get()) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    startupPhaseTimes.emplace_back(phaseName, std::chrono::duration_cast<std::chrono::microseconds>(now - startupPhaseStart).count());
+    startupPhaseStart = now;
+}
+
+void Drm::completeStartup() {
+    if (querySnapshot) {
+        querySnapshot->completeStartup([this](uint32_t queryId, uint32_t queryItemFlags) { return queryKmd(queryId, queryItemFlags); });
+    }
+    printStartupPhaseTimes();
+}
+
+void Drm::printStartupPhaseTimes() {
+    if (!DebugManager.flags.PrintDrmStartupTimes.get()) {
+        return;
+    }
+
+    printf("\n--- Drm startup times ---\n");
+    printf("%41s %15s\n", "Phase", "Time(us)");
+    long long totalTime = 0;
+    for (const auto &phase : startupPhaseTimes) {
+        printf("%41s %15lld\n", phase.first, phase.second);
+        totalTime += phase.second;
+    }
+    printf("%41s %15lld\n", "Total", totalTime);
+    if (querySnapshot) {
+        auto statistics = querySnapshot->getStatistics();
+        printf("Query snapshot %s: hits %u, misses %u\n", querySnapshot->getFilePath().c_str(), statistics.hits, statistics.misses);
+    }
+    printf("\n");
+    startupPhaseTimes.clear();
+}
+
 bool Drm::createVirtualMemoryAddressSpace(uint32_t vmCount) {
     for (auto i = 0u; i < vmCount; i++) {
         uint32_t id = i;
@@ -760,6 +871,7 @@ void Drm::cleanup() {
 }
 
 Drm::~Drm() {
+    querySnapshot.reset();
     this->printIoctlStatistics();
 }
 
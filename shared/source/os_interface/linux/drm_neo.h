@@ -18,6 +18,7 @@
 #include "igfxfmid.h"
 
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -43,6 +44,7 @@ enum class SubmissionStatus : uint32_t;
 class BufferObject;
 class CompilerProductHelper;
 class DeviceFactory;
+class DrmQuerySnapshot;
 class MemoryInfo;
 class OsContext;
 class OsContextLinux;
@@ -265,6 +267,10 @@ class Drm : public DriverModel {
     std::unique_ptr<HwDeviceIdDrm> &getHwDeviceId() { return hwDeviceId; }
     std::vector<uint8_t> query(uint32_t queryId, uint32_t queryItemFlags);
 
+    void markStartupPhase(const char *phaseName);
+    void completeStartup();
+    DrmQuerySnapshot *getQuerySnapshot() const { return querySnapshot.get(); }
+
   protected:
     Drm(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceIdIn, RootDeviceEnvironment &rootDeviceEnvironment);
 
@@ -273,6 +279,10 @@ class Drm : public DriverModel {
     std::string generateUUID();
     std::string generateElfUUID(const void *data);
     void printIoctlStatistics();
+    void printStartupPhaseTimes();
+    void loadQuerySnapshot();
+    std::string getQuerySnapshotKey();
+    std::vector<uint8_t> queryKmd(uint32_t queryId, uint32_t queryItemFlags);
     void setupIoctlHelper(const PRODUCT_FAMILY productFamily);
     void queryAndSetVmBindPatIndexProgrammingSupport();
     static std::string getDrmVersion(int fileDescriptor);
@@ -318,6 +328,10 @@ class Drm : public DriverModel {
         long long maxTime = 0;
     };
     std::unordered_map<DrmIoctl, IoctlStatisticsEntry> ioctlStatistics;
+    std::mutex ioctlStatisticsMutex;
+
+    std::vector<std::pair<const char *, long long>> startupPhaseTimes;
+    std::chrono::steady_clock::time_point startupPhaseStart = std::chrono::steady_clock::now();
 
     std::mutex bindFenceMutex;
     std::array<uint64_t, EngineLimits::maxHandleCount> pagingFence;
@@ -331,6 +345,7 @@ class Drm : public DriverModel {
     std::unique_ptr<CacheInfo> cacheInfo;
     std::unique_ptr<EngineInfo> engineInfo;
     std::unique_ptr<MemoryInfo> memoryInfo;
+    std::unique_ptr<DrmQuerySnapshot> querySnapshot;
 
     std::once_flag checkBindOnce;
     std::once_flag checkSetPairOnce;
@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_query_snapshot.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/source/os_interface/sys_calls_common.h"
+
+#include <cstring>
+
+namespace NEO {
+
+namespace {
+template <typename T>
+void append(std::vector<uint8_t> &data, const T &value) {
+    auto bytes = reinterpret_cast<const uint8_t *>(&value);
+    data.insert(data.end(), bytes, bytes + sizeof(T));
+}
+
+struct SnapshotReader {
+    const uint8_t *data;
+    size_t size;
+    size_t offset = 0u;
+
+    template <typename T>
+    bool read(T &value) {
+        if (size - offset < sizeof(T)) {
+            return false;
+        }
+        memcpy(&value, data + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    const uint8_t *skip(size_t count) {
+        if (size - offset < count) {
+            return nullptr;
+        }
+        auto ptr = data + offset;
+        offset += count;
+        return ptr;
+    }
+};
+} // namespace
+
+DrmQuerySnapshot::DrmQuerySnapshot(const std::string &filePath, const std::string &key) : filePath(filePath), key(key) {}
+
+DrmQuerySnapshot::~DrmQuerySnapshot() {
+    waitForVerification();
+}
+
+void DrmQuerySnapshot::addCacheableQuery(uint32_t queryId) {
+    std::lock_guard<std::mutex> lock(mtx);
+    cacheableQueries.insert(queryId);
+}
+
+bool DrmQuerySnapshot::isCacheable(uint32_t queryId) const {
+    if (startupCompleted) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    return cacheableQueries.count(queryId) > 0;
+}
+
+bool DrmQuerySnapshot::load() {
+    auto data = loadFromFile();
+    if (data.empty()) {
+        return false;
+    }
+    if (!deserialize(data.data(), data.size())) {
+        PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "DRM query snapshot %s is outdated, ignoring it\n", filePath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool DrmQuerySnapshot::find(uint32_t queryId, uint32_t queryItemFlags, std::vector<uint8_t> &data) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto entry = entries.find({queryId, queryItemFlags});
+    if (entry == entries.end()) {
+        statistics.misses++;
+        return false;
+    }
+    statistics.hits++;
+    servedEntries.insert(entry->first);
+    data = entry->second;
+    return true;
+}
+
+void DrmQuerySnapshot::store(uint32_t queryId, uint32_t queryItemFlags, const std::vector<uint8_t> &data) {
+    if (data.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    entries[{queryId, queryItemFlags}] = data;
+    dirty = true;
+}
+
+void DrmQuerySnapshot::completeStartup(QueryFunction queryFunction) {
+    if (startupCompleted.exchange(true)) {
+        return;
+    }
+
+    bool verificationRequired = false;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        verificationRequired = !servedEntries.empty() || dirty;
+    }
+    if (verificationRequired) {
+        verification = std::async(std::launch::async, [this, queryFunction]() { verify(queryFunction); });
+    }
+}
+
+void DrmQuerySnapshot::waitForVerification() {
+    if (verification.valid()) {
+        verification.wait();
+    }
+}
+
+void DrmQuerySnapshot::verify(QueryFunction queryFunction) {
+    std::set<EntryKey> entriesToVerify;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        entriesToVerify = servedEntries;
+    }
+
+    for (auto &entryKey : entriesToVerify) {
+        auto data = queryFunction(entryKey.first, entryKey.second);
+
+        std::lock_guard<std::mutex> lock(mtx);
+        auto &entry = entries[entryKey];
+        if (entry != data) {
+            PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr,
+                               "DRM query snapshot mismatch for query %u flags %u, refreshing %s\n", entryKey.first, entryKey.second, filePath.c_str());
+            statistics.verificationMismatches++;
+            if (data.empty()) {
+                entries.erase(entryKey);
+            } else {
+                entry = std::move(data);
+            }
+            dirty = true;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!dirty) {
+            return;
+        }
+        dirty = false;
+    }
+    saveToFile(serialize());
+}
+
+std::vector<uint8_t> DrmQuerySnapshot::serialize() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<uint8_t> data;
+    append(data, fileMagic);
+    append(data, fileVersion);
+    append(data, static_cast<uint32_t>(key.size()));
+    data.insert(data.end(), key.begin(), key.end());
+    append(data, static_cast<uint32_t>(entries.size()));
+    for (auto &entry : entries) {
+        append(data, entry.first.first);
+        append(data, entry.first.second);
+        append(data, static_cast<uint32_t>(entry.second.size()));
+        data.insert(data.end(), entry.second.begin(), entry.second.end());
+    }
+    return data;
+}
+
+bool DrmQuerySnapshot::deserialize(const uint8_t *data, size_t size) {
+    SnapshotReader reader{data, size};
+
+    uint64_t magic = 0u;
+    uint32_t version = 0u;
+    uint32_t keySize = 0u;
+    if (!reader.read(magic) || magic != fileMagic ||
+        !reader.read(version) || version != fileVersion ||
+        !reader.read(keySize)) {
+        return false;
+    }
+    auto storedKey = reader.skip(keySize);
+    if (storedKey == nullptr || keySize != key.size() || memcmp(storedKey, key.data(), keySize) != 0) {
+        return false;
+    }
+
+    uint32_t entriesCount = 0u;
+    if (!reader.read(entriesCount)) {
+        return false;
+    }
+    decltype(entries) loadedEntries;
+    for (uint32_t i = 0; i < entriesCount; i++) {
+        uint32_t queryId = 0u;
+        uint32_t queryItemFlags = 0u;
+        uint32_t entrySize = 0u;
+        if (!reader.read(queryId) || !reader.read(queryItemFlags) || !reader.read(entrySize)) {
+            return false;
+        }
+        auto entryData = reader.skip(entrySize);
+        if (entryData == nullptr) {
+            return false;
+        }
+        loadedEntries[{queryId, queryItemFlags}].assign(entryData, entryData + entrySize);
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    entries = std::move(loadedEntries);
+    return true;
+}
+
+DrmQuerySnapshot::Statistics DrmQuerySnapshot::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+
+std::vector<uint8_t> DrmQuerySnapshot::loadFromFile() {
+    size_t size = 0u;
+    auto data = loadDataFromFile(filePath.c_str(), size);
+    if (data == nullptr || size == 0u) {
+        return {};
+    }
+    return std::vector<uint8_t>(data.get(), data.get() + size);
+}
+
+bool DrmQuerySnapshot::saveToFile(const std::vector<uint8_t> &data) {
+    // written to temporary file first, so concurrently starting processes never read partial snapshot
+    auto tmpFilePath = filePath + "." + std::to_string(SysCalls::getProcessId()) + ".tmp";
+    if (writeDataToFile(tmpFilePath.c_str(), data.data(), data.size()) != data.size()) {
+        return false;
+    }
+    if (SysCalls::rename(tmpFilePath.c_str(), filePath.c_str()) != 0) {
+        SysCalls::unlink(tmpFilePath);
+        return false;
+    }
+    return true;
+}
+
+} // namespace NEO
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+
+// On-disk snapshot of static DRM query results (topology, engines, hwconfig table) used during driver startup.
+// Snapshot is identified by key describing device, KMD and driver build, content of a snapshot created for
+// a different key is ignored. Results served from snapshot are verified against KMD asynchronously once
+// startup completes, mismatching or missing results are written back to the snapshot file.
+class DrmQuerySnapshot : NonCopyableOrMovableClass {
+  public:
+    using QueryFunction = std::function<std::vector<uint8_t>(uint32_t queryId, uint32_t queryItemFlags)>;
+
+    static constexpr uint64_t fileMagic = 0x53514d52444f454eu; // "NEODRMQS"
+    static constexpr uint32_t fileVersion = 1u;
+
+    struct Statistics {
+        uint32_t hits = 0u;
+        uint32_t misses = 0u;
+        uint32_t verificationMismatches = 0u;
+    };
+
+    DrmQuerySnapshot(const std::string &filePath, const std::string &key);
+    MOCKABLE_VIRTUAL ~DrmQuerySnapshot();
+
+    void addCacheableQuery(uint32_t queryId);
+    bool isCacheable(uint32_t queryId) const;
+
+    bool load();
+    bool find(uint32_t queryId, uint32_t queryItemFlags, std::vector<uint8_t> &data);
+    void store(uint32_t queryId, uint32_t queryItemFlags, const std::vector<uint8_t> &data);
+
+    void completeStartup(QueryFunction queryFunction);
+    void waitForVerification();
+
+    std::vector<uint8_t> serialize() const;
+    bool deserialize(const uint8_t *data, size_t size);
+
+    Statistics getStatistics() const;
+    const std::string &getFilePath() const { return filePath; }
+
+  protected:
+    using EntryKey = std::pair<uint32_t, uint32_t>;
+
+    void verify(QueryFunction queryFunction);
+    MOCKABLE_VIRTUAL std::vector<uint8_t> loadFromFile();
+    MOCKABLE_VIRTUAL bool saveToFile(const std::vector<uint8_t> &data);
+
+    const std::string filePath;
+    const std::string key;
+
+    mutable std::mutex mtx;
+    std::set<uint32_t> cacheableQueries;
+    std::map<EntryKey, std::vector<uint8_t>> entries;
+    std::set<EntryKey> servedEntries;
+    Statistics statistics;
+    bool dirty = false;
+    std::atomic<bool> startupCompleted{false};
+
+    std::future<void> verification;
+};
+} // namespace NEO
@@ -47,7 +47,10 @@ bool initDrmOsInterface(std::unique_ptr<HwDeviceId> &&hwDeviceId, uint32_t rootD
     dstOsInterface->setDriverModel(std::unique_ptr<DriverModel>(drm));
     auto hardwareInfo = rootDeviceEnv->getMutableHardwareInfo();
     auto &productHelper = rootDeviceEnv->getHelper<ProductHelper>();
-    if (productHelper.configureHwInfoDrm(hardwareInfo, hardwareInfo, *rootDeviceEnv)) {
+    auto configureStatus = productHelper.configureHwInfoDrm(hardwareInfo, hardwareInfo, *rootDeviceEnv);
+    drm->markStartupPhase("configureHwInfoDrm");
+    drm->completeStartup();
+    if (configureStatus) {
         return false;
     }
     rootDeviceEnv->memoryOperationsInterface = DrmMemoryOperationsHandler::create(*drm, rootDeviceIndex);
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/program/heap_info.h"
+#include "shared/source/program/printf_format_plan.h"
 #include "shared/source/utilities/arrayref.h"
 
 #include <cstdint>
@@ -102,6 +103,8 @@ struct KernelInfo {
 
     uint64_t shaderHashCode;
     KernelDescriptor kernelDescriptor;
+
+    mutable PrintfFormatPlanCache printfFormatPlans;
 };
 
 std::string concatenateKernelNames(ArrayRef<KernelInfo *> kernelInfos);
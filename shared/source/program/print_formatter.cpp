@@ -7,6 +7,8 @@
 
 #include "print_formatter.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 
 #include <iostream>
@@ -14,14 +16,20 @@
 namespace NEO {
 
 PrintFormatter::PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferMaxSize,
-                               bool using32BitPointers, const StringMap *stringLiteralMap)
-    : printfOutputBuffer(printfOutputBuffer),
+                               bool using32BitPointers, const StringMap *stringLiteralMap,
+                               PrintfFormatPlanCache *formatPlans)
+    : formatPlans(formatPlans != nullptr ? formatPlans : &localFormatPlans),
+      printfOutputBuffer(printfOutputBuffer),
       printfOutputBufferSize(printfOutputBufferMaxSize),
       using32BitPointers(using32BitPointers),
       usesStringMap(stringLiteralMap != nullptr),
       stringLiteralMap(stringLiteralMap) {
 
     output.reset(new char[maxSinglePrintStringLength]);
+
+    if (DebugManager.flags.PrintfOutputFlushThreshold.get() != -1) {
+        outputFlushThreshold = static_cast<size_t>(DebugManager.flags.PrintfOutputFlushThreshold.get());
+    }
 }
 
 void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print) {
@@ -32,13 +40,18 @@ void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print)
     read(&printfOutputBufferSizeRead);
     printfOutputBufferSize = std::min(printfOutputBufferSizeRead, printfOutputBufferSize);
 
+    auto lock = formatPlans->obtainLock();
+
     if (usesStringMap) {
         uint32_t stringIndex = 0;
         while (currentOffset + 4 <= printfOutputBufferSize) {
             read(&stringIndex);
-            const char *formatString = queryPrintfString(stringIndex);
-            if (formatString != nullptr) {
-                printString(formatString, print);
+            auto formatPlan = queryFormatPlan(stringIndex);
+            if (formatPlan != nullptr) {
+                printString(*formatPlan);
+            }
+            if (outputBuffer.size() >= outputFlushThreshold) {
+                flushOutput(print);
             }
         }
     } else {
@@ -46,25 +59,48 @@ void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print)
             char *formatString = nullptr;
             read(&formatString);
             if (formatString != nullptr) {
-                printString(formatString, print);
+                printString(*queryFormatPlan(formatString));
+            }
+            if (outputBuffer.size() >= outputFlushThreshold) {
+                flushOutput(print);
             }
         }
     }
+    flushOutput(print);
 }
 
-void PrintFormatter::printString(const char *formatString, const std::function<void(char *)> &print) {
-    size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
+const PrintfFormatPlan *PrintFormatter::queryFormatPlan(uint32_t stringIndex) {
+    auto formatPlan = formatPlans->find(stringIndex);
+    if (formatPlan == nullptr) {
+        const char *formatString = queryPrintfString(stringIndex);
+        if (formatString != nullptr) {
+            formatPlan = &formatPlans->add(stringIndex, createFormatPlan(formatString));
+        }
+    }
+    return formatPlan;
+}
 
-    size_t cursor = 0;
-    std::unique_ptr<char[]> dataFormat(new char[length + 1]);
+const PrintfFormatPlan *PrintFormatter::queryFormatPlan(const char *formatString) {
+    auto key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(formatString));
+    auto formatPlan = formatPlans->find(key);
+    if (formatPlan == nullptr) {
+        formatPlan = &formatPlans->add(key, createFormatPlan(formatString));
+    }
+    return formatPlan;
+}
 
-    for (size_t i = 0; i <= length; i++) {
+PrintfFormatPlan PrintFormatter::createFormatPlan(const char *formatString) {
+    size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
+
+    PrintfFormatPlan formatPlan;
+    PrintfFormatPlan::Segment segment;
+    for (size_t i = 0; i < length; i++) {
         if (formatString[i] == '\\')
-            output[cursor++] = escapeChar(formatString[++i]);
+            segment.literal += escapeChar(formatString[++i]);
         else if (formatString[i] == '%') {
             size_t end = i;
             if (end + 1 <= length && formatString[end + 1] == '%') {
-                output[cursor++] = '%';
+                segment.literal += '%';
                 i++;
                 continue;
             }
@@ -72,35 +108,80 @@ void PrintFormatter::printString(const char *formatString, const std::function<v
             while (isConversionSpecifier(formatString[end++]) == false && end < length)
                 ;
 
-            memcpy_s(dataFormat.get(), length, formatString + i, end - i);
-            dataFormat[end - i] = '\0';
+            auto &conversion = segment.conversion;
+            segment.hasConversion = true;
+            conversion.format.assign(formatString + i, end - i);
+            conversion.isString = formatString[end - 1] == 's';
 
-            if (formatString[end - 1] == 's')
-                cursor += printStringToken(output.get() + cursor, maxSinglePrintStringLength - cursor, dataFormat.get());
-            else
-                cursor += printToken(output.get() + cursor, maxSinglePrintStringLength - cursor, dataFormat.get());
+            std::unique_ptr<char[]> strippedFormat(new char[conversion.format.size() + 1]);
+            stripVectorFormat(conversion.format.c_str(), strippedFormat.get());
+            stripVectorTypeConversion(strippedFormat.get());
+            conversion.vectorFormat = strippedFormat.get();
 
+            conversion.longFormat = conversion.format;
+            if (!adjustLongFormatString(conversion.longFormat)) {
+                conversion.longFormat.clear();
+            }
+            conversion.vectorLongFormat = conversion.vectorFormat;
+            if (!adjustLongFormatString(conversion.vectorLongFormat)) {
+                conversion.vectorLongFormat.clear();
+            }
+
+            formatPlan.segments.push_back(std::move(segment));
+            segment = {};
             i = end - 1;
         } else {
-            output[cursor++] = formatString[i];
+            segment.literal += formatString[i];
+        }
+    }
+    if (!segment.literal.empty()) {
+        formatPlan.segments.push_back(std::move(segment));
+    }
+    return formatPlan;
+}
+
+void PrintFormatter::printString(const PrintfFormatPlan &formatPlan) {
+    const size_t maxCursor = maxSinglePrintStringLength - 1;
+    size_t cursor = 0;
+
+    for (const auto &segment : formatPlan.segments) {
+        auto literalLength = std::min(segment.literal.size(), maxCursor - cursor);
+        memcpy_s(output.get() + cursor, maxSinglePrintStringLength - cursor, segment.literal.data(), literalLength);
+        cursor += literalLength;
+
+        if (segment.hasConversion) {
+            if (segment.conversion.isString)
+                cursor += printStringToken(output.get() + cursor, maxSinglePrintStringLength - cursor, segment.conversion.format.c_str());
+            else
+                cursor += printToken(output.get() + cursor, maxSinglePrintStringLength - cursor, segment.conversion);
+            cursor = std::min(cursor, maxCursor);
         }
     }
-    output[maxSinglePrintStringLength - 1] = '\0';
-    print(output.get());
+    output[cursor] = '\0';
+
+    // printed text ends at first null character, same as if it was passed to print callback directly
+    outputBuffer.append(output.get(), strnlen_s(output.get(), cursor));
+}
+
+void PrintFormatter::flushOutput(const std::function<void(char *)> &print) {
+    if (outputBuffer.empty()) {
+        return;
+    }
+    print(&outputBuffer[0]);
+    outputBuffer.clear();
 }
 
 void PrintFormatter::stripVectorFormat(const char *format, char *stripped) {
     while (*format != '\0') {
-        if (*format != 'v') {
-            *stripped = *format;
-        } else if (*(format + 1) != '1') {
-            format += 2;
-            continue;
-
-        } else {
-            format += 3;
+        if (*format == 'v') {
+            // skip vector size: v2, v3, v4, v8 or v16
+            size_t skip = *(format + 1) != '1' ? 2 : 3;
+            while (skip-- > 0 && *format != '\0') {
+                format++;
+            }
             continue;
         }
+        *stripped = *format;
         stripped++;
         format++;
     }
@@ -115,24 +196,29 @@ void PrintFormatter::stripVectorTypeConversion(char *format) {
     }
 }
 
-template <>
-void PrintFormatter::adjustFormatString<int64_t>(std::string &formatString) {
+bool PrintFormatter::adjustLongFormatString(std::string &formatString) {
     auto longPosition = formatString.find('l');
 
     if (longPosition == std::string::npos) {
-        return;
+        return true;
+    }
+    if (formatString.size() - 1 == longPosition) {
+        return false;
     }
-    UNRECOVERABLE_IF(formatString.size() - 1 == longPosition);
 
     if (formatString.at(longPosition + 1) != 'l') {
         formatString.insert(longPosition, "l");
     }
+    return true;
 }
 
-size_t PrintFormatter::printToken(char *output, size_t size, const char *formatString) {
+size_t PrintFormatter::printToken(char *output, size_t size, const PrintfFormatPlan::Conversion &conversion) {
     PRINTF_DATA_TYPE type(PRINTF_DATA_TYPE::INVALID);
     read(&type);
 
+    const char *formatString = conversion.format.c_str();
+    const char *vectorFormatString = conversion.vectorFormat.c_str();
+
     switch (type) {
     case PRINTF_DATA_TYPE::BYTE:
         return typedPrintToken<int8_t>(output, size, formatString);
@@ -143,23 +229,25 @@ size_t PrintFormatter::printToken(char *output, size_t size, const char *formatS
     case PRINTF_DATA_TYPE::FLOAT:
         return typedPrintToken<float>(output, size, formatString);
     case PRINTF_DATA_TYPE::LONG:
-        return typedPrintToken<int64_t>(output, size, formatString);
+        UNRECOVERABLE_IF(conversion.longFormat.empty());
+        return typedPrintToken<int64_t>(output, size, conversion.longFormat.c_str());
     case PRINTF_DATA_TYPE::POINTER:
         return printPointerToken(output, size, formatString);
     case PRINTF_DATA_TYPE::DOUBLE:
         return typedPrintToken<double>(output, size, formatString);
     case PRINTF_DATA_TYPE::VECTOR_BYTE:
-        return typedPrintVectorToken<int8_t>(output, size, formatString);
+        return typedPrintVectorToken<int8_t>(output, size, vectorFormatString);
     case PRINTF_DATA_TYPE::VECTOR_SHORT:
-        return typedPrintVectorToken<int16_t>(output, size, formatString);
+        return typedPrintVectorToken<int16_t>(output, size, vectorFormatString);
     case PRINTF_DATA_TYPE::VECTOR_INT:
-        return typedPrintVectorToken<int>(output, size, formatString);
+        return typedPrintVectorToken<int>(output, size, vectorFormatString);
     case PRINTF_DATA_TYPE::VECTOR_LONG:
-        return typedPrintVectorToken<int64_t>(output, size, formatString);
+        UNRECOVERABLE_IF(conversion.vectorLongFormat.empty());
+        return typedPrintVectorToken<int64_t>(output, size, conversion.vectorLongFormat.c_str());
     case PRINTF_DATA_TYPE::VECTOR_FLOAT:
-        return typedPrintVectorToken<float>(output, size, formatString);
+        return typedPrintVectorToken<float>(output, size, vectorFormatString);
     case PRINTF_DATA_TYPE::VECTOR_DOUBLE:
-        return typedPrintVectorToken<double>(output, size, formatString);
+        return typedPrintVectorToken<double>(output, size, vectorFormatString);
     default:
         return 0;
     }
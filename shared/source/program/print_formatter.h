@@ -10,7 +10,9 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/os_interface/print.h"
+#include "shared/source/program/printf_format_plan.h"
 
+#include <algorithm>
 #include <cctype>
 #include <cstdint>
 #include <functional>
@@ -46,22 +48,30 @@ static_assert(sizeof(PRINTF_DATA_TYPE) == sizeof(int));
 class PrintFormatter {
   public:
     PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferMaxSize,
-                   bool using32BitPointers, const StringMap *stringLiteralMap = nullptr);
+                   bool using32BitPointers, const StringMap *stringLiteralMap = nullptr,
+                   PrintfFormatPlanCache *formatPlans = nullptr);
     void printKernelOutput(const std::function<void(char *)> &print = [](char *str) { printToStdout(str); });
 
+    static PrintfFormatPlan createFormatPlan(const char *formatString);
+
     constexpr static size_t maxSinglePrintStringLength = 16 * MemoryConstants::kiloByte;
+    constexpr static size_t defaultOutputFlushThreshold = MemoryConstants::megaByte;
 
   protected:
     const char *queryPrintfString(uint32_t index) const;
-    void printString(const char *formatString, const std::function<void(char *)> &print);
-    size_t printToken(char *output, size_t size, const char *formatString);
+    const PrintfFormatPlan *queryFormatPlan(uint32_t stringIndex);
+    const PrintfFormatPlan *queryFormatPlan(const char *formatString);
+    void printString(const PrintfFormatPlan &formatPlan);
+    void flushOutput(const std::function<void(char *)> &print);
+    size_t printToken(char *output, size_t size, const PrintfFormatPlan::Conversion &conversion);
     size_t printStringToken(char *output, size_t size, const char *formatString);
     size_t printPointerToken(char *output, size_t size, const char *formatString);
 
-    char escapeChar(char escape);
-    bool isConversionSpecifier(char c);
-    void stripVectorFormat(const char *format, char *stripped);
-    void stripVectorTypeConversion(char *format);
+    static char escapeChar(char escape);
+    static bool isConversionSpecifier(char c);
+    static void stripVectorFormat(const char *format, char *stripped);
+    static void stripVectorTypeConversion(char *format);
+    static bool adjustLongFormatString(std::string &formatString);
 
     template <class T>
     bool read(T *value) {
@@ -81,37 +91,27 @@ class PrintFormatter {
     }
 
     template <class T>
-    void adjustFormatString(std::string &formatString) {}
-
-    template <class T>
-    size_t typedPrintToken(char *output, size_t size, const char *inputFormatString) {
+    size_t typedPrintToken(char *output, size_t size, const char *formatString) {
         T value{0};
         read(&value);
         currentOffset = alignUp(currentOffset, sizeof(uint32_t));
-        std::string formatString(inputFormatString);
-        adjustFormatString<T>(formatString);
-        return simpleSprintf(output, size, formatString.c_str(), value);
+        return simpleSprintf(output, size, formatString, value);
     }
 
     template <class T>
-    size_t typedPrintVectorToken(char *output, size_t size, const char *inputFormatString) {
+    size_t typedPrintVectorToken(char *output, size_t size, const char *formatString) {
         T value = {0};
         int valueCount = 0;
         read(&valueCount);
 
         size_t charactersPrinted = 0;
-        char strippedFormat[1024]{};
-
-        stripVectorFormat(inputFormatString, strippedFormat);
-        stripVectorTypeConversion(strippedFormat);
-        std::string formatString(strippedFormat);
-        adjustFormatString<T>(formatString);
-
         for (int i = 0; i < valueCount; i++) {
             read(&value);
-            charactersPrinted += simpleSprintf(output + charactersPrinted, size - charactersPrinted, formatString.c_str(), value);
+            charactersPrinted += simpleSprintf(output + charactersPrinted, size - charactersPrinted, formatString, value);
+            charactersPrinted = std::min(charactersPrinted, size - 1);
             if (i < valueCount - 1) {
                 charactersPrinted += simpleSprintf(output + charactersPrinted, size - charactersPrinted, "%c", ',');
+                charactersPrinted = std::min(charactersPrinted, size - 1);
             }
         }
 
@@ -122,7 +122,12 @@ class PrintFormatter {
         return charactersPrinted;
     }
 
-    std::unique_ptr<char[]> output;
+    std::unique_ptr<char[]> output; // output of single printf call
+    std::string outputBuffer;        // output of consecutive printf calls, printed at once
+    size_t outputFlushThreshold = defaultOutputFlushThreshold;
+
+    PrintfFormatPlanCache localFormatPlans;
+    PrintfFormatPlanCache *formatPlans = nullptr;
 
     const uint8_t *printfOutputBuffer = nullptr; // buffer extracted from the kernel, contains values to be printed
     uint32_t printfOutputBufferSize = 0;         // size of the data contained in the buffer
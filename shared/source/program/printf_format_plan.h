@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+
+// Printf format string split into literal text and conversion specifications.
+// Created once per format string, so printf records do not need to scan it again.
+struct PrintfFormatPlan {
+    struct Conversion {
+        std::string format;           // conversion specification as written, e.g. "%5.2f"
+        std::string longFormat;       // with "ll" length modifier for 64-bit integers, empty when not applicable
+        std::string vectorFormat;     // with vector size and "hl" modifier stripped
+        std::string vectorLongFormat; // vectorFormat with "ll" length modifier, empty when not applicable
+        bool isString = false;
+    };
+
+    struct Segment {
+        std::string literal; // text printed before conversion, escape sequences already resolved
+        bool hasConversion = false;
+        Conversion conversion;
+    };
+
+    std::vector<Segment> segments;
+};
+
+// Format plans of a single kernel, keyed by printf string index or by format string address
+// when kernel does not use printf string map.
+class PrintfFormatPlanCache : NonCopyableOrMovableClass {
+  public:
+    std::unique_lock<std::mutex> obtainLock() {
+        return std::unique_lock<std::mutex>(mtx);
+    }
+
+    const PrintfFormatPlan *find(uint64_t key) const {
+        auto plan = plans.find(key);
+        return plan == plans.end() ? nullptr : &plan->second;
+    }
+
+    const PrintfFormatPlan &add(uint64_t key, PrintfFormatPlan &&plan) {
+        return plans.emplace(key, std::move(plan)).first->second;
+    }
+
+    size_t size() const {
+        return plans.size();
+    }
+
+  protected:
+    std::mutex mtx;
+    std::unordered_map<uint64_t, PrintfFormatPlan> plans;
+};
+} // namespace NEO
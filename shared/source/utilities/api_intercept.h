@@ -1,13 +1,22 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
-#define SYSTEM_ENTER()
-#define SYSTEM_LEAVE(id)
+#include "shared/source/utilities/perf_profiler.h"
+
+#define SYSTEM_ENTER()                                                          \
+    auto perfProfilerForSystemCall = NEO::PerfProfiler::getHistogramProfiler(); \
+    if (perfProfilerForSystemCall) {                                            \
+        perfProfilerForSystemCall->systemEnter();                               \
+    }
+#define SYSTEM_LEAVE(id)                                                       \
+    if (perfProfilerForSystemCall) {                                           \
+        perfProfilerForSystemCall->systemLeave(static_cast<unsigned int>(id)); \
+    }
 #define WAIT_ENTER()
 #define WAIT_LEAVE()
 
@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/binary_trace_logger.h"
+
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/io_functions.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <thread>
+
+namespace NEO {
+
+namespace {
+std::atomic<uint64_t> binaryTraceLoggerInstanceCounter{0u};
+} // namespace
+
+thread_local BinaryTraceLogger::ThreadRingCache BinaryTraceLogger::threadRingCache;
+
+BinaryTraceLogger::ThreadRingCache::~ThreadRingCache() {
+    retire();
+}
+
+void BinaryTraceLogger::ThreadRingCache::retire() {
+    if (ring) {
+        ring->retired.store(true, std::memory_order_release);
+        ring.reset();
+    }
+    instanceId = 0u;
+}
+
+BinaryTraceLogger::BinaryTraceLogger(std::string filename, bool startWriterThread) : fileName(std::move(filename)),
+                                                                                      instanceId(++binaryTraceLoggerInstanceCounter) {
+    if (!fileName.empty()) {
+        file = IoFunctions::fopenPtr(fileName.c_str(), "wb");
+    }
+
+    if (startWriterThread) {
+        writerThread = Thread::create(writerLoop, reinterpret_cast<void *>(this));
+    }
+}
+
+BinaryTraceLogger::~BinaryTraceLogger() {
+    stopWriterThread();
+    drainRings();
+    if (file) {
+        IoFunctions::fclosePtr(file);
+        file = nullptr;
+    }
+}
+
+void BinaryTraceLogger::stopWriterThread() {
+    keepWriting.store(false);
+    if (writerThread) {
+        writerThread->join();
+        writerThread.reset();
+    }
+}
+
+BinaryTraceLogger::ThreadRing *BinaryTraceLogger::getThreadRing() {
+    if (threadRingCache.instanceId == instanceId) {
+        return threadRingCache.ring.get();
+    }
+
+    threadRingCache.retire();
+    auto ring = std::make_shared<ThreadRing>();
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        ring->threadId = ringsCreated++;
+        rings.push_back(ring);
+    }
+    threadRingCache.instanceId = instanceId;
+    threadRingCache.ring = ring;
+    return ring.get();
+}
+
+void BinaryTraceLogger::logApiCall(const char *function, bool enter, int32_t errorCode) {
+    auto ring = getThreadRing();
+
+    auto head = ring->head.load(std::memory_order_relaxed);
+    if (head - ring->tail.load(std::memory_order_acquire) >= ringCapacity) {
+        droppedCount.fetch_add(1u, std::memory_order_relaxed);
+        return;
+    }
+
+    auto &entry = ring->entries[head % ringCapacity];
+    entry.function = function;
+    entry.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    entry.errorCode = errorCode;
+    entry.type = enter ? RecordType::ApiEnter : RecordType::ApiLeave;
+
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+void BinaryTraceLogger::flush() {
+    drainRings();
+    if (file) {
+        IoFunctions::fflushPtr(file);
+    }
+}
+
+void BinaryTraceLogger::drainRings() {
+    std::lock_guard<std::mutex> drainLock(drainMutex);
+
+    std::vector<std::shared_ptr<ThreadRing>> ringsToDrain;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        ringsToDrain = rings;
+    }
+    std::vector<ThreadRing *> retiredRings;
+
+    writeBuffer.clear();
+    if (!headerWritten) {
+        writeBuffer.insert(writeBuffer.end(), fileMagic.begin(), fileMagic.end());
+        headerWritten = true;
+    }
+    auto appendRecord = [this](const FileRecord &record) {
+        auto recordBytes = reinterpret_cast<const char *>(&record);
+        writeBuffer.insert(writeBuffer.end(), recordBytes, recordBytes + sizeof(FileRecord));
+    };
+
+    for (auto &ring : ringsToDrain) {
+        // retired is read before head, so records written before retiring are drained now
+        auto retired = ring->retired.load(std::memory_order_acquire);
+        auto tail = ring->tail.load(std::memory_order_relaxed);
+        auto head = ring->head.load(std::memory_order_acquire);
+        for (; tail != head; tail++) {
+            auto &entry = ring->entries[tail % ringCapacity];
+
+            auto functionIt = functionIds.find(entry.function);
+            if (functionIt == functionIds.end()) {
+                auto nameLength = strlen(entry.function);
+                FileRecord nameRecord = {};
+                nameRecord.functionId = static_cast<uint32_t>(functionIds.size());
+                nameRecord.value = static_cast<int32_t>(nameLength);
+                nameRecord.type = RecordType::FunctionName;
+                appendRecord(nameRecord);
+                writeBuffer.insert(writeBuffer.end(), entry.function, entry.function + nameLength);
+                functionIt = functionIds.emplace(entry.function, nameRecord.functionId).first;
+            }
+
+            FileRecord record = {};
+            record.timestamp = entry.timestamp;
+            record.threadId = ring->threadId;
+            record.functionId = functionIt->second;
+            record.value = entry.errorCode;
+            record.type = entry.type;
+            appendRecord(record);
+        }
+        ring->tail.store(tail, std::memory_order_release);
+        if (retired) {
+            retiredRings.push_back(ring.get());
+        }
+    }
+
+    if (!retiredRings.empty()) {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        rings.erase(std::remove_if(rings.begin(), rings.end(), [&retiredRings](const std::shared_ptr<ThreadRing> &ring) {
+                        return std::find(retiredRings.begin(), retiredRings.end(), ring.get()) != retiredRings.end();
+                    }),
+                    rings.end());
+    }
+
+    auto dropped = droppedCount.load(std::memory_order_relaxed);
+    if (dropped != droppedReported) {
+        FileRecord droppedRecord = {};
+        droppedRecord.value = static_cast<int32_t>(dropped - droppedReported);
+        droppedRecord.type = RecordType::Dropped;
+        appendRecord(droppedRecord);
+        droppedReported = dropped;
+    }
+
+    if (!writeBuffer.empty()) {
+        writeRecords(writeBuffer.data(), writeBuffer.size());
+    }
+}
+
+void *BinaryTraceLogger::writerLoop(void *self) {
+    auto logger = reinterpret_cast<BinaryTraceLogger *>(self);
+    while (logger->keepWriting.load()) {
+        std::this_thread::sleep_for(logger->drainInterval);
+        logger->drainRings();
+    }
+    return nullptr;
+}
+
+void BinaryTraceLogger::writeRecords(const char *data, size_t size) {
+    if (file) {
+        IoFunctions::fwritePtr(data, 1, size, file);
+    }
+}
+
+std::string BinaryTraceLogger::decode(ArrayRef<const char> binaryTrace) {
+    std::stringstream ss;
+    if (binaryTrace.size() < fileMagic.size() || memcmp(binaryTrace.begin(), fileMagic.data(), fileMagic.size()) != 0) {
+        return ss.str();
+    }
+
+    std::vector<std::string> functionNames;
+    size_t offset = fileMagic.size();
+    while (offset + sizeof(FileRecord) <= binaryTrace.size()) {
+        FileRecord record;
+        memcpy(&record, binaryTrace.begin() + offset, sizeof(FileRecord));
+        offset += sizeof(FileRecord);
+
+        switch (record.type) {
+        case RecordType::FunctionName: {
+            auto nameLength = static_cast<size_t>(record.value);
+            if (offset + nameLength > binaryTrace.size()) {
+                return ss.str();
+            }
+            if (functionNames.size() <= record.functionId) {
+                functionNames.resize(record.functionId + 1);
+            }
+            functionNames[record.functionId] = std::string(binaryTrace.begin() + offset, nameLength);
+            offset += nameLength;
+            break;
+        }
+        case RecordType::ApiEnter:
+        case RecordType::ApiLeave: {
+            const char *name = record.functionId < functionNames.size() ? functionNames[record.functionId].c_str() : "";
+            ss << "ThreadID: " << record.threadId << " ";
+            if (record.type == RecordType::ApiEnter) {
+                ss << "Function Enter: ";
+            } else {
+                ss << "Function Leave (" << record.value << "): ";
+            }
+            ss << name << std::endl;
+            break;
+        }
+        case RecordType::Dropped:
+            ss << "Dropped records: " << record.value << std::endl;
+            break;
+        default:
+            return ss.str();
+        }
+    }
+    return ss.str();
+}
+
+} // namespace NEO
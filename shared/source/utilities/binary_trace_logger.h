@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/utilities/arrayref.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Low overhead API call logger: every API thread appends compact records to its own
+// single-producer ring, a background thread drains all rings into one binary file.
+// Use decode() to render the file in the same text format as FileLogger::logApiCall.
+class BinaryTraceLogger {
+  public:
+    enum class RecordType : uint8_t {
+        FunctionName = 0,
+        ApiEnter,
+        ApiLeave,
+        Dropped
+    };
+
+#pragma pack(push, 1)
+    struct FileRecord {
+        uint64_t timestamp;
+        uint32_t threadId;
+        uint32_t functionId;
+        int32_t value; // error code, name length or dropped count
+        RecordType type;
+        uint8_t reserved[3];
+    };
+#pragma pack(pop)
+    static_assert(sizeof(FileRecord) == 24, "Binary trace file layout must be stable");
+
+    static constexpr uint32_t ringCapacity = 4096u;
+    static constexpr std::array<char, 8> fileMagic = {'N', 'E', 'O', 'T', 'R', 'C', '0', '1'};
+
+    BinaryTraceLogger(std::string filename, bool startWriterThread);
+    MOCKABLE_VIRTUAL ~BinaryTraceLogger();
+
+    BinaryTraceLogger(const BinaryTraceLogger &) = delete;
+    BinaryTraceLogger &operator=(const BinaryTraceLogger &) = delete;
+
+    void logApiCall(const char *function, bool enter, int32_t errorCode);
+    void flush();
+
+    uint64_t getDroppedCount() const { return droppedCount.load(); }
+    const std::string &getFileName() const { return fileName; }
+
+    static std::string decode(ArrayRef<const char> binaryTrace);
+
+  protected:
+    struct RingEntry {
+        const char *function;
+        uint64_t timestamp;
+        int32_t errorCode;
+        RecordType type;
+    };
+
+    struct ThreadRing {
+        std::array<RingEntry, ringCapacity> entries;
+        std::atomic<uint32_t> head{0u}; // written by producer only
+        std::atomic<uint32_t> tail{0u}; // written by writer only
+        std::atomic<bool> retired{false}; // set once producer stops using the ring
+        uint32_t threadId = 0u;
+    };
+
+    // Ring of the logger last used by a thread, shared with the logger so either of them can go first.
+    // The ring is retired on thread exit and dropped by the draining thread after its final drain.
+    struct ThreadRingCache {
+        ~ThreadRingCache();
+        void retire();
+        uint64_t instanceId = 0u;
+        std::shared_ptr<ThreadRing> ring;
+    };
+    static thread_local ThreadRingCache threadRingCache;
+
+    ThreadRing *getThreadRing();
+    void stopWriterThread();
+    void drainRings();
+    static void *writerLoop(void *self);
+    MOCKABLE_VIRTUAL void writeRecords(const char *data, size_t size);
+
+    std::string fileName;
+    FILE *file = nullptr;
+    const uint64_t instanceId;
+
+    std::mutex ringsMutex;
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    uint32_t ringsCreated = 0u;
+
+    // accessed by the draining thread only, serialized by drainMutex
+    std::mutex drainMutex;
+    std::unordered_map<const char *, uint32_t> functionIds;
+    std::vector<char> writeBuffer;
+    bool headerWritten = false;
+
+    std::atomic<uint64_t> droppedCount{0u};
+    uint64_t droppedReported = 0u;
+
+    std::atomic<bool> keepWriting{true};
+    std::chrono::microseconds drainInterval{1000};
+    std::unique_ptr<Thread> writerThread;
+};
+
+} // namespace NEO
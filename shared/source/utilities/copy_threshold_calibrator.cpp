@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/copy_threshold_calibrator.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/file_io.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace NEO {
+
+CopyThresholdCalibrator::CopyThresholdCalibrator() {
+    for (auto &threshold : thresholds) {
+        threshold = notCalibrated;
+    }
+}
+
+uint32_t CopyThresholdCalibrator::getSizeBucket(size_t size) {
+    if (size == 0u) {
+        return 0u;
+    }
+    return std::min(Math::log2(static_cast<uint64_t>(size)), sizeBucketCount - 1);
+}
+
+size_t CopyThresholdCalibrator::getThreshold(TransferType transferType, size_t defaultThreshold) const {
+    auto threshold = thresholds[transferType].load();
+    return threshold == notCalibrated ? defaultThreshold : threshold;
+}
+
+bool CopyThresholdCalibrator::isCalibrated(TransferType transferType) const {
+    return thresholds[transferType].load() != notCalibrated;
+}
+
+bool CopyThresholdCalibrator::isDirty() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return dirty;
+}
+
+bool CopyThresholdCalibrator::isExplorationNeeded(TransferType transferType, CopyPath path, size_t size, size_t currentThreshold) const {
+    auto bucket = getSizeBucket(size);
+    auto thresholdBucket = getSizeBucket(currentThreshold);
+    if (bucket + explorationWindow < thresholdBucket || bucket > thresholdBucket + explorationWindow) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics[transferType][static_cast<uint32_t>(path)][bucket].samples < minSamplesPerBucket;
+}
+
+void CopyThresholdCalibrator::recordSample(TransferType transferType, CopyPath path, size_t size, uint64_t nanoseconds) {
+    if (size == 0u) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &bucketStatistics = statistics[transferType][static_cast<uint32_t>(path)][getSizeBucket(size)];
+    bucketStatistics.samples++;
+    bucketStatistics.totalNanoseconds += nanoseconds;
+    bucketStatistics.totalBytes += size;
+    if (bucketStatistics.samples >= maxSamplesPerBucket) {
+        // keep adapting to changing conditions by halving the weight of older samples
+        bucketStatistics.samples /= 2;
+        bucketStatistics.totalNanoseconds /= 2;
+        bucketStatistics.totalBytes /= 2;
+    }
+    dirty = true;
+    updateThreshold(transferType);
+}
+
+void CopyThresholdCalibrator::updateThreshold(uint32_t transferType) {
+    auto &cpuBuckets = statistics[transferType][static_cast<uint32_t>(CopyPath::cpu)];
+    auto &gpuBuckets = statistics[transferType][static_cast<uint32_t>(CopyPath::gpu)];
+
+    size_t threshold = notCalibrated;
+    for (uint32_t bucket = 0u; bucket < sizeBucketCount; bucket++) {
+        auto &cpu = cpuBuckets[bucket];
+        auto &gpu = gpuBuckets[bucket];
+        if (cpu.samples < minSamplesPerBucket || gpu.samples < minSamplesPerBucket) {
+            continue;
+        }
+
+        // compare nanoseconds per byte of both paths
+        bool cpuFaster = static_cast<double>(cpu.totalNanoseconds) * static_cast<double>(gpu.totalBytes) <=
+                         static_cast<double>(gpu.totalNanoseconds) * static_cast<double>(cpu.totalBytes);
+        if (!cpuFaster) {
+            if (threshold == notCalibrated) {
+                threshold = bucket == 0u ? 0u : (static_cast<size_t>(1u) << bucket) - 1;
+            }
+            break;
+        }
+        threshold = (static_cast<size_t>(1u) << (bucket + 1)) - 1;
+    }
+
+    if (threshold != notCalibrated) {
+        thresholds[transferType] = threshold;
+    }
+}
+
+std::string CopyThresholdCalibrator::serialize() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::ostringstream stream;
+    stream << "# copy threshold calibration\n";
+    stream << "# threshold <transfer type> <bytes>\n";
+    stream << "# bucket <transfer type> <path: 0 - cpu, 1 - gpu> <size bucket> <samples> <nanoseconds> <bytes>\n";
+    for (uint32_t transferType = 0u; transferType < transferTypeCount; transferType++) {
+        auto threshold = thresholds[transferType].load();
+        if (threshold != notCalibrated) {
+            stream << "threshold " << transferType << " " << threshold << "\n";
+        }
+    }
+    for (uint32_t transferType = 0u; transferType < transferTypeCount; transferType++) {
+        for (uint32_t path = 0u; path < pathCount; path++) {
+            for (uint32_t bucket = 0u; bucket < sizeBucketCount; bucket++) {
+                auto &bucketStatistics = statistics[transferType][path][bucket];
+                if (bucketStatistics.samples == 0u) {
+                    continue;
+                }
+                stream << "bucket " << transferType << " " << path << " " << bucket << " "
+                       << bucketStatistics.samples << " " << bucketStatistics.totalNanoseconds << " " << bucketStatistics.totalBytes << "\n";
+            }
+        }
+    }
+    return stream.str();
+}
+
+bool CopyThresholdCalibrator::deserialize(const std::string &data) {
+    std::array<TransferTypeStatistics, transferTypeCount> loadedStatistics = {};
+
+    std::istringstream stream(data);
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream lineStream(line);
+        std::string tag;
+        lineStream >> tag;
+        if (tag == "threshold") {
+            // thresholds are derived from buckets, they are stored only to be inspected
+            continue;
+        }
+        uint32_t transferType = 0u;
+        uint32_t path = 0u;
+        uint32_t bucket = 0u;
+        BucketStatistics bucketStatistics;
+        lineStream >> transferType >> path >> bucket >> bucketStatistics.samples >> bucketStatistics.totalNanoseconds >> bucketStatistics.totalBytes;
+        if (tag != "bucket" || lineStream.fail() ||
+            transferType >= transferTypeCount || path >= pathCount || bucket >= sizeBucketCount) {
+            return false;
+        }
+        loadedStatistics[transferType][path][bucket] = bucketStatistics;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    statistics = loadedStatistics;
+    for (uint32_t transferType = 0u; transferType < transferTypeCount; transferType++) {
+        thresholds[transferType] = notCalibrated;
+        updateThreshold(transferType);
+    }
+    dirty = false;
+    return true;
+}
+
+bool CopyThresholdCalibrator::loadFromFile(const std::string &fileName) {
+    if (!fileExists(fileName)) {
+        return false;
+    }
+    size_t dataSize = 0u;
+    auto data = loadDataFromFile(fileName.c_str(), dataSize);
+    if (data == nullptr) {
+        return false;
+    }
+    return deserialize(std::string(data.get(), dataSize));
+}
+
+bool CopyThresholdCalibrator::saveToFile(const std::string &fileName) {
+    auto data = serialize();
+    if (writeDataToFile(fileName.c_str(), data.c_str(), data.size()) != data.size()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    dirty = false;
+    return true;
+}
+
+} // namespace NEO
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/unified_memory/unified_memory.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <string>
+
+namespace NEO {
+
+// Learns per transfer type the size below which a CPU copy is faster than a GPU copy.
+// Latencies of both paths are sampled from real copies in power of two size buckets;
+// the threshold is the end of the last bucket, in which the CPU path still wins.
+// Buckets around the current threshold, which lack samples for one of the paths,
+// are explored by sending a limited number of copies down that path.
+class CopyThresholdCalibrator {
+  public:
+    enum class CopyPath : uint32_t {
+        cpu = 0,
+        gpu = 1
+    };
+
+    static constexpr uint32_t transferTypeCount = SHARED_USM_TO_HOST_NON_USM + 1;
+    static constexpr uint32_t pathCount = 2u;
+    static constexpr uint32_t sizeBucketCount = 32u;
+    static constexpr uint32_t explorationWindow = 2u;
+    static constexpr uint32_t minSamplesPerBucket = 4u;
+    static constexpr uint32_t maxSamplesPerBucket = 64u;
+
+    struct BucketStatistics {
+        uint64_t samples = 0u;
+        uint64_t totalNanoseconds = 0u;
+        uint64_t totalBytes = 0u;
+    };
+
+    CopyThresholdCalibrator();
+
+    size_t getThreshold(TransferType transferType, size_t defaultThreshold) const;
+    bool isCalibrated(TransferType transferType) const;
+
+    bool isExplorationNeeded(TransferType transferType, CopyPath path, size_t size, size_t currentThreshold) const;
+    void recordSample(TransferType transferType, CopyPath path, size_t size, uint64_t nanoseconds);
+
+    std::string serialize() const;
+    bool deserialize(const std::string &data);
+    bool loadFromFile(const std::string &fileName);
+    bool saveToFile(const std::string &fileName);
+    bool isDirty() const;
+
+    static uint32_t getSizeBucket(size_t size);
+
+  protected:
+    static constexpr size_t notCalibrated = std::numeric_limits<size_t>::max();
+    using PathStatistics = std::array<BucketStatistics, sizeBucketCount>;
+    using TransferTypeStatistics = std::array<PathStatistics, pathCount>;
+
+    void updateThreshold(uint32_t transferType);
+
+    std::array<TransferTypeStatistics, transferTypeCount> statistics = {};
+    std::array<std::atomic<size_t>, transferTypeCount> thresholds;
+    mutable std::mutex mtx;
+    bool dirty = false;
+};
+
+} // namespace NEO
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy_engine.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/streaming_copy.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace NEO {
+
+namespace {
+uint32_t getDefaultWorkerCount() {
+    if (DebugManager.flags.CpuCopyEngineWorkerCount.get() != -1) {
+        return static_cast<uint32_t>(DebugManager.flags.CpuCopyEngineWorkerCount.get());
+    }
+    auto hwThreads = std::thread::hardware_concurrency();
+    return std::min(CpuCopyEngine::defaultWorkerCount, hwThreads > 1 ? hwThreads - 1 : 0u);
+}
+
+size_t getDefaultSplitThreshold() {
+    if (DebugManager.flags.CpuCopyEngineSplitThreshold.get() != -1) {
+        return static_cast<size_t>(DebugManager.flags.CpuCopyEngineSplitThreshold.get());
+    }
+    return CpuCopyEngine::defaultSplitThreshold;
+}
+} // namespace
+
+CpuCopyEngine::CpuCopyEngine() : CpuCopyEngine(getDefaultWorkerCount(), getDefaultSplitThreshold(), DebugManager.flags.EnableStreamingCpuCopy.get() != 0) {}
+
+CpuCopyEngine::CpuCopyEngine(uint32_t workerCount, size_t splitThreshold, bool streamingEnabled) : workerCount(workerCount),
+                                                                                                   splitThreshold(std::max(splitThreshold, minChunkSize)),
+                                                                                                   streamingEnabled(streamingEnabled) {}
+
+CpuCopyEngine::~CpuCopyEngine() {
+    {
+        std::lock_guard<std::mutex> lock(tasksMutex);
+        keepRunning = false;
+    }
+    tasksCondition.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+    workers.clear();
+}
+
+size_t CpuCopyEngine::getNumStartedWorkers() {
+    std::lock_guard<std::mutex> lock(tasksMutex);
+    return workers.size();
+}
+
+void CpuCopyEngine::copyChunk(void *dst, const void *src, size_t size, bool dstUncached, bool srcUncached) const {
+    if (!streamingEnabled || (!dstUncached && !srcUncached)) {
+        memcpy(dst, src, size);
+    } else if (srcUncached) {
+        // reads from uncached memory are the slowest part, prefer streaming loads when both sides are uncached
+        StreamingCopy::copyFromUncached(dst, src, size);
+    } else {
+        StreamingCopy::copyToUncached(dst, src, size);
+    }
+}
+
+void CpuCopyEngine::copyTask(const CopyTask &task) const {
+    for (size_t slice = 0; slice < task.sliceCount; slice++) {
+        for (size_t row = 0; row < task.rowCount; row++) {
+            copyChunk(ptrOffset(task.dst, slice * task.dstSlicePitch + row * task.dstRowPitch),
+                      ptrOffset(task.src, slice * task.srcSlicePitch + row * task.srcRowPitch),
+                      task.rowSize, task.dstUncached, task.srcUncached);
+        }
+    }
+}
+
+void CpuCopyEngine::copy(void *dst, const void *src, size_t size, bool dstUncached, bool srcUncached) {
+    if (workerCount == 0u || size < splitThreshold) {
+        copyChunk(dst, src, size, dstUncached, srcUncached);
+        return;
+    }
+
+    auto chunkCount = std::min(static_cast<size_t>(workerCount) + 1, size / minChunkSize);
+    auto chunkSize = alignUp(Math::divideAndRoundUp(size, chunkCount), MemoryConstants::pageSize);
+
+    std::vector<CopyTask> chunks;
+    for (size_t offset = 0; offset < size; offset += chunkSize) {
+        chunks.push_back({ptrOffset(dst, offset), ptrOffset(src, offset), std::min(chunkSize, size - offset), 1u, 1u, 0u, 0u, 0u, 0u, dstUncached, srcUncached, nullptr});
+    }
+    runInParallel(chunks);
+}
+
+void CpuCopyEngine::copyRegion(void *dst, size_t dstRowPitch, size_t dstSlicePitch,
+                               const void *src, size_t srcRowPitch, size_t srcSlicePitch,
+                               size_t rowSize, size_t rowCount, size_t sliceCount) {
+    if (rowSize == 0u || rowCount == 0u || sliceCount == 0u) {
+        return;
+    }
+
+    // rows and slices without gaps on both sides are copied as one block
+    if (rowCount == 1u || (rowSize == dstRowPitch && rowSize == srcRowPitch)) {
+        rowSize *= rowCount;
+        rowCount = 1u;
+        if (sliceCount == 1u || (rowSize == dstSlicePitch && rowSize == srcSlicePitch)) {
+            rowSize *= sliceCount;
+            sliceCount = 1u;
+        }
+    }
+
+    // large regions do not fit in cache anyway, so destination is written with non-temporal stores
+    const auto totalSize = rowSize * rowCount * sliceCount;
+    const bool dstStreaming = totalSize >= regionStreamingStoreThreshold;
+
+    if (rowCount == 1u && sliceCount == 1u) {
+        copy(dst, src, rowSize, dstStreaming, false);
+        return;
+    }
+
+    CopyTask region = {dst, src, rowSize, rowCount, sliceCount, dstRowPitch, dstSlicePitch, srcRowPitch, srcSlicePitch, dstStreaming, false, nullptr};
+    if (workerCount == 0u || totalSize < splitThreshold) {
+        copyTask(region);
+        return;
+    }
+
+    // split across slices when there are enough of them, otherwise across rows of the only slice
+    const bool splitSlices = sliceCount > 1u;
+    const auto itemsCount = splitSlices ? sliceCount : rowCount;
+    auto chunkCount = std::min({static_cast<size_t>(workerCount) + 1, itemsCount, std::max(totalSize / minChunkSize, static_cast<size_t>(1u))});
+    auto itemsPerChunk = Math::divideAndRoundUp(itemsCount, chunkCount);
+
+    std::vector<CopyTask> chunks;
+    for (size_t item = 0; item < itemsCount; item += itemsPerChunk) {
+        auto chunk = region;
+        auto chunkItems = std::min(itemsPerChunk, itemsCount - item);
+        if (splitSlices) {
+            chunk.dst = ptrOffset(dst, item * dstSlicePitch);
+            chunk.src = ptrOffset(src, item * srcSlicePitch);
+            chunk.sliceCount = chunkItems;
+        } else {
+            chunk.dst = ptrOffset(dst, item * dstRowPitch);
+            chunk.src = ptrOffset(src, item * srcRowPitch);
+            chunk.rowCount = chunkItems;
+        }
+        chunks.push_back(chunk);
+    }
+    runInParallel(chunks);
+}
+
+void CpuCopyEngine::runInParallel(std::vector<CopyTask> &chunks) {
+    std::atomic<uint32_t> pendingTasks{0u};
+    {
+        std::lock_guard<std::mutex> lock(tasksMutex);
+        while (workers.size() < workerCount) {
+            workers.push_back(Thread::create(processTasks, reinterpret_cast<void *>(this)));
+        }
+        for (size_t i = 1; i < chunks.size(); i++) {
+            chunks[i].pendingTasks = &pendingTasks;
+            tasks.push_back(chunks[i]);
+            pendingTasks++;
+        }
+    }
+    tasksCondition.notify_all();
+
+    copyTask(chunks[0]);
+
+    // help with remaining chunks instead of waiting idle
+    while (pendingTasks.load() > 0u) {
+        if (!runPendingTask()) {
+            CpuIntrinsics::pause();
+        }
+    }
+}
+
+bool CpuCopyEngine::runPendingTask() {
+    CopyTask task;
+    {
+        std::lock_guard<std::mutex> lock(tasksMutex);
+        if (tasks.empty()) {
+            return false;
+        }
+        task = tasks.front();
+        tasks.pop_front();
+    }
+    copyTask(task);
+    task.pendingTasks->fetch_sub(1u);
+    return true;
+}
+
+void *CpuCopyEngine::processTasks(void *self) {
+    auto engine = reinterpret_cast<CpuCopyEngine *>(self);
+    while (true) {
+        CopyTask task;
+        {
+            std::unique_lock<std::mutex> lock(engine->tasksMutex);
+            engine->tasksCondition.wait(lock, [engine] { return !engine->tasks.empty() || !engine->keepRunning; });
+            if (engine->tasks.empty()) {
+                return nullptr;
+            }
+            task = engine->tasks.front();
+            engine->tasks.pop_front();
+        }
+        engine->copyTask(task);
+        task.pendingTasks->fetch_sub(1u);
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Copies between system memory and locked (uncached, write-combined) device memory.
+// Uncached side is accessed with streaming loads/stores, large copies are split
+// across a small pool of worker threads, which is started on first use.
+// Pitched 2D/3D regions (e.g. host pointer images) are copied with contiguous rows
+// coalesced and slices or rows split across the same workers.
+class CpuCopyEngine {
+  public:
+    static constexpr uint32_t defaultWorkerCount = 3u;
+    static constexpr size_t defaultSplitThreshold = 4 * MemoryConstants::megaByte;
+    static constexpr size_t minChunkSize = MemoryConstants::megaByte;
+    static constexpr size_t regionStreamingStoreThreshold = 8 * MemoryConstants::megaByte;
+
+    CpuCopyEngine();
+    CpuCopyEngine(uint32_t workerCount, size_t splitThreshold, bool streamingEnabled);
+    MOCKABLE_VIRTUAL ~CpuCopyEngine();
+
+    CpuCopyEngine(const CpuCopyEngine &) = delete;
+    CpuCopyEngine &operator=(const CpuCopyEngine &) = delete;
+
+    void copy(void *dst, const void *src, size_t size, bool dstUncached, bool srcUncached);
+
+    // dst and src point to the first byte of the region, rows are rowSize bytes long
+    void copyRegion(void *dst, size_t dstRowPitch, size_t dstSlicePitch,
+                    const void *src, size_t srcRowPitch, size_t srcSlicePitch,
+                    size_t rowSize, size_t rowCount, size_t sliceCount);
+
+    uint32_t getWorkerCount() const { return workerCount; }
+    size_t getSplitThreshold() const { return splitThreshold; }
+    size_t getNumStartedWorkers();
+
+  protected:
+    struct CopyTask {
+        void *dst;
+        const void *src;
+        size_t rowSize;
+        size_t rowCount;
+        size_t sliceCount;
+        size_t dstRowPitch;
+        size_t dstSlicePitch;
+        size_t srcRowPitch;
+        size_t srcSlicePitch;
+        bool dstUncached;
+        bool srcUncached;
+        std::atomic<uint32_t> *pendingTasks;
+    };
+
+    void copyChunk(void *dst, const void *src, size_t size, bool dstUncached, bool srcUncached) const;
+    void copyTask(const CopyTask &task) const;
+    void runInParallel(std::vector<CopyTask> &chunks);
+    bool runPendingTask();
+    static void *processTasks(void *self);
+
+    const uint32_t workerCount;
+    const size_t splitThreshold;
+    const bool streamingEnabled;
+
+    std::vector<std::unique_ptr<Thread>> workers;
+    std::deque<CopyTask> tasks;
+    std::mutex tasksMutex;
+    std::condition_variable tasksCondition;
+    bool keepRunning = true;
+};
+
+} // namespace NEO
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/latency_histogram.h"
+
+#include "shared/source/helpers/basic_math.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace NEO {
+
+uint32_t LatencyHistogram::getBucketIndex(uint64_t value) {
+    if (value < subBucketCount) {
+        return static_cast<uint32_t>(value);
+    }
+    auto shift = Math::log2(value) - subBucketBits;
+    auto subBucket = static_cast<uint32_t>(value >> shift) - subBucketCount;
+    return (shift + 1u) * subBucketCount + subBucket;
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound(uint32_t bucketIndex) {
+    if (bucketIndex < subBucketCount) {
+        return bucketIndex;
+    }
+    auto shift = bucketIndex / subBucketCount - 1u;
+    auto subBucket = static_cast<uint64_t>(bucketIndex % subBucketCount);
+    auto lowerBound = (subBucket + subBucketCount) << shift;
+    return lowerBound + ((1ull << shift) - 1u);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other) {
+    for (uint32_t i = 0u; i < bucketCount; i++) {
+        buckets[i] += other.buckets[i];
+    }
+    count += other.count;
+    total += other.total;
+    minValue = std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+}
+
+void LatencyHistogram::reset() {
+    *this = {};
+}
+
+uint64_t LatencyHistogram::getValueAtPercentile(double percentile) const {
+    if (count == 0u) {
+        return 0u;
+    }
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    auto targetCount = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count)));
+    targetCount = std::max(targetCount, static_cast<uint64_t>(1u));
+
+    uint64_t cumulativeCount = 0u;
+    for (uint32_t i = 0u; i < bucketCount; i++) {
+        cumulativeCount += buckets[i];
+        if (cumulativeCount >= targetCount) {
+            return std::min(getBucketUpperBound(i), maxValue);
+        }
+    }
+    return maxValue;
+}
+
+} // namespace NEO
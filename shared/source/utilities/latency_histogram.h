@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace NEO {
+
+// Log-linear (HDR style) histogram of latencies in nanoseconds.
+// Every power of two range is split into subBucketCount linear buckets,
+// which bounds the relative error of reported values to 1/subBucketCount.
+class LatencyHistogram {
+  public:
+    static constexpr uint32_t subBucketBits = 4u;
+    static constexpr uint32_t subBucketCount = 1u << subBucketBits;
+    static constexpr uint32_t bucketCount = (64u - subBucketBits + 1u) * subBucketCount;
+
+    void record(uint64_t value) {
+        buckets[getBucketIndex(value)]++;
+        count++;
+        total += value;
+        if (value < minValue) {
+            minValue = value;
+        }
+        if (value > maxValue) {
+            maxValue = value;
+        }
+    }
+
+    void merge(const LatencyHistogram &other);
+    void reset();
+
+    uint64_t getValueAtPercentile(double percentile) const;
+
+    uint64_t getCount() const { return count; }
+    uint64_t getTotal() const { return total; }
+    uint64_t getMin() const { return count ? minValue : 0u; }
+    uint64_t getMax() const { return maxValue; }
+
+    static uint32_t getBucketIndex(uint64_t value);
+    static uint64_t getBucketUpperBound(uint32_t bucketIndex);
+
+  protected:
+    std::array<uint64_t, bucketCount> buckets = {};
+    uint64_t count = 0u;
+    uint64_t total = 0u;
+    uint64_t minValue = std::numeric_limits<uint64_t>::max();
+    uint64_t maxValue = 0u;
+};
+
+} // namespace NEO
@@ -34,6 +34,11 @@ FileLogger<DebugLevel>::FileLogger(std::string filename, const DebugVariables &f
     logAllocationMemoryPool = flags.LogAllocationMemoryPool.get();
     logAllocationType = flags.LogAllocationType.get();
     logAllocationStdout = flags.LogAllocationStdout.get();
+
+    if (apiLoggingAvailable() && flags.LogApiCallsBinary.get()) {
+        auto binaryLogFileName = logFileName.empty() ? std::string() : logFileName + ".bin";
+        binaryTraceLogger = std::make_unique<BinaryTraceLogger>(binaryLogFileName, true);
+    }
 }
 
 template <DebugFunctionalityLevel DebugLevel>
@@ -72,6 +77,11 @@ void FileLogger<DebugLevel>::dumpKernel(const std::string &name, const std::stri
 
 template <DebugFunctionalityLevel DebugLevel>
 void FileLogger<DebugLevel>::logApiCall(const char *function, bool enter, int32_t errorCode) {
+    if (binaryTraceLogger) {
+        binaryTraceLogger->logApiCall(function, enter, errorCode);
+        return;
+    }
+
     if (false == enabled()) {
         return;
     }
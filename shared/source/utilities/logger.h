@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/utilities/binary_trace_logger.h"
 
 #include <mutex>
 #include <sstream>
@@ -33,6 +34,10 @@ class FileLogger {
         return DebugLevel == DebugFunctionalityLevel::Full;
     }
 
+    static constexpr bool apiLoggingAvailable() {
+        return DebugLevel != DebugFunctionalityLevel::None;
+    }
+
     void dumpKernel(const std::string &name, const std::string &src);
     void logApiCall(const char *function, bool enter, int32_t errorCode);
     void logAllocation(GraphicsAllocation const *graphicsAllocation);
@@ -139,9 +144,12 @@ class FileLogger {
 
     bool peekLogApiCalls() { return logApiCalls; }
 
+    BinaryTraceLogger *getBinaryTraceLogger() { return binaryTraceLogger.get(); }
+
   protected:
     std::mutex mutex;
     std::string logFileName;
+    std::unique_ptr<BinaryTraceLogger> binaryTraceLogger;
     bool dumpKernels = false;
     bool logApiCalls = false;
     bool logAllocationMemoryPool = false;
@@ -7,9 +7,14 @@
 
 #include "shared/source/utilities/perf_profiler.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <algorithm>
 #include <atomic>
+#include <csignal>
+#include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <sstream>
@@ -21,27 +26,88 @@ std::atomic<int> PerfProfiler::counter(0);
 
 thread_local PerfProfiler *gPerfProfiler = nullptr;
 
+std::atomic<int32_t> PerfProfiler::histogramsMode(-1);
+std::atomic<bool> PerfProfiler::histogramsDumpRequested(false);
+
 PerfProfiler *PerfProfiler::objects[PerfProfiler::objectsNumber] = {
     nullptr,
 };
 
+std::mutex PerfProfiler::objectsMutex;
+std::vector<int> PerfProfiler::freeSlots;
+uint32_t PerfProfiler::objectsGeneration = 0u;
+std::atomic<int> PerfProfiler::threadsCounter(0);
+PerfProfiler::ApiHistograms PerfProfiler::retiredApiHistograms;
+PerfProfiler::SystemHistograms PerfProfiler::retiredSystemHistograms;
+
+namespace {
+struct PerfProfilerThreadOwner {
+    ~PerfProfilerThreadOwner() {
+        if (gPerfProfiler != nullptr) {
+            PerfProfiler::releaseThreadProfiler(gPerfProfiler, slot, generation);
+        }
+    }
+    int slot = -1;
+    uint32_t generation = 0u;
+};
+thread_local PerfProfilerThreadOwner perfProfilerThreadOwner;
+} // namespace
+
+int PerfProfiler::acquireSlot() {
+    if (!freeSlots.empty()) {
+        auto slot = freeSlots.back();
+        freeSlots.pop_back();
+        return slot;
+    }
+    if (counter.load() < static_cast<int>(objectsNumber)) {
+        return counter.fetch_add(1);
+    }
+    return -1;
+}
+
 PerfProfiler *PerfProfiler::create(bool dumpToFile) {
     if (gPerfProfiler == nullptr) {
-        int old = counter.fetch_add(1);
-        if (!dumpToFile) {
+        int id = threadsCounter.fetch_add(1);
+        if (areHistogramsEnabled()) {
+            gPerfProfiler = new PerfProfiler(id, true);
+        } else if (!dumpToFile) {
             std::unique_ptr<std::stringstream> logs = std::unique_ptr<std::stringstream>(new std::stringstream());
             std::unique_ptr<std::stringstream> sysLogs = std::unique_ptr<std::stringstream>(new std::stringstream());
-            gPerfProfiler = new PerfProfiler(old, std::move(logs), std::move(sysLogs));
+            gPerfProfiler = new PerfProfiler(id, std::move(logs), std::move(sysLogs));
         } else {
-            gPerfProfiler = new PerfProfiler(old);
+            gPerfProfiler = new PerfProfiler(id);
+        }
+
+        std::lock_guard<std::mutex> lock(objectsMutex);
+        auto slot = acquireSlot();
+        if (slot >= 0) {
+            objects[slot] = gPerfProfiler;
         }
-        objects[old] = gPerfProfiler;
+        perfProfilerThreadOwner.slot = slot;
+        perfProfilerThreadOwner.generation = objectsGeneration;
     }
     return gPerfProfiler;
 }
 
+// Called on exit of the owning thread, profiler is not dereferenced when destroyAll already deleted it
+void PerfProfiler::releaseThreadProfiler(PerfProfiler *profiler, int slot, uint32_t generation) {
+    {
+        std::lock_guard<std::mutex> lock(objectsMutex);
+        if (slot >= 0) {
+            if (generation != objectsGeneration || objects[slot] != profiler) {
+                return;
+            }
+            objects[slot] = nullptr;
+            freeSlots.push_back(slot);
+        }
+        profiler->mergeHistogramsInto(retiredApiHistograms, retiredSystemHistograms);
+    }
+    delete profiler;
+}
+
 void PerfProfiler::destroyAll() {
-    int count = counter;
+    std::lock_guard<std::mutex> lock(objectsMutex);
+    int count = std::min(counter.load(), static_cast<int>(objectsNumber));
     for (int i = 0; i < count; i++) {
         if (objects[i] != nullptr) {
             delete objects[i];
@@ -49,6 +115,11 @@ void PerfProfiler::destroyAll() {
         }
     }
     counter = 0;
+    threadsCounter = 0;
+    freeSlots.clear();
+    objectsGeneration++;
+    retiredApiHistograms.clear();
+    retiredSystemHistograms.clear();
     gPerfProfiler = nullptr;
 }
 
@@ -86,11 +157,19 @@ PerfProfiler::PerfProfiler(int id, std::unique_ptr<std::ostream> &&logOut, std::
     *sysLogFile << "<report>" << std::endl;
 }
 
+PerfProfiler::PerfProfiler(int id, bool histogramsOnly) : histogramsOnly(histogramsOnly) {
+    apiTimer.setFreq();
+}
+
 PerfProfiler::~PerfProfiler() {
-    *logFile << "</report>" << std::endl;
-    logFile->flush();
-    *sysLogFile << "</report>" << std::endl;
-    sysLogFile->flush();
+    if (logFile) {
+        *logFile << "</report>" << std::endl;
+        logFile->flush();
+    }
+    if (sysLogFile) {
+        *sysLogFile << "</report>" << std::endl;
+        sysLogFile->flush();
+    }
     gPerfProfiler = nullptr;
 }
 
@@ -175,4 +254,112 @@ void PerfProfiler::logTimes(long long start, long long end, long long span, unsi
 void PerfProfiler::logSysTimes(long long start, unsigned long long time, unsigned int id) {
     systemLogs.emplace_back(SystemLog{id, start, time});
 }
+
+void PerfProfiler::recordApiLatency(const char *function, long long span) {
+    {
+        std::lock_guard<std::mutex> lock(histogramsMutex);
+        apiHistograms[function].record(static_cast<uint64_t>(std::max(span, 0ll)));
+    }
+    if (histogramsDumpRequested.load(std::memory_order_relaxed) && histogramsDumpRequested.exchange(false)) {
+        dumpHistogramsToFile();
+    }
+}
+
+void PerfProfiler::recordSystemLatency(unsigned int id, long long span) {
+    std::lock_guard<std::mutex> lock(histogramsMutex);
+    systemHistograms[id].record(static_cast<uint64_t>(std::max(span, 0ll)));
+}
+
+void PerfProfiler::mergeHistogramsInto(ApiHistograms &apiHistogramsOut, SystemHistograms &systemHistogramsOut) {
+    std::lock_guard<std::mutex> lock(histogramsMutex);
+    for (auto &apiHistogram : apiHistograms) {
+        apiHistogramsOut[apiHistogram.first].merge(apiHistogram.second);
+    }
+    for (auto &systemHistogram : systemHistograms) {
+        systemHistogramsOut[systemHistogram.first].merge(systemHistogram.second);
+    }
+}
+
+void PerfProfiler::collectHistograms(ApiHistograms &apiHistogramsOut, SystemHistograms &systemHistogramsOut) {
+    std::lock_guard<std::mutex> lock(objectsMutex);
+    int count = std::min(counter.load(), static_cast<int>(objectsNumber));
+    for (int i = 0; i < count; i++) {
+        auto profiler = objects[i];
+        if (profiler == nullptr) {
+            continue;
+        }
+        profiler->mergeHistogramsInto(apiHistogramsOut, systemHistogramsOut);
+    }
+    for (auto &apiHistogram : retiredApiHistograms) {
+        apiHistogramsOut[apiHistogram.first].merge(apiHistogram.second);
+    }
+    for (auto &systemHistogram : retiredSystemHistograms) {
+        systemHistogramsOut[systemHistogram.first].merge(systemHistogram.second);
+    }
+}
+
+void PerfProfiler::dumpHistograms(std::ostream &out) {
+    ApiHistograms apiHistogramsToDump;
+    SystemHistograms systemHistogramsToDump;
+    collectHistograms(apiHistogramsToDump, systemHistogramsToDump);
+
+    auto dumpHistogram = [&out](const LatencyHistogram &histogram) {
+        out << " count=" << histogram.getCount()
+            << " min=" << histogram.getMin()
+            << " p50=" << histogram.getValueAtPercentile(50.0)
+            << " p90=" << histogram.getValueAtPercentile(90.0)
+            << " p99=" << histogram.getValueAtPercentile(99.0)
+            << " p99.9=" << histogram.getValueAtPercentile(99.9)
+            << " max=" << histogram.getMax()
+            << " total=" << histogram.getTotal() << "\n";
+    };
+
+    out << "Latency histograms [ns]\n";
+    for (auto &apiHistogram : apiHistogramsToDump) {
+        out << "api " << apiHistogram.first;
+        dumpHistogram(apiHistogram.second);
+    }
+    for (auto &systemHistogram : systemHistogramsToDump) {
+        out << "sys " << systemHistogram.first;
+        dumpHistogram(systemHistogram.second);
+    }
+    out.flush();
+}
+
+void PerfProfiler::dumpHistogramsToFile() {
+    std::stringstream histograms;
+    dumpHistograms(histograms);
+    auto histogramsString = histograms.str();
+    writeDataToFile(histogramsFileName, histogramsString.c_str(), histogramsString.size());
+}
+
+void PerfProfiler::requestHistogramsDump() {
+    histogramsDumpRequested.store(true);
+}
+
+void PerfProfiler::onHistogramsDumpSignal(int signal) {
+    // only flag the request, dump is done by the next thread leaving an API call
+    requestHistogramsDump();
+}
+
+int32_t PerfProfiler::initializeHistograms() {
+    static std::mutex initializationMutex;
+    std::lock_guard<std::mutex> lock(initializationMutex);
+
+    auto mode = histogramsMode.load();
+    if (mode != -1) {
+        return mode;
+    }
+
+    mode = DebugManager.flags.PerfProfilerHistograms.get() ? 1 : 0;
+    if (mode == 1) {
+        std::atexit(dumpHistogramsToFile);
+        auto dumpSignal = DebugManager.flags.PerfProfilerHistogramsDumpSignal.get();
+        if (dumpSignal > 0) {
+            std::signal(dumpSignal, onHistogramsDumpSignal);
+        }
+    }
+    histogramsMode.store(mode);
+    return mode;
+}
 } // namespace NEO
@@ -6,11 +6,17 @@
  */
 
 #pragma once
+#include "shared/source/utilities/latency_histogram.h"
 #include "shared/source/utilities/timer_util.h"
 
 #include <atomic>
+#include <chrono>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
@@ -35,19 +41,29 @@ class PerfProfiler {
 
     static void readAndVerify(std::istream &stream, const std::string &token);
 
+    using ApiHistograms = std::map<std::string, LatencyHistogram>;
+    using SystemHistograms = std::map<unsigned int, LatencyHistogram>;
+
     PerfProfiler(int id, std::unique_ptr<std::ostream> &&logOut = {nullptr},
                  std::unique_ptr<std::ostream> &&sysLogOut = {nullptr});
+    PerfProfiler(int id, bool histogramsOnly);
     ~PerfProfiler();
 
     void apiEnter() {
         totalSystemTime = 0;
-        systemLogs.clear();
-        systemLogs.reserve(20);
+        if (!histogramsOnly) {
+            systemLogs.clear();
+            systemLogs.reserve(20);
+        }
         apiTimer.start();
     }
 
     void apiLeave(const char *func) {
         apiTimer.end();
+        if (histogramsOnly) {
+            recordApiLatency(func, apiTimer.get());
+            return;
+        }
         logTimes(apiTimer.getStart(), apiTimer.getEnd(), apiTimer.get(), totalSystemTime, func);
     }
 
@@ -60,10 +76,21 @@ class PerfProfiler {
 
     void systemLeave(unsigned int id) {
         systemTimer.end();
-        logSysTimes(systemTimer.getStart(), systemTimer.get(), id);
+        if (histogramsOnly) {
+            recordSystemLatency(id, systemTimer.get());
+        } else {
+            logSysTimes(systemTimer.getStart(), systemTimer.get(), id);
+        }
         totalSystemTime += systemTimer.get();
     }
 
+    void recordApiLatency(const char *function, long long span);
+    void recordSystemLatency(unsigned int id, long long span);
+
+    bool isHistogramsOnly() const {
+        return histogramsOnly;
+    }
+
     std::ostream *getLogStream() {
         return logFile.get();
     }
@@ -74,6 +101,28 @@ class PerfProfiler {
 
     static PerfProfiler *create(bool dumpToFile = true);
     static void destroyAll();
+    static void releaseThreadProfiler(PerfProfiler *profiler, int slot, uint32_t generation);
+
+    // Histogram mode (PerfProfilerHistograms) replaces per call logs with per thread
+    // latency histograms, cheap enough to stay enabled in production runs.
+    static bool areHistogramsEnabled() {
+        auto mode = histogramsMode.load(std::memory_order_relaxed);
+        if (mode == -1) {
+            mode = initializeHistograms();
+        }
+        return mode == 1;
+    }
+
+    static PerfProfiler *getHistogramProfiler() {
+        return areHistogramsEnabled() ? create() : nullptr;
+    }
+
+    static void collectHistograms(ApiHistograms &apiHistograms, SystemHistograms &systemHistograms);
+    static void dumpHistograms(std::ostream &out);
+    static void dumpHistogramsToFile();
+    static void requestHistogramsDump();
+
+    static constexpr const char *histogramsFileName = "PerfHistograms.txt";
 
     static int getCurrentCounter() {
         return counter.load();
@@ -86,16 +135,64 @@ class PerfProfiler {
     static const unsigned int objectsNumber = 4096;
 
   protected:
+    static int32_t initializeHistograms();
+    static void onHistogramsDumpSignal(int signal);
+    static int acquireSlot();
+    void mergeHistogramsInto(ApiHistograms &apiHistogramsOut, SystemHistograms &systemHistogramsOut);
+
+    // Profilers are owned by their threads and released on thread exit: slots of exited threads
+    // are reused and their histograms are kept in retired histograms. Threads which find
+    // all slots taken get a profiler which is not listed in objects.
     static std::atomic<int> counter;
     static PerfProfiler *objects[PerfProfiler::objectsNumber];
+    static std::mutex objectsMutex;
+    static std::vector<int> freeSlots;
+    static uint32_t objectsGeneration;
+    static std::atomic<int> threadsCounter;
+    static ApiHistograms retiredApiHistograms;
+    static SystemHistograms retiredSystemHistograms;
+    static std::atomic<int32_t> histogramsMode;
+    static std::atomic<bool> histogramsDumpRequested;
     Timer apiTimer;
     Timer systemTimer;
     unsigned long long totalSystemTime = 0;
     std::unique_ptr<std::ostream> logFile;
     std::unique_ptr<std::ostream> sysLogFile;
     std::vector<SystemLog> systemLogs;
+
+    const bool histogramsOnly = false;
+    // written by the owning thread, read by whichever thread dumps the histograms
+    std::mutex histogramsMutex;
+    std::unordered_map<const char *, LatencyHistogram> apiHistograms;
+    std::unordered_map<unsigned int, LatencyHistogram> systemHistograms;
 };
 
+// Start time is kept in the wrapper, not in the per thread profiler, so API calls made
+// from within other API calls do not shorten latency of the outer call.
+struct PerfProfilerHistogramWrapper {
+    PerfProfilerHistogramWrapper(const char *funcName)
+        : funcName(funcName) {
+        profiler = PerfProfiler::getHistogramProfiler();
+        if (profiler) {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~PerfProfilerHistogramWrapper() {
+        if (profiler) {
+            auto span = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            profiler->recordApiLatency(funcName, static_cast<long long>(span));
+        }
+    }
+
+    const char *funcName;
+    PerfProfiler *profiler = nullptr;
+    std::chrono::steady_clock::time_point start;
+};
+
+#define PERF_PROFILER_API_HISTOGRAM() \
+    NEO::PerfProfilerHistogramWrapper perfProfilerHistogramWrapperForSingleCall(__FUNCTION__)
+
 #if KMD_PROFILING == 1
 
 extern thread_local PerfProfiler *gPerfProfiler;
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/pool_chunk_allocator.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+PoolChunkAllocator::PoolChunkAllocator(size_t poolSize, size_t chunkAlignment) : poolSize(poolSize), chunkAlignment(chunkAlignment) {
+    chunkAllocator = std::make_unique<HeapAllocator>(startingOffset, poolSize, chunkAlignment);
+}
+
+bool PoolChunkAllocator::allocate(size_t requestedSize, size_t alignment, size_t &offset, size_t &allocatedSize) {
+    if (alignment > maxChunkAlignment) {
+        statistics.failedAllocations++;
+        return false;
+    }
+    if (alignment <= chunkAlignment) {
+        alignment = 0u;
+    }
+    allocatedSize = requestedSize;
+    auto address = chunkAllocator->allocateWithCustomAlignment(allocatedSize, alignment);
+    if (address == 0u) {
+        statistics.failedAllocations++;
+        return false;
+    }
+    offset = static_cast<size_t>(address - startingOffset);
+
+    statistics.allocationsInUse++;
+    statistics.totalAllocations++;
+    statistics.peakUsedSize = std::max(statistics.peakUsedSize, getUsedSize());
+    return true;
+}
+
+void PoolChunkAllocator::free(size_t offset, size_t allocatedSize) {
+    DEBUG_BREAK_IF(statistics.allocationsInUse == 0u);
+    chunkAllocator->free(offset + startingOffset, allocatedSize);
+    statistics.allocationsInUse--;
+}
+
+void PoolChunkAllocator::deferFree(size_t offset, size_t allocatedSize) {
+    chunksToFree.push_back({offset, allocatedSize});
+}
+
+void PoolChunkAllocator::releaseDeferredChunks() {
+    for (auto &chunk : chunksToFree) {
+        free(chunk.first, chunk.second);
+    }
+    chunksToFree.clear();
+}
+
+} // namespace NEO
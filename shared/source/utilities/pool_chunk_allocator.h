@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/heap_allocator.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+
+struct PoolChunkStatistics {
+    uint64_t allocationsInUse = 0u;
+    uint64_t totalAllocations = 0u;
+    uint64_t failedAllocations = 0u;
+    uint64_t peakUsedSize = 0u;
+};
+
+// Carves chunks out of a single backing allocation of poolSize bytes.
+// Chunks are described by their offset in the pool, frees of chunks still
+// used by the GPU can be deferred and released later in one go.
+class PoolChunkAllocator {
+  public:
+    // HeapAllocator never returns address 0, so chunk offsets are biased by
+    // this value, which also bounds the alignment that offsets can honor.
+    static constexpr size_t startingOffset = MemoryConstants::pageSize64k;
+    static constexpr size_t maxChunkAlignment = startingOffset;
+
+    PoolChunkAllocator(size_t poolSize, size_t chunkAlignment);
+
+    bool allocate(size_t requestedSize, size_t alignment, size_t &offset, size_t &allocatedSize);
+    void free(size_t offset, size_t allocatedSize);
+    void deferFree(size_t offset, size_t allocatedSize);
+    void releaseDeferredChunks();
+
+    bool hasDeferredChunks() const { return !chunksToFree.empty(); }
+    uint64_t getUsedSize() const { return chunkAllocator->getUsedSize(); }
+    size_t getPoolSize() const { return poolSize; }
+    const PoolChunkStatistics &getStatistics() const { return statistics; }
+
+  protected:
+    size_t poolSize;
+    size_t chunkAlignment;
+    std::unique_ptr<HeapAllocator> chunkAllocator;
+    std::vector<std::pair<size_t, size_t>> chunksToFree;
+    PoolChunkStatistics statistics;
+};
+
+} // namespace NEO
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/spinlock.h"
+
+#include <array>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace NEO {
+
+// Serves allocations of one class hierarchy from cache line aligned slots carved out of larger slabs.
+// Each size class keeps its own list of slabs, slabs with free slots are kept at the front of the list,
+// so objects of the same type reuse each other's slots. Slabs which get empty are returned to the
+// system, except for up to emptySlabsReserve of them kept to absorb allocation bursts.
+// Objects larger than maxObjectSize fall back to the global operator new.
+// Slab memory comes from malloc, as reserved slabs of process wide allocators outlive single tests.
+template <size_t maxObjectSize>
+class SlabAllocator : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t slotGranularity = MemoryConstants::cacheLineSize;
+    static constexpr size_t sizeClassCount = maxObjectSize / slotGranularity;
+    static constexpr size_t slabSize = 64 * MemoryConstants::kiloByte;
+    static constexpr size_t emptySlabsReserve = 2u;
+    static_assert(maxObjectSize % slotGranularity == 0, "maxObjectSize has to be a multiple of cache line size");
+    static_assert(maxObjectSize <= slabSize, "slab has to fit at least one object");
+
+    SlabAllocator() = default;
+
+    MOCKABLE_VIRTUAL ~SlabAllocator() {
+        for (auto &slab : slabs) {
+            while (slab != nullptr) {
+                auto slabToFree = slab;
+                slab = slab->next;
+                freeSlabMemory(slabToFree);
+            }
+        }
+    }
+
+    static constexpr bool isSlabAllocation(size_t size) {
+        return size > 0u && size <= maxObjectSize;
+    }
+
+    static constexpr size_t getSizeClass(size_t size) {
+        return (size - 1) / slotGranularity;
+    }
+
+    void *allocate(size_t size) {
+        if (!isSlabAllocation(size)) {
+            return ::operator new(size);
+        }
+        auto sizeClass = getSizeClass(size);
+
+        std::lock_guard<SpinLock> lock(mtx);
+        auto slab = slabs[sizeClass];
+        if (slab == nullptr || slab->freeSlots == nullptr) {
+            slab = createSlab(sizeClass);
+            if (slab == nullptr) {
+                throw std::bad_alloc();
+            }
+        }
+        if (slab->usedSlots == 0u) {
+            emptySlabsCount--;
+        }
+        auto slot = slab->freeSlots;
+        slab->freeSlots = slot->next;
+        slab->usedSlots++;
+        usedSlots++;
+        if (slab->freeSlots == nullptr) {
+            moveToBack(slab, sizeClass);
+        }
+        return slot;
+    }
+
+    void deallocate(void *ptr, size_t size) {
+        if (ptr == nullptr) {
+            return;
+        }
+        if (!isSlabAllocation(size)) {
+            ::operator delete(ptr);
+            return;
+        }
+        auto slot = static_cast<FreeSlot *>(ptr);
+        auto sizeClass = getSizeClass(size);
+
+        std::lock_guard<SpinLock> lock(mtx);
+        auto slab = findSlab(slot, sizeClass);
+        UNRECOVERABLE_IF(slab == nullptr);
+
+        auto wasFull = slab->freeSlots == nullptr;
+        slot->next = slab->freeSlots;
+        slab->freeSlots = slot;
+        slab->usedSlots--;
+        usedSlots--;
+
+        if (slab->usedSlots == 0u && emptySlabsCount >= emptySlabsReserve) {
+            unlink(slab, sizeClass);
+            slabsCount--;
+            freeSlabMemory(slab);
+            return;
+        }
+        if (slab->usedSlots == 0u) {
+            emptySlabsCount++;
+        }
+        if (wasFull) {
+            unlink(slab, sizeClass);
+            pushFront(slab, sizeClass);
+        }
+    }
+
+    size_t getUsedSlotsCount() const {
+        return usedSlots;
+    }
+
+    size_t getSlabsCount() const {
+        return slabsCount;
+    }
+
+    size_t getEmptySlabsCount() const {
+        return emptySlabsCount;
+    }
+
+  protected:
+    struct FreeSlot {
+        FreeSlot *next;
+    };
+
+    struct SlabHeader {
+        SlabHeader *prev;
+        SlabHeader *next;
+        FreeSlot *freeSlots;
+        size_t usedSlots;
+        void *slotsBegin;
+        void *slotsEnd;
+    };
+
+    MOCKABLE_VIRTUAL void *allocateSlabMemory(size_t size) {
+        return std::malloc(size);
+    }
+
+    MOCKABLE_VIRTUAL void freeSlabMemory(void *memory) {
+        std::free(memory);
+    }
+
+    SlabHeader *createSlab(size_t sizeClass) {
+        auto slab = static_cast<SlabHeader *>(allocateSlabMemory(slabSize + sizeof(SlabHeader) + slotGranularity));
+        if (slab == nullptr) {
+            return nullptr;
+        }
+
+        const auto slotSize = (sizeClass + 1) * slotGranularity;
+        const auto slotsCount = slabSize / slotSize;
+        auto slotsBegin = alignUp(ptrOffset(static_cast<void *>(slab), sizeof(SlabHeader)), slotGranularity);
+
+        FreeSlot *head = nullptr;
+        for (size_t i = slotsCount; i > 0; i--) {
+            auto slot = static_cast<FreeSlot *>(ptrOffset(slotsBegin, (i - 1) * slotSize));
+            slot->next = head;
+            head = slot;
+        }
+
+        slab->freeSlots = head;
+        slab->usedSlots = 0u;
+        slab->slotsBegin = slotsBegin;
+        slab->slotsEnd = ptrOffset(slotsBegin, slotsCount * slotSize);
+        pushFront(slab, sizeClass);
+        slabsCount++;
+        emptySlabsCount++;
+        return slab;
+    }
+
+    SlabHeader *findSlab(const void *ptr, size_t sizeClass) const {
+        for (auto slab = slabs[sizeClass]; slab != nullptr; slab = slab->next) {
+            if (ptr >= slab->slotsBegin && ptr < slab->slotsEnd) {
+                return slab;
+            }
+        }
+        return nullptr;
+    }
+
+    void pushFront(SlabHeader *slab, size_t sizeClass) {
+        slab->prev = nullptr;
+        slab->next = slabs[sizeClass];
+        if (slab->next != nullptr) {
+            slab->next->prev = slab;
+        } else {
+            lastSlabs[sizeClass] = slab;
+        }
+        slabs[sizeClass] = slab;
+    }
+
+    void unlink(SlabHeader *slab, size_t sizeClass) {
+        if (slab->prev != nullptr) {
+            slab->prev->next = slab->next;
+        } else {
+            slabs[sizeClass] = slab->next;
+        }
+        if (slab->next != nullptr) {
+            slab->next->prev = slab->prev;
+        } else {
+            lastSlabs[sizeClass] = slab->prev;
+        }
+    }
+
+    // full slabs are kept at the back, so the front slab is the one to allocate from
+    void moveToBack(SlabHeader *slab, size_t sizeClass) {
+        if (lastSlabs[sizeClass] == slab) {
+            return;
+        }
+        unlink(slab, sizeClass);
+        slab->next = nullptr;
+        slab->prev = lastSlabs[sizeClass];
+        lastSlabs[sizeClass]->next = slab;
+        lastSlabs[sizeClass] = slab;
+    }
+
+    SpinLock mtx;
+    std::array<SlabHeader *, sizeClassCount> slabs = {};
+    std::array<SlabHeader *, sizeClassCount> lastSlabs = {};
+    size_t usedSlots = 0u;
+    size_t slabsCount = 0u;
+    size_t emptySlabsCount = 0u;
+};
+
+} // namespace NEO
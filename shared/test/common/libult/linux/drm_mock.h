@@ -34,6 +34,7 @@ class DrmMock : public Drm {
     using Drm::fenceVal;
     using Drm::generateElfUUID;
     using Drm::generateUUID;
+    using Drm::getQuerySnapshotKey;
     using Drm::getQueueSliceCount;
     using Drm::ioctlHelper;
     using Drm::memoryInfo;
@@ -42,6 +43,7 @@ class DrmMock : public Drm {
     using Drm::pagingFence;
     using Drm::preemptionSupported;
     using Drm::query;
+    using Drm::querySnapshot;
     using Drm::queryAndSetVmBindPatIndexProgrammingSupport;
     using Drm::queryDeviceIdAndRevision;
     using Drm::requirePerContextVM;
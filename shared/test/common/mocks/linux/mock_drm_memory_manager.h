@@ -68,12 +68,14 @@ class TestedDrmMemoryManager : public MemoryManagerCreate<DrmMemoryManager> {
     using DrmMemoryManager::lockBufferObject;
     using DrmMemoryManager::lockResourceImpl;
     using DrmMemoryManager::mapPhysicalToVirtualMemory;
+    using DrmMemoryManager::maxRecycledBufferObjectsSize;
     using DrmMemoryManager::memoryForPinBBs;
     using DrmMemoryManager::mmapFunction;
     using DrmMemoryManager::munmapFunction;
     using DrmMemoryManager::pinBBs;
     using DrmMemoryManager::pinThreshold;
     using DrmMemoryManager::pushSharedBufferObject;
+    using DrmMemoryManager::recycledBufferObjects;
     using DrmMemoryManager::registerAllocationInOs;
     using DrmMemoryManager::registerSharedBoHandleAllocation;
     using DrmMemoryManager::releaseGpuRange;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,19 +7,29 @@
 
 #include "shared/test/common/mocks/mock_gmm_client_context_base.h"
 
+#include "shared/source/gmm_helper/client_context/gmm_resource_info_cache.h"
+
 #include "gtest/gtest.h"
 
 namespace NEO {
 
+MockGmmClientContextBase::~MockGmmClientContextBase() {
+    // cached prototypes are mock objects, release them while mock destroyResInfoObject is still in place
+    resourceInfoCache.reset();
+}
+
 GMM_RESOURCE_INFO *MockGmmClientContextBase::createResInfoObject(GMM_RESCREATE_PARAMS *pCreateParams) {
+    createResInfoObjectCalled++;
     return reinterpret_cast<GMM_RESOURCE_INFO *>(new char[1]);
 }
 
 GMM_RESOURCE_INFO *MockGmmClientContextBase::copyResInfoObject(GMM_RESOURCE_INFO *pSrcRes) {
+    copyResInfoObjectCalled++;
     return reinterpret_cast<GMM_RESOURCE_INFO *>(new char[1]);
 }
 
 void MockGmmClientContextBase::destroyResInfoObject(GMM_RESOURCE_INFO *pResInfo) {
+    destroyResInfoObjectCalled++;
     delete[] reinterpret_cast<char *>(pResInfo);
 }
 
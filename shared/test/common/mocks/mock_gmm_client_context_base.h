@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,8 @@ class MockGmmClientContextBase : public GmmClientContext {
 
     MEMORY_OBJECT_CONTROL_STATE cachePolicyGetMemoryObject(GMM_RESOURCE_INFO *pResInfo, GMM_RESOURCE_USAGE_TYPE usage) override;
     uint32_t cachePolicyGetPATIndex(GMM_RESOURCE_INFO *gmmResourceInfo, GMM_RESOURCE_USAGE_TYPE usage, bool compressed, bool cachable) override;
+    ~MockGmmClientContextBase() override;
+
     GMM_RESOURCE_INFO *createResInfoObject(GMM_RESCREATE_PARAMS *pCreateParams) override;
     GMM_RESOURCE_INFO *copyResInfoObject(GMM_RESOURCE_INFO *pSrcRes) override;
     void destroyResInfoObject(GMM_RESOURCE_INFO *pResInfo) override;
@@ -30,11 +32,16 @@ class MockGmmClientContextBase : public GmmClientContext {
     uint8_t compressionFormatToReturn = 1;
     uint32_t getSurfaceStateCompressionFormatCalled = 0u;
     uint32_t getMediaSurfaceStateCompressionFormatCalled = 0u;
+    uint32_t createResInfoObjectCalled = 0u;
+    uint32_t copyResInfoObjectCalled = 0u;
+    uint32_t destroyResInfoObjectCalled = 0u;
     bool returnErrorOnPatIndexQuery = false;
 
     bool passedCompressedSettingForGetPatIndexQuery = false;
     bool passedCachableSettingForGetPatIndexQuery = false;
 
+    using GmmClientContext::resourceInfoCache;
+
   protected:
     using GmmClientContext::GmmClientContext;
 };
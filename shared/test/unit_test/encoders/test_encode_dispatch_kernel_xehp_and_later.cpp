@@ -1522,3 +1522,107 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesImplicitScalingSecondaryBufferTe
             givenDispatchImplicitScalingWithBbStartOverControlSectionWhenDispatchingAsSecondaryBufferContainerThenExpectSecondaryBatchBuffer) {
     testBodyFindPrimaryBatchBuffer<FamilyType>();
 }
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenInterfaceDescriptorTemplateWhenDispatchingKernelThenTemplateIsStoredAndReusedBySubsequentDispatch) {
+    using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    InterfaceDescriptorTemplate iddTemplate;
+    dispatchInterface->getInterfaceDescriptorTemplateResult = &iddTemplate;
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+    EXPECT_TRUE(iddTemplate.valid);
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, cmdContainer->getCommandStream()->getCpuBase(), cmdContainer->getCommandStream()->getUsed());
+    auto itor = find<WALKER_TYPE *>(commands.begin(), commands.end());
+    ASSERT_NE(itor, commands.end());
+    auto &firstIdd = genCmdCast<WALKER_TYPE *>(*itor)->getInterfaceDescriptor();
+    EXPECT_EQ(0, memcmp(iddTemplate.data, &firstIdd, sizeof(INTERFACE_DESCRIPTOR_DATA)));
+
+    auto templateIdd = reinterpret_cast<INTERFACE_DESCRIPTOR_DATA *>(iddTemplate.data);
+    templateIdd->setDenormMode(INTERFACE_DESCRIPTOR_DATA::DENORM_MODE_FTZ);
+
+    cmdContainer->reset();
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+
+    commands.clear();
+    CmdParse<FamilyType>::parseCommandBuffer(commands, cmdContainer->getCommandStream()->getCpuBase(), cmdContainer->getCommandStream()->getUsed());
+    itor = find<WALKER_TYPE *>(commands.begin(), commands.end());
+    ASSERT_NE(itor, commands.end());
+    auto &secondIdd = genCmdCast<WALKER_TYPE *>(*itor)->getInterfaceDescriptor();
+    EXPECT_EQ(INTERFACE_DESCRIPTOR_DATA::DENORM_MODE_FTZ, secondIdd.getDenormMode());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenInterfaceDescriptorTemplateWhenSlmSizeChangesThenInterfaceDescriptorIsReprogrammed) {
+    using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    InterfaceDescriptorTemplate iddTemplate;
+    dispatchInterface->getInterfaceDescriptorTemplateResult = &iddTemplate;
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+    EXPECT_EQ(0u, iddTemplate.key.slmTotalSize);
+
+    uint32_t slmTotalSize = 32 * static_cast<uint32_t>(KB);
+    dispatchInterface->getSlmTotalSizeResult = slmTotalSize;
+    cmdContainer->reset();
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+    EXPECT_EQ(slmTotalSize, iddTemplate.key.slmTotalSize);
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, cmdContainer->getCommandStream()->getCpuBase(), cmdContainer->getCommandStream()->getUsed());
+    auto itor = find<WALKER_TYPE *>(commands.begin(), commands.end());
+    ASSERT_NE(itor, commands.end());
+    auto &idd = genCmdCast<WALKER_TYPE *>(*itor)->getInterfaceDescriptor();
+
+    auto &gfxCoreHelper = pDevice->getGfxCoreHelper();
+    uint32_t expectedValue = static_cast<typename INTERFACE_DESCRIPTOR_DATA::SHARED_LOCAL_MEMORY_SIZE>(
+        gfxCoreHelper.computeSlmValues(pDevice->getHardwareInfo(), slmTotalSize));
+    EXPECT_EQ(expectedValue, idd.getSharedLocalMemorySize());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenIsaOffsetInParentAllocationWhenDispatchingKernelThenKernelStartPointerIncludesOffset) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, cmdContainer->getCommandStream()->getCpuBase(), cmdContainer->getCommandStream()->getUsed());
+    auto itor = find<WALKER_TYPE *>(commands.begin(), commands.end());
+    ASSERT_NE(itor, commands.end());
+    auto kernelStartPointer = genCmdCast<WALKER_TYPE *>(*itor)->getInterfaceDescriptor().getKernelStartPointer();
+
+    constexpr uint64_t isaOffset = 4 * MemoryConstants::cacheLineSize;
+    dispatchInterface->getIsaOffsetInParentAllocationResult = isaOffset;
+    cmdContainer->reset();
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+
+    commands.clear();
+    CmdParse<FamilyType>::parseCommandBuffer(commands, cmdContainer->getCommandStream()->getCpuBase(), cmdContainer->getCommandStream()->getUsed());
+    itor = find<WALKER_TYPE *>(commands.begin(), commands.end());
+    ASSERT_NE(itor, commands.end());
+    EXPECT_EQ(kernelStartPointer + isaOffset, genCmdCast<WALKER_TYPE *>(*itor)->getInterfaceDescriptor().getKernelStartPointer());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenInterfaceDescriptorTemplatesDisabledWhenDispatchingKernelThenTemplateIsNotStored) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableInterfaceDescriptorTemplates.set(0);
+
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    InterfaceDescriptorTemplate iddTemplate;
+    dispatchInterface->getInterfaceDescriptorTemplateResult = &iddTemplate;
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+
+    EXPECT_FALSE(iddTemplate.valid);
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/gmm_helper/client_context/gmm_resource_info_cache.h"
+#include "shared/source/helpers/hw_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_gmm_client_context.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+using namespace NEO;
+
+namespace {
+GMM_RESCREATE_PARAMS createBufferParams(uint64_t size) {
+    GMM_RESCREATE_PARAMS createParams;
+    memset(&createParams, 0, sizeof(createParams));
+    createParams.Type = RESOURCE_BUFFER;
+    createParams.Format = GMM_FORMAT_GENERIC_8BIT;
+    createParams.BaseWidth64 = size;
+    createParams.BaseHeight = 1;
+    createParams.Depth = 1;
+    createParams.Flags.Info.Linear = 1;
+    return createParams;
+}
+} // namespace
+
+TEST(GmmResourceInfoCacheTest, givenCacheDebugFlagWhenCreatingClientContextThenCacheIsCreatedWithRequestedCapacity) {
+    DebugManagerStateRestore restorer;
+    auto hwInfo = *defaultHwInfo;
+    MockExecutionEnvironment executionEnvironment{&hwInfo};
+
+    {
+        MockGmmClientContext gmmClientCtx{*executionEnvironment.rootDeviceEnvironments[0]};
+        EXPECT_EQ(nullptr, gmmClientCtx.getResourceInfoCache());
+    }
+
+    DebugManager.flags.EnableGmmResourceInfoCache.set(1);
+    {
+        MockGmmClientContext gmmClientCtx{*executionEnvironment.rootDeviceEnvironments[0]};
+        ASSERT_NE(nullptr, gmmClientCtx.getResourceInfoCache());
+        EXPECT_EQ(GmmResourceInfoCache::defaultCapacity, gmmClientCtx.getResourceInfoCache()->getCapacity());
+    }
+
+    DebugManager.flags.EnableGmmResourceInfoCache.set(16);
+    {
+        MockGmmClientContext gmmClientCtx{*executionEnvironment.rootDeviceEnvironments[0]};
+        ASSERT_NE(nullptr, gmmClientCtx.getResourceInfoCache());
+        EXPECT_EQ(16u, gmmClientCtx.getResourceInfoCache()->getCapacity());
+    }
+}
+
+TEST(GmmResourceInfoCacheTest, givenIdenticalCreateParamsWhenCreatingResourceInfoThenGmmComputesDescriptionOnceAndCopiesItLater) {
+    auto hwInfo = *defaultHwInfo;
+    MockExecutionEnvironment executionEnvironment{&hwInfo};
+    MockGmmClientContext gmmClientCtx{*executionEnvironment.rootDeviceEnvironments[0]};
+    GmmResourceInfoCache cache(gmmClientCtx, 4u);
+
+    auto createParams = createBufferParams(MemoryConstants::pageSize);
+    auto resourceInfo0 = cache.createResInfoObject(&createParams);
+    auto resourceInfo1 = cache.createResInfoObject(&createParams);
+    ASSERT_NE(nullptr, resourceInfo0);
+    ASSERT_NE(nullptr, resourceInfo1);
+    EXPECT_NE(resourceInfo0, resourceInfo1);
+
+    EXPECT_EQ(1u, gmmClientCtx.createResInfoObjectCalled);
+    EXPECT_EQ(2u, gmmClientCtx.copyResInfoObjectCalled);
+    EXPECT_EQ(1u, cache.getEntriesCount());
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+
+    auto otherParams = createBufferParams(2 * MemoryConstants::pageSize);
+    auto resourceInfo2 = cache.createResInfoObject(&otherParams);
+    EXPECT_EQ(2u, gmmClientCtx.createResInfoObjectCalled);
+    EXPECT_EQ(2u, cache.getEntriesCount());
+    EXPECT_EQ(2u, cache.getStatistics().misses);
+
+    for (auto resourceInfo : {resourceInfo0, resourceInfo1, resourceInfo2}) {
+        gmmClientCtx.destroyResInfoObject(resourceInfo);
+    }
+    cache.clear();
+    EXPECT_EQ(0u, cache.getEntriesCount());
+    EXPECT_EQ(gmmClientCtx.createResInfoObjectCalled + gmmClientCtx.copyResInfoObjectCalled, gmmClientCtx.destroyResInfoObjectCalled);
+}
+
+TEST(GmmResourceInfoCacheTest, givenFullCacheWhenCreatingResourceInfoForNewParamsThenLeastRecentlyUsedEntryIsEvicted) {
+    auto hwInfo = *defaultHwInfo;
+    MockExecutionEnvironment executionEnvironment{&hwInfo};
+    MockGmmClientContext gmmClientCtx{*executionEnvironment.rootDeviceEnvironments[0]};
+    GmmResourceInfoCache cache(gmmClientCtx, 2u);
+
+    auto params0 = createBufferParams(MemoryConstants::pageSize);
+    auto params1 = createBufferParams(2 * MemoryConstants::pageSize);
+    auto params2 = createBufferParams(3 * MemoryConstants::pageSize);
+
+    for (auto params : {&params0, &params1, &params0, &params2, &params0, &params1}) {
+        gmmClientCtx.destroyResInfoObject(cache.createResInfoObject(params));
+    }
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(2u, statistics.hits);
+    EXPECT_EQ(4u, statistics.misses);
+    EXPECT_EQ(2u, statistics.evictions);
+    EXPECT_EQ(2u, cache.getEntriesCount());
+    EXPECT_EQ(4u, gmmClientCtx.createResInfoObjectCalled);
+}
+
+TEST(GmmResourceInfoCacheTest, givenParamsWithExistingSystemMemoryWhenCreatingResourceInfoThenResultIsNotCached) {
+    auto hwInfo = *defaultHwInfo;
+    MockExecutionEnvironment executionEnvironment{&hwInfo};
+    MockGmmClientContext gmmClientCtx{*executionEnvironment.rootDeviceEnvironments[0]};
+    GmmResourceInfoCache cache(gmmClientCtx, 4u);
+
+    auto createParams = createBufferParams(MemoryConstants::pageSize);
+    createParams.Flags.Info.ExistingSysMem = 1;
+    createParams.pExistingSysMem = 0x1000;
+    createParams.ExistingSysMemSize = MemoryConstants::pageSize;
+    EXPECT_FALSE(GmmResourceInfoCache::isCacheable(createParams));
+
+    gmmClientCtx.destroyResInfoObject(cache.createResInfoObject(&createParams));
+    gmmClientCtx.destroyResInfoObject(cache.createResInfoObject(&createParams));
+
+    EXPECT_EQ(2u, gmmClientCtx.createResInfoObjectCalled);
+    EXPECT_EQ(0u, gmmClientCtx.copyResInfoObjectCalled);
+    EXPECT_EQ(0u, cache.getEntriesCount());
+    EXPECT_EQ(2u, cache.getStatistics().notCacheable);
+}
+
+TEST(GmmResourceInfoCacheTest, givenClientContextWithCacheWhenDestroyedThenCachedPrototypesAreReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableGmmResourceInfoCache.set(1);
+    auto hwInfo = *defaultHwInfo;
+    MockExecutionEnvironment executionEnvironment{&hwInfo};
+    auto gmmClientCtx = std::make_unique<MockGmmClientContext>(*executionEnvironment.rootDeviceEnvironments[0]);
+
+    auto createParams = createBufferParams(MemoryConstants::pageSize);
+    gmmClientCtx->destroyResInfoObject(gmmClientCtx->getResourceInfoCache()->createResInfoObject(&createParams));
+    EXPECT_EQ(1u, gmmClientCtx->getResourceInfoCache()->getEntriesCount());
+    EXPECT_EQ(1u, gmmClientCtx->destroyResInfoObjectCalled);
+
+    gmmClientCtx->resourceInfoCache.reset();
+    EXPECT_EQ(2u, gmmClientCtx->destroyResInfoObjectCalled);
+}
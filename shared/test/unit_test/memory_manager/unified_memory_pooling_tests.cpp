@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/unified_memory_pooling.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/mocks/mock_svm_manager.h"
+#include "shared/test/common/mocks/ult_device_factory.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+struct UsmMemAllocPoolTest : public ::testing::Test {
+    void SetUp() override {
+        deviceFactory = std::make_unique<UltDeviceFactory>(1, 1);
+        device = deviceFactory->rootDevices[0];
+        svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    }
+
+    SVMAllocsManager::UnifiedMemoryProperties getHostProperties() {
+        return SVMAllocsManager::UnifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, 1u, rootDeviceIndices, deviceBitfields);
+    }
+
+    static constexpr size_t poolSize = 2 * MemoryConstants::megaByte;
+    std::unique_ptr<UltDeviceFactory> deviceFactory;
+    MockDevice *device = nullptr;
+    std::unique_ptr<MockSVMAllocsManager> svmManager;
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+};
+
+TEST_F(UsmMemAllocPoolTest, givenPoolSizeFlagWhenGettingPoolSizeThenSizeInMegabytesIsReturnedOrZeroWhenDisabled) {
+    EXPECT_EQ(0u, UsmMemAllocPool::getPoolSize(-1));
+    EXPECT_EQ(0u, UsmMemAllocPool::getPoolSize(0));
+    EXPECT_EQ(2 * MemoryConstants::megaByte, UsmMemAllocPool::getPoolSize(2));
+}
+
+TEST_F(UsmMemAllocPoolTest, givenMaxServicedSizeFlagWhenGettingMaxServicedSizeThenFlagValueIsReturned) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(UsmMemAllocPool::defaultMaxServicedSize, UsmMemAllocPool::getMaxServicedSize());
+    DebugManager.flags.UsmAllocationPoolMaxServicedSize.set(256);
+    EXPECT_EQ(256u, UsmMemAllocPool::getMaxServicedSize());
+}
+
+TEST_F(UsmMemAllocPoolTest, givenInitializedPoolWhenAllocatingSmallAllocationsThenTheyShareOneSvmAllocation) {
+    UsmMemAllocPool pool;
+    auto properties = getHostProperties();
+    ASSERT_TRUE(pool.initialize(svmManager.get(), properties, poolSize, UsmMemAllocPool::defaultMaxServicedSize));
+    EXPECT_EQ(1u, svmManager->getNumAllocs());
+
+    auto ptr0 = pool.createUnifiedMemoryAllocation(100u, properties);
+    auto ptr1 = pool.createUnifiedMemoryAllocation(UsmMemAllocPool::defaultMaxServicedSize, properties);
+    ASSERT_NE(nullptr, ptr0);
+    ASSERT_NE(nullptr, ptr1);
+    EXPECT_NE(ptr0, ptr1);
+    EXPECT_EQ(1u, svmManager->getNumAllocs());
+
+    EXPECT_TRUE(pool.isInPool(ptr0));
+    EXPECT_TRUE(pool.isPooledAllocation(ptrOffset(ptr0, 99u)));
+    EXPECT_EQ(ptr0, pool.getPooledAllocationBasePtr(ptrOffset(ptr0, 99u)));
+    EXPECT_EQ(100u, pool.getPooledAllocationSize(ptr0));
+    EXPECT_EQ(ptrDiff(ptr0, pool.getPoolAddress()), pool.getOffsetInPool(ptr0));
+    EXPECT_EQ(pool.getPoolAddress(), svmManager->getSVMAlloc(ptr0)->gpuAllocations.getDefaultGraphicsAllocation()->getUnderlyingBuffer());
+
+    EXPECT_TRUE(pool.freeSVMAlloc(ptr0, false));
+    EXPECT_FALSE(pool.isPooledAllocation(ptr0));
+    EXPECT_EQ(nullptr, pool.getPooledAllocationBasePtr(ptr0));
+    EXPECT_EQ(0u, pool.getPooledAllocationSize(ptr0));
+    EXPECT_FALSE(pool.freeSVMAlloc(ptr0, false));
+
+    EXPECT_TRUE(pool.freeSVMAlloc(ptr1, true));
+    pool.cleanup();
+    EXPECT_FALSE(pool.isInitialized());
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+}
+
+TEST_F(UsmMemAllocPoolTest, givenRequestNotMatchingPoolWhenAllocatingThenNullptrIsReturned) {
+    UsmMemAllocPool pool;
+    auto properties = getHostProperties();
+    EXPECT_EQ(nullptr, pool.createUnifiedMemoryAllocation(100u, properties));
+    ASSERT_TRUE(pool.initialize(svmManager.get(), properties, poolSize, UsmMemAllocPool::defaultMaxServicedSize));
+
+    EXPECT_EQ(nullptr, pool.createUnifiedMemoryAllocation(0u, properties));
+    EXPECT_EQ(nullptr, pool.createUnifiedMemoryAllocation(UsmMemAllocPool::defaultMaxServicedSize + 1, properties));
+
+    auto uncachedProperties = getHostProperties();
+    uncachedProperties.allocationFlags.flags.locallyUncachedResource = 1;
+    EXPECT_EQ(nullptr, pool.createUnifiedMemoryAllocation(100u, uncachedProperties));
+
+    auto deviceProperties = getHostProperties();
+    deviceProperties.memoryType = InternalMemoryType::DEVICE_UNIFIED_MEMORY;
+    deviceProperties.device = device;
+    EXPECT_EQ(nullptr, pool.createUnifiedMemoryAllocation(100u, deviceProperties));
+
+    auto overAlignedProperties = getHostProperties();
+    overAlignedProperties.alignment = 2 * PoolChunkAllocator::maxChunkAlignment;
+    EXPECT_EQ(nullptr, pool.createUnifiedMemoryAllocation(100u, overAlignedProperties));
+
+    int hostPtr = 0;
+    auto hostPtrProperties = getHostProperties();
+    hostPtrProperties.allocationFlags.hostptr = reinterpret_cast<uintptr_t>(&hostPtr);
+    EXPECT_EQ(nullptr, pool.createUnifiedMemoryAllocation(100u, hostPtrProperties));
+}
+
+TEST_F(UsmMemAllocPoolTest, givenAlignmentWhenAllocatingFromPoolThenReturnedPointerIsAligned) {
+    UsmMemAllocPool pool;
+    auto properties = getHostProperties();
+    ASSERT_TRUE(pool.initialize(svmManager.get(), properties, poolSize, UsmMemAllocPool::defaultMaxServicedSize));
+
+    pool.createUnifiedMemoryAllocation(100u, properties);
+    properties.alignment = MemoryConstants::pageSize;
+    auto ptr = pool.createUnifiedMemoryAllocation(100u, properties);
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_TRUE(isAligned<MemoryConstants::pageSize>(ptr));
+}
+
+TEST_F(UsmMemAllocPoolTest, givenInvalidPoolParametersWhenInitializingThenPoolIsNotInitialized) {
+    UsmMemAllocPool pool;
+    auto properties = getHostProperties();
+    EXPECT_FALSE(pool.initialize(svmManager.get(), properties, 0u, UsmMemAllocPool::defaultMaxServicedSize));
+    EXPECT_FALSE(pool.initialize(svmManager.get(), properties, poolSize, 0u));
+    EXPECT_FALSE(pool.initialize(svmManager.get(), properties, poolSize, poolSize + 1));
+    EXPECT_FALSE(pool.isInitialized());
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+}
+
+TEST_F(UsmMemAllocPoolTest, whenAllocatingFromPoolThenStatisticsAreReported) {
+    UsmMemAllocPool pool;
+    auto properties = getHostProperties();
+    EXPECT_EQ(0u, pool.getStatistics().poolSize);
+    ASSERT_TRUE(pool.initialize(svmManager.get(), properties, poolSize, UsmMemAllocPool::defaultMaxServicedSize));
+
+    auto ptr0 = pool.createUnifiedMemoryAllocation(100u, properties);
+    auto ptr1 = pool.createUnifiedMemoryAllocation(200u, properties);
+    pool.freeSVMAlloc(ptr0, false);
+
+    auto statistics = pool.getStatistics();
+    EXPECT_EQ(1u, statistics.allocationsInUse);
+    EXPECT_EQ(2u, statistics.totalAllocations);
+    EXPECT_EQ(200u, statistics.requestedBytesInUse);
+    EXPECT_EQ(UsmMemAllocPool::chunkAlignment * 4, statistics.usedPoolSize);
+    EXPECT_EQ(UsmMemAllocPool::chunkAlignment * 6, statistics.peakUsedPoolSize);
+    EXPECT_EQ(poolSize, statistics.poolSize);
+
+    pool.freeSVMAlloc(ptr1, false);
+}
+
+TEST_F(UsmMemAllocPoolTest, givenPoolInUseWhenFreeingNonBlockingThenChunkIsNotReusedUntilPoolIsIdle) {
+    UsmMemAllocPool pool;
+    auto properties = getHostProperties();
+    constexpr size_t chunkSize = UsmMemAllocPool::defaultMaxServicedSize;
+    ASSERT_TRUE(pool.initialize(svmManager.get(), properties, 2 * chunkSize, chunkSize));
+
+    auto mockMemoryManager = static_cast<MockMemoryManager *>(device->getMemoryManager());
+    auto ptr0 = pool.createUnifiedMemoryAllocation(chunkSize, properties);
+    auto ptr1 = pool.createUnifiedMemoryAllocation(chunkSize, properties);
+    ASSERT_NE(nullptr, ptr0);
+    ASSERT_NE(nullptr, ptr1);
+
+    mockMemoryManager->deferAllocInUse = true;
+    EXPECT_TRUE(pool.freeSVMAlloc(ptr0, false));
+    EXPECT_FALSE(pool.isPooledAllocation(ptr0));
+    EXPECT_EQ(nullptr, pool.createUnifiedMemoryAllocation(chunkSize, properties));
+
+    mockMemoryManager->deferAllocInUse = false;
+    EXPECT_EQ(ptr0, pool.createUnifiedMemoryAllocation(chunkSize, properties));
+
+    pool.freeSVMAlloc(ptr0, false);
+    pool.freeSVMAlloc(ptr1, false);
+}
+
+TEST_F(UsmMemAllocPoolTest, whenAllocatingFromPoolThenEachAllocationGetsItsOwnId) {
+    UsmMemAllocPool pool;
+    auto properties = getHostProperties();
+    ASSERT_TRUE(pool.initialize(svmManager.get(), properties, poolSize, UsmMemAllocPool::defaultMaxServicedSize));
+
+    auto ptr0 = pool.createUnifiedMemoryAllocation(100u, properties);
+    auto ptr1 = pool.createUnifiedMemoryAllocation(100u, properties);
+    auto poolId = svmManager->getSVMAlloc(pool.getPoolAddress())->getAllocId();
+    auto id0 = pool.getPooledAllocationId(ptr0);
+    auto id1 = pool.getPooledAllocationId(ptrOffset(ptr1, 10u));
+    EXPECT_NE(SvmAllocationData::uninitializedAllocId, id0);
+    EXPECT_NE(SvmAllocationData::uninitializedAllocId, id1);
+    EXPECT_NE(id0, id1);
+    EXPECT_NE(poolId, id0);
+    EXPECT_NE(poolId, id1);
+
+    pool.freeSVMAlloc(ptr0, false);
+    EXPECT_EQ(SvmAllocationData::uninitializedAllocId, pool.getPooledAllocationId(ptr0));
+    pool.freeSVMAlloc(ptr1, false);
+}
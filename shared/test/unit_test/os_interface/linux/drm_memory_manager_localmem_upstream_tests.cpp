@@ -432,6 +432,187 @@ TEST_F(DrmMemoryManagerLocalMemoryTest, givenMemoryInfoAndFailedGemCreateExtWhen
     mock->gemCreateExtRetVal = 0;
 }
 
+TEST(DrmMemoryManagerBufferObjectRecyclingTest, whenGettingRecyclingSizeClassThenSizeIsRoundedUpToQuarterOfPowerOfTwo) {
+    EXPECT_EQ(MemoryConstants::pageSize, DrmMemoryManager::getRecyclingSizeClass(1u));
+    EXPECT_EQ(3 * MemoryConstants::pageSize, DrmMemoryManager::getRecyclingSizeClass(3 * MemoryConstants::pageSize));
+    EXPECT_EQ(MemoryConstants::pageSize64k, DrmMemoryManager::getRecyclingSizeClass(MemoryConstants::pageSize64k - MemoryConstants::pageSize));
+    EXPECT_EQ(80 * MemoryConstants::kiloByte, DrmMemoryManager::getRecyclingSizeClass(MemoryConstants::pageSize64k + 1));
+    EXPECT_EQ(5 * MemoryConstants::megaByte, DrmMemoryManager::getRecyclingSizeClass(5 * MemoryConstants::megaByte - MemoryConstants::pageSize));
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenBufferObjectRecyclingDisabledByDefaultWhenMmapAllocationIsFreedThenBufferObjectIsNotRecycled) {
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+    mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+
+    EXPECT_FALSE(memoryManager->isBufferObjectRecyclingEnabled());
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize64k;
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_FALSE(allocation->isBufferObjectRecyclable());
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(0u, memoryManager->getRecycledBufferObjectsSize());
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenBufferObjectRecyclingEnabledWhenAllocationOfSameSizeClassFollowsFreeThenBufferObjectAndMappingAreReusedWithoutIoctls) {
+    DebugManager.flags.EnableBufferObjectRecycling.set(1);
+    memoryManager = std::make_unique<TestedDrmMemoryManager>(true, false, false, *executionEnvironment);
+    EXPECT_EQ(DrmMemoryManager::defaultMaxRecycledBufferObjectsSize, memoryManager->maxRecycledBufferObjectsSize);
+
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+    mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize64k;
+    allocationData.type = AllocationType::BUFFER_HOST_MEMORY;
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_TRUE(allocation->isBufferObjectRecyclable());
+    auto bo = allocation->getBO();
+    auto cpuPtr = allocation->getUnderlyingBuffer();
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(MemoryConstants::pageSize64k, memoryManager->getRecycledBufferObjectsSize());
+
+    mock->ioctlCallsCount = 0;
+    allocationData.size = MemoryConstants::pageSize64k - MemoryConstants::pageSize;
+    allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(0u, mock->ioctlCallsCount);
+    EXPECT_EQ(bo, allocation->getBO());
+    EXPECT_EQ(cpuPtr, allocation->getUnderlyingBuffer());
+    EXPECT_EQ(cpuPtr, allocation->getMmapPtr());
+    EXPECT_EQ(MemoryConstants::pageSize64k, allocation->getUnderlyingBufferSize());
+    EXPECT_EQ(0u, memoryManager->getRecycledBufferObjectsSize());
+
+    auto statistics = memoryManager->getBufferObjectRecyclingStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(DrmMemoryManager::ioctlsAvoidedPerRecycledBufferObject, statistics.ioctlsAvoided);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_TRUE(memoryManager->trimRecycledBufferObjects(0u));
+    EXPECT_EQ(0u, memoryManager->getRecycledBufferObjectsSize());
+    EXPECT_EQ(1u, memoryManager->getBufferObjectRecyclingStatistics().releasedBufferObjects);
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenRecycledBufferObjectWhenAllocatingDifferentTypeOrSizeClassThenNewBufferObjectIsCreated) {
+    memoryManager->maxRecycledBufferObjectsSize = DrmMemoryManager::defaultMaxRecycledBufferObjectsSize;
+
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+    mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize64k;
+    allocationData.type = AllocationType::BUFFER_HOST_MEMORY;
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, allocation);
+    auto bo = allocation->getBO();
+    memoryManager->freeGraphicsMemory(allocation);
+
+    allocationData.type = AllocationType::INTERNAL_HOST_MEMORY;
+    allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_NE(bo, allocation->getBO());
+    memoryManager->freeGraphicsMemory(allocation);
+
+    allocationData.type = AllocationType::BUFFER_HOST_MEMORY;
+    allocationData.size = 2 * MemoryConstants::pageSize64k;
+    allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_NE(bo, allocation->getBO());
+    memoryManager->freeGraphicsMemory(allocation);
+
+    EXPECT_EQ(3u, memoryManager->getBufferObjectRecyclingStatistics().misses);
+    EXPECT_EQ(0u, memoryManager->getBufferObjectRecyclingStatistics().hits);
+    EXPECT_EQ(3u, memoryManager->recycledBufferObjects.size());
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenBufferObjectRecyclingMaxSizeWhenFreedBufferObjectsExceedItThenLeastRecentlyFreedAreReleased) {
+    DebugManager.flags.EnableBufferObjectRecycling.set(1);
+    DebugManager.flags.BufferObjectRecyclingMaxSize.set(static_cast<int64_t>(MemoryConstants::pageSize64k));
+    memoryManager = std::make_unique<TestedDrmMemoryManager>(true, false, false, *executionEnvironment);
+
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+    mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize64k;
+    auto allocation0 = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    auto allocation1 = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    auto allocation2 = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    allocationData.size = 2 * MemoryConstants::pageSize64k;
+    auto largeAllocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, allocation0);
+    ASSERT_NE(nullptr, allocation1);
+    ASSERT_NE(nullptr, allocation2);
+    ASSERT_NE(nullptr, largeAllocation);
+    auto bo2 = allocation2->getBO();
+
+    memoryManager->freeGraphicsMemory(largeAllocation);
+    EXPECT_EQ(0u, memoryManager->getRecycledBufferObjectsSize());
+
+    memoryManager->freeGraphicsMemory(allocation0);
+    memoryManager->freeGraphicsMemory(allocation1);
+    memoryManager->freeGraphicsMemory(allocation2);
+    ASSERT_EQ(1u, memoryManager->recycledBufferObjects.size());
+    EXPECT_EQ(bo2, memoryManager->recycledBufferObjects[0].bo);
+    EXPECT_EQ(MemoryConstants::pageSize64k, memoryManager->getRecycledBufferObjectsSize());
+    EXPECT_EQ(2u, memoryManager->getBufferObjectRecyclingStatistics().releasedBufferObjects);
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenRecycledBufferObjectsWhenGemCreateExtFailsThenRecycledBufferObjectsAreReleasedAndCreationIsRetried) {
+    memoryManager->maxRecycledBufferObjectsSize = DrmMemoryManager::defaultMaxRecycledBufferObjectsSize;
+
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+    mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize64k;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, allocation);
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(MemoryConstants::pageSize64k, memoryManager->getRecycledBufferObjectsSize());
+
+    mock->gemCreateExtRetVal = -1;
+    allocationData.size = 4 * MemoryConstants::pageSize64k;
+    allocation = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    EXPECT_EQ(nullptr, allocation);
+    EXPECT_EQ(0u, memoryManager->getRecycledBufferObjectsSize());
+    EXPECT_EQ(1u, memoryManager->getBufferObjectRecyclingStatistics().releasedBufferObjects);
+    mock->gemCreateExtRetVal = 0;
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenBufferObjectRecyclingEnabledWhenAllocationSharedHandleWasExportedThenBufferObjectIsNotRecycled) {
+    memoryManager->maxRecycledBufferObjectsSize = DrmMemoryManager::defaultMaxRecycledBufferObjectsSize;
+
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+    mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize64k;
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, allocation);
+    memoryManager->registerIpcExportedAllocation(allocation);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(0u, memoryManager->getRecycledBufferObjectsSize());
+}
+
 class DrmMemoryManagerLocalMemoryMemoryBankMock : public TestedDrmMemoryManager {
   public:
     DrmMemoryManagerLocalMemoryMemoryBankMock(bool enableLocalMemory,
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/linux/drm_query_snapshot.h"
+#include "shared/source/os_interface/linux/drm_wrappers.h"
+#include "shared/source/os_interface/linux/ioctl_helper.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/libult/linux/drm_mock.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+namespace {
+class MockDrmQuerySnapshot : public DrmQuerySnapshot {
+  public:
+    using DrmQuerySnapshot::DrmQuerySnapshot;
+
+    ~MockDrmQuerySnapshot() override {
+        waitForVerification();
+    }
+
+    std::vector<uint8_t> loadFromFile() override {
+        loadFromFileCalled++;
+        return fileContent;
+    }
+
+    bool saveToFile(const std::vector<uint8_t> &data) override {
+        saveToFileCalled++;
+        fileContent = data;
+        return true;
+    }
+
+    std::vector<uint8_t> fileContent;
+    uint32_t loadFromFileCalled = 0u;
+    uint32_t saveToFileCalled = 0u;
+};
+
+int mockKmdVersionMinor = 0;
+const char *mockKmdVersionDate = "20230101";
+int mockVersionIoctl(int fileDescriptor, unsigned long int request, void *arg) {
+    if (request == getIoctlRequestValue(DrmIoctl::Version, nullptr)) {
+        auto version = static_cast<DrmVersion *>(arg);
+        version->versionMajor = 1;
+        version->versionMinor = mockKmdVersionMinor;
+        version->versionPatch = 0;
+        memcpy_s(version->name, version->nameLen, "i915", 4);
+        memcpy_s(version->date, version->dateLen, mockKmdVersionDate, strlen(mockKmdVersionDate));
+    }
+    return 0;
+}
+} // namespace
+
+TEST(DrmQuerySnapshotTest, givenSerializedSnapshotWhenDeserializingWithSameKeyThenEntriesAreRestored) {
+    DrmQuerySnapshot snapshot("snapshot.bin", "key");
+    snapshot.addCacheableQuery(1u);
+    snapshot.store(1u, 0u, {1, 2, 3});
+    snapshot.store(1u, 5u, {4});
+    auto data = snapshot.serialize();
+
+    DrmQuerySnapshot restoredSnapshot("snapshot.bin", "key");
+    EXPECT_TRUE(restoredSnapshot.deserialize(data.data(), data.size()));
+
+    std::vector<uint8_t> entry;
+    EXPECT_TRUE(restoredSnapshot.find(1u, 0u, entry));
+    EXPECT_EQ((std::vector<uint8_t>{1, 2, 3}), entry);
+    EXPECT_TRUE(restoredSnapshot.find(1u, 5u, entry));
+    EXPECT_EQ((std::vector<uint8_t>{4}), entry);
+    EXPECT_FALSE(restoredSnapshot.find(2u, 0u, entry));
+
+    auto statistics = restoredSnapshot.getStatistics();
+    EXPECT_EQ(2u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+}
+
+TEST(DrmQuerySnapshotTest, givenSnapshotCreatedForDifferentKeyOrCorruptedWhenDeserializingThenItIsRejected) {
+    DrmQuerySnapshot snapshot("snapshot.bin", "key");
+    snapshot.store(1u, 0u, {1, 2, 3});
+    auto data = snapshot.serialize();
+
+    DrmQuerySnapshot otherKeySnapshot("snapshot.bin", "other key");
+    EXPECT_FALSE(otherKeySnapshot.deserialize(data.data(), data.size()));
+
+    DrmQuerySnapshot truncatedSnapshot("snapshot.bin", "key");
+    EXPECT_FALSE(truncatedSnapshot.deserialize(data.data(), data.size() - 1));
+
+    std::vector<uint8_t> entry;
+    EXPECT_FALSE(truncatedSnapshot.find(1u, 0u, entry));
+}
+
+TEST(DrmQuerySnapshotTest, givenSnapshotFileWhenLoadingThenOnlyMatchingContentIsUsed) {
+    MockDrmQuerySnapshot snapshot("snapshot.bin", "key");
+    EXPECT_FALSE(snapshot.load());
+    EXPECT_EQ(1u, snapshot.loadFromFileCalled);
+
+    DrmQuerySnapshot sourceSnapshot("snapshot.bin", "key");
+    sourceSnapshot.store(1u, 0u, {7});
+    snapshot.fileContent = sourceSnapshot.serialize();
+    EXPECT_TRUE(snapshot.load());
+
+    snapshot.fileContent[0]++;
+    EXPECT_FALSE(snapshot.load());
+}
+
+TEST(DrmQuerySnapshotTest, givenCompletedStartupWhenCheckingQueryThenItIsNotCacheable) {
+    MockDrmQuerySnapshot snapshot("snapshot.bin", "key");
+    snapshot.addCacheableQuery(1u);
+    EXPECT_TRUE(snapshot.isCacheable(1u));
+    EXPECT_FALSE(snapshot.isCacheable(2u));
+
+    uint32_t queriesCalled = 0u;
+    snapshot.completeStartup([&](uint32_t queryId, uint32_t queryItemFlags) {
+        queriesCalled++;
+        return std::vector<uint8_t>{};
+    });
+    snapshot.waitForVerification();
+
+    EXPECT_FALSE(snapshot.isCacheable(1u));
+    EXPECT_EQ(0u, queriesCalled);
+    EXPECT_EQ(0u, snapshot.saveToFileCalled);
+}
+
+TEST(DrmQuerySnapshotTest, givenServedEntriesWhenStartupCompletesThenEntriesAreVerifiedAndMismatchesAreSaved) {
+    MockDrmQuerySnapshot snapshot("snapshot.bin", "key");
+    {
+        DrmQuerySnapshot sourceSnapshot("snapshot.bin", "key");
+        sourceSnapshot.store(1u, 0u, {1});
+        sourceSnapshot.store(2u, 0u, {2});
+        snapshot.fileContent = sourceSnapshot.serialize();
+    }
+    EXPECT_TRUE(snapshot.load());
+
+    std::vector<uint8_t> entry;
+    EXPECT_TRUE(snapshot.find(1u, 0u, entry));
+    EXPECT_TRUE(snapshot.find(2u, 0u, entry));
+
+    snapshot.completeStartup([](uint32_t queryId, uint32_t queryItemFlags) {
+        return queryId == 1u ? std::vector<uint8_t>{1} : std::vector<uint8_t>{3};
+    });
+    snapshot.waitForVerification();
+
+    EXPECT_EQ(1u, snapshot.getStatistics().verificationMismatches);
+    EXPECT_EQ(1u, snapshot.saveToFileCalled);
+
+    DrmQuerySnapshot savedSnapshot("snapshot.bin", "key");
+    EXPECT_TRUE(savedSnapshot.deserialize(snapshot.fileContent.data(), snapshot.fileContent.size()));
+    EXPECT_TRUE(savedSnapshot.find(2u, 0u, entry));
+    EXPECT_EQ((std::vector<uint8_t>{3}), entry);
+}
+
+TEST(DrmQuerySnapshotTest, givenDrmWithSnapshotWhenQueryingCacheableQueryThenKmdIsQueriedOnlyOnceDuringStartup) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    auto snapshot = new MockDrmQuerySnapshot("snapshot.bin", "key");
+    drm.querySnapshot.reset(snapshot);
+    auto topologyRequest = drm.getIoctlHelper()->getDrmParamValue(DrmParam::QueryTopologyInfo);
+    snapshot->addCacheableQuery(topologyRequest);
+
+    auto data = drm.query(topologyRequest, 0);
+    EXPECT_FALSE(data.empty());
+    auto queryIoctls = drm.ioctlCount.query.load();
+
+    EXPECT_EQ(data, drm.query(topologyRequest, 0));
+    EXPECT_EQ(queryIoctls, drm.ioctlCount.query.load());
+    EXPECT_EQ(1u, snapshot->getStatistics().hits);
+
+    drm.completeStartup();
+    snapshot->waitForVerification();
+    EXPECT_EQ(1u, snapshot->saveToFileCalled);
+    EXPECT_EQ(0u, snapshot->getStatistics().verificationMismatches);
+
+    queryIoctls = drm.ioctlCount.query.load();
+    drm.query(topologyRequest, 0);
+    EXPECT_LT(queryIoctls, drm.ioctlCount.query.load());
+    EXPECT_EQ(1u, snapshot->getStatistics().hits);
+}
+
+TEST(DrmQuerySnapshotTest, givenDifferentKmdVersionOrDateWhenGettingSnapshotKeyThenKeysDiffer) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    VariableBackup<decltype(SysCalls::sysCallsIoctl)> mockIoctl(&SysCalls::sysCallsIoctl, mockVersionIoctl);
+    VariableBackup<int> versionMinorBackup(&mockKmdVersionMinor, 0);
+    VariableBackup<const char *> versionDateBackup(&mockKmdVersionDate, "20230101");
+
+    auto key = drm.getQuerySnapshotKey();
+    EXPECT_NE(std::string::npos, key.find("i915:1.0.0:20230101:"));
+    EXPECT_EQ(key, drm.getQuerySnapshotKey());
+
+    mockKmdVersionMinor = 1;
+    auto otherVersionKey = drm.getQuerySnapshotKey();
+    EXPECT_NE(key, otherVersionKey);
+
+    mockKmdVersionDate = "20230201";
+    EXPECT_NE(otherVersionKey, drm.getQuerySnapshotKey());
+}
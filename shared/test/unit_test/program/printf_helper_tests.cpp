@@ -8,6 +8,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/program/print_formatter.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_kernel_info.h"
 
@@ -1003,6 +1004,90 @@ TEST_F(PrintFormatterTest, GivenTypeSmallerThan4BThenItIsReadAs4BValue) {
     EXPECT_STREQ(expectedOutput, output);
 }
 
+TEST_F(PrintFormatterTest, GivenMultiplePrintfCallsWhenPrintingThenOutputIsPassedToCallbackOnce) {
+    auto stringIndex = injectFormatString("%d\\n");
+    for (int i = 0; i < 3; i++) {
+        storeData(stringIndex);
+        injectValue(i);
+    }
+
+    uint32_t printCalls = 0;
+    std::string output;
+    printFormatter->printKernelOutput([&](char *str) {
+        printCalls++;
+        output += str;
+    });
+
+    EXPECT_EQ(1u, printCalls);
+    EXPECT_STREQ("0\n1\n2\n", output.c_str());
+}
+
+TEST_F(PrintFormatterTest, GivenOutputFlushThresholdSetToZeroWhenPrintingThenOutputOfEachPrintfCallIsPassedToCallbackSeparately) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PrintfOutputFlushThreshold.set(0);
+    printFormatter.reset(new PrintFormatter(static_cast<uint8_t *>(data->getUnderlyingBuffer()), printfBufferSize, is32bit, &kernelInfo->kernelDescriptor.kernelMetadata.printfStringsMap));
+
+    auto stringIndex = injectFormatString("%d");
+    for (int i = 0; i < 3; i++) {
+        storeData(stringIndex);
+        injectValue(i);
+    }
+
+    std::vector<std::string> outputs;
+    printFormatter->printKernelOutput([&outputs](char *str) { outputs.push_back(str); });
+
+    ASSERT_EQ(3u, outputs.size());
+    EXPECT_STREQ("0", outputs[0].c_str());
+    EXPECT_STREQ("1", outputs[1].c_str());
+    EXPECT_STREQ("2", outputs[2].c_str());
+}
+
+TEST_F(PrintFormatterTest, GivenFormatPlanCacheWhenPrintingKernelOutputMultipleTimesThenEachFormatStringIsParsedOnce) {
+    printFormatter.reset(new PrintFormatter(static_cast<uint8_t *>(data->getUnderlyingBuffer()), printfBufferSize, is32bit,
+                                            &kernelInfo->kernelDescriptor.kernelMetadata.printfStringsMap, &kernelInfo->printfFormatPlans));
+
+    auto intFormatIndex = injectFormatString("int %d ");
+    auto floatFormatIndex = injectFormatString("float %.1f ");
+    for (int i = 0; i < 2; i++) {
+        storeData(intFormatIndex);
+        injectValue(i);
+        storeData(floatFormatIndex);
+        injectValue(1.5f);
+    }
+
+    std::string output;
+    printFormatter->printKernelOutput([&output](char *str) { output += str; });
+    EXPECT_STREQ("int 0 float 1.5 int 1 float 1.5 ", output.c_str());
+    EXPECT_EQ(2u, kernelInfo->printfFormatPlans.size());
+
+    output.clear();
+    printFormatter->printKernelOutput([&output](char *str) { output += str; });
+    EXPECT_STREQ("int 0 float 1.5 int 1 float 1.5 ", output.c_str());
+    EXPECT_EQ(2u, kernelInfo->printfFormatPlans.size());
+}
+
+TEST(PrintFormatterFormatPlanTest, GivenFormatStringWhenCreatingFormatPlanThenLiteralsAndConversionsAreSeparated) {
+    auto formatPlan = PrintFormatter::createFormatPlan(R"(a %% %5ld %v4hld %s\n)");
+
+    ASSERT_EQ(4u, formatPlan.segments.size());
+
+    EXPECT_STREQ("a % ", formatPlan.segments[0].literal.c_str());
+    EXPECT_TRUE(formatPlan.segments[0].hasConversion);
+    EXPECT_STREQ("%5ld", formatPlan.segments[0].conversion.format.c_str());
+    EXPECT_STREQ("%5lld", formatPlan.segments[0].conversion.longFormat.c_str());
+    EXPECT_FALSE(formatPlan.segments[0].conversion.isString);
+
+    EXPECT_STREQ(" ", formatPlan.segments[1].literal.c_str());
+    EXPECT_STREQ("%v4hld", formatPlan.segments[1].conversion.format.c_str());
+    EXPECT_STREQ("%d", formatPlan.segments[1].conversion.vectorFormat.c_str());
+
+    EXPECT_STREQ(" ", formatPlan.segments[2].literal.c_str());
+    EXPECT_TRUE(formatPlan.segments[2].conversion.isString);
+
+    EXPECT_STREQ("\n", formatPlan.segments[3].literal.c_str());
+    EXPECT_FALSE(formatPlan.segments[3].hasConversion);
+}
+
 TEST(printToStdoutTest, GivenStringWhenPrintingToStdoutThenOutputOccurs) {
     testing::internal::CaptureStdout();
     printToStdout("test");
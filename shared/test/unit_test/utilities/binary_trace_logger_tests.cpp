@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/binary_trace_logger.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+class MockBinaryTraceLogger : public BinaryTraceLogger {
+  public:
+    using BinaryTraceLogger::BinaryTraceLogger;
+    using BinaryTraceLogger::drainRings;
+    using BinaryTraceLogger::rings;
+
+    void writeRecords(const char *data, size_t size) override {
+        writtenData.insert(writtenData.end(), data, data + size);
+        writeCalled++;
+    }
+
+    std::string decodeWritten() {
+        return BinaryTraceLogger::decode(ArrayRef<const char>(writtenData.data(), writtenData.size()));
+    }
+
+    std::vector<char> writtenData;
+    uint32_t writeCalled = 0u;
+};
+
+TEST(BinaryTraceLoggerTest, givenLoggedApiCallsWhenFlushedAndDecodedThenTextMatchesFileLoggerFormat) {
+    MockBinaryTraceLogger logger("", false);
+    logger.logApiCall("clCreateBuffer", true, 0);
+    logger.logApiCall("clCreateBuffer", false, -30);
+    logger.flush();
+
+    EXPECT_EQ(1u, logger.writeCalled);
+    EXPECT_STREQ("ThreadID: 0 Function Enter: clCreateBuffer\nThreadID: 0 Function Leave (-30): clCreateBuffer\n", logger.decodeWritten().c_str());
+}
+
+TEST(BinaryTraceLoggerTest, givenSameFunctionLoggedManyTimesThenItsNameIsStoredOnce) {
+    MockBinaryTraceLogger logger("", false);
+    for (int i = 0; i < 10; i++) {
+        logger.logApiCall("clFinish", true, 0);
+    }
+    logger.flush();
+
+    auto expectedSize = BinaryTraceLogger::fileMagic.size() + 11 * sizeof(BinaryTraceLogger::FileRecord) + strlen("clFinish");
+    EXPECT_EQ(expectedSize, logger.writtenData.size());
+}
+
+TEST(BinaryTraceLoggerTest, givenNothingLoggedSinceLastFlushWhenFlushingThenNothingIsWritten) {
+    MockBinaryTraceLogger logger("", false);
+    logger.logApiCall("clFinish", true, 0);
+    logger.flush();
+    EXPECT_EQ(1u, logger.writeCalled);
+
+    logger.flush();
+    EXPECT_EQ(1u, logger.writeCalled);
+}
+
+TEST(BinaryTraceLoggerTest, givenFullRingWhenLoggingThenRecordIsDroppedAndReported) {
+    MockBinaryTraceLogger logger("", false);
+    for (uint32_t i = 0; i < BinaryTraceLogger::ringCapacity + 2; i++) {
+        logger.logApiCall("clFlush", true, 0);
+    }
+    EXPECT_EQ(2u, logger.getDroppedCount());
+    logger.flush();
+
+    auto decoded = logger.decodeWritten();
+    EXPECT_NE(std::string::npos, decoded.find("Dropped records: 2\n"));
+
+    logger.logApiCall("clFlush", true, 0);
+    EXPECT_EQ(2u, logger.getDroppedCount());
+}
+
+TEST(BinaryTraceLoggerTest, givenMultipleThreadsWhenLoggingThenEachThreadGetsOwnId) {
+    MockBinaryTraceLogger logger("", false);
+    logger.logApiCall("clFinish", true, 0);
+    std::thread worker([&logger]() {
+        logger.logApiCall("clFlush", true, 0);
+    });
+    worker.join();
+    logger.flush();
+
+    auto decoded = logger.decodeWritten();
+    EXPECT_NE(std::string::npos, decoded.find("ThreadID: 0 Function Enter: clFinish\n"));
+    EXPECT_NE(std::string::npos, decoded.find("ThreadID: 1 Function Enter: clFlush\n"));
+}
+
+TEST(BinaryTraceLoggerTest, givenInvalidDataWhenDecodingThenEmptyStringIsReturned) {
+    const char invalid[] = "NOTATRACE";
+    EXPECT_TRUE(BinaryTraceLogger::decode(ArrayRef<const char>(invalid, sizeof(invalid))).empty());
+    EXPECT_TRUE(BinaryTraceLogger::decode(ArrayRef<const char>()).empty());
+}
+
+TEST(BinaryTraceLoggerTest, givenWriterThreadWhenLoggerIsDestroyedThenPendingRecordsAreDrained) {
+    struct CountingLogger : public BinaryTraceLogger {
+        CountingLogger(std::vector<char> &output) : BinaryTraceLogger("", true), output(output) {}
+        ~CountingLogger() override {
+            stopWriterThread();
+            drainRings();
+        }
+        void writeRecords(const char *data, size_t size) override {
+            output.insert(output.end(), data, data + size);
+        }
+        std::vector<char> &output;
+    };
+
+    std::vector<char> output;
+    {
+        CountingLogger logger(output);
+        logger.logApiCall("clFinish", true, 0);
+    }
+    auto decoded = BinaryTraceLogger::decode(ArrayRef<const char>(output.data(), output.size()));
+    EXPECT_NE(std::string::npos, decoded.find("Function Enter: clFinish"));
+}
+
+TEST(BinaryTraceLoggerTest, givenThreadExitedWhenRingsAreDrainedThenItsRecordsAreWrittenAndRingIsReleased) {
+    MockBinaryTraceLogger logger("", false);
+    for (int i = 0; i < 3; i++) {
+        std::thread worker([&logger]() {
+            logger.logApiCall("clFlush", true, 0);
+        });
+        worker.join();
+    }
+    EXPECT_EQ(3u, logger.rings.size());
+
+    logger.flush();
+    EXPECT_EQ(0u, logger.rings.size());
+
+    auto decoded = logger.decodeWritten();
+    EXPECT_NE(std::string::npos, decoded.find("ThreadID: 0 Function Enter: clFlush\n"));
+    EXPECT_NE(std::string::npos, decoded.find("ThreadID: 2 Function Enter: clFlush\n"));
+
+    logger.logApiCall("clFinish", true, 0);
+    logger.flush();
+    EXPECT_EQ(1u, logger.rings.size());
+    EXPECT_NE(std::string::npos, logger.decodeWritten().find("ThreadID: 3 Function Enter: clFinish\n"));
+}
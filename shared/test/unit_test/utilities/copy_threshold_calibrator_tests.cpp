@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/copy_threshold_calibrator.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+namespace {
+void recordSamples(CopyThresholdCalibrator &calibrator, TransferType transferType, CopyThresholdCalibrator::CopyPath path, size_t size, uint64_t nanoseconds) {
+    for (uint32_t i = 0u; i < CopyThresholdCalibrator::minSamplesPerBucket; i++) {
+        calibrator.recordSample(transferType, path, size, nanoseconds);
+    }
+}
+} // namespace
+
+TEST(CopyThresholdCalibratorTest, whenGettingSizeBucketThenLog2OfSizeIsReturned) {
+    EXPECT_EQ(0u, CopyThresholdCalibrator::getSizeBucket(0u));
+    EXPECT_EQ(0u, CopyThresholdCalibrator::getSizeBucket(1u));
+    EXPECT_EQ(1u, CopyThresholdCalibrator::getSizeBucket(3u));
+    EXPECT_EQ(12u, CopyThresholdCalibrator::getSizeBucket(4096u));
+    EXPECT_EQ(12u, CopyThresholdCalibrator::getSizeBucket(8191u));
+    EXPECT_EQ(CopyThresholdCalibrator::sizeBucketCount - 1, CopyThresholdCalibrator::getSizeBucket(std::numeric_limits<size_t>::max()));
+}
+
+TEST(CopyThresholdCalibratorTest, givenNoSamplesWhenGettingThresholdThenDefaultIsReturned) {
+    CopyThresholdCalibrator calibrator;
+    EXPECT_FALSE(calibrator.isCalibrated(HOST_NON_USM_TO_DEVICE_USM));
+    EXPECT_EQ(4096u, calibrator.getThreshold(HOST_NON_USM_TO_DEVICE_USM, 4096u));
+    EXPECT_FALSE(calibrator.isDirty());
+}
+
+TEST(CopyThresholdCalibratorTest, givenSamplesOfOnlyOnePathWhenGettingThresholdThenDefaultIsReturned) {
+    CopyThresholdCalibrator calibrator;
+    recordSamples(calibrator, HOST_NON_USM_TO_DEVICE_USM, CopyThresholdCalibrator::CopyPath::cpu, 1024u, 100u);
+    EXPECT_TRUE(calibrator.isDirty());
+    EXPECT_FALSE(calibrator.isCalibrated(HOST_NON_USM_TO_DEVICE_USM));
+    EXPECT_EQ(4096u, calibrator.getThreshold(HOST_NON_USM_TO_DEVICE_USM, 4096u));
+}
+
+TEST(CopyThresholdCalibratorTest, givenCpuFasterForSmallAndGpuFasterForLargeCopiesWhenGettingThresholdThenEndOfLastCpuBucketIsReturned) {
+    CopyThresholdCalibrator calibrator;
+    auto transferType = HOST_NON_USM_TO_DEVICE_USM;
+    recordSamples(calibrator, transferType, CopyThresholdCalibrator::CopyPath::cpu, 1024u, 100u);
+    recordSamples(calibrator, transferType, CopyThresholdCalibrator::CopyPath::gpu, 1024u, 10000u);
+    recordSamples(calibrator, transferType, CopyThresholdCalibrator::CopyPath::cpu, 64 * 1024u, 20000u);
+    recordSamples(calibrator, transferType, CopyThresholdCalibrator::CopyPath::gpu, 64 * 1024u, 12000u);
+    recordSamples(calibrator, transferType, CopyThresholdCalibrator::CopyPath::cpu, 1024 * 1024u, 100u);
+    recordSamples(calibrator, transferType, CopyThresholdCalibrator::CopyPath::gpu, 1024 * 1024u, 10000u);
+
+    EXPECT_TRUE(calibrator.isCalibrated(transferType));
+    EXPECT_EQ(2047u, calibrator.getThreshold(transferType, 4096u));
+    EXPECT_FALSE(calibrator.isCalibrated(DEVICE_USM_TO_HOST_NON_USM));
+}
+
+TEST(CopyThresholdCalibratorTest, givenGpuFasterInAllComparedBucketsWhenGettingThresholdThenSizeBelowFirstComparedBucketIsReturned) {
+    CopyThresholdCalibrator calibrator;
+    auto transferType = DEVICE_USM_TO_HOST_NON_USM;
+    recordSamples(calibrator, transferType, CopyThresholdCalibrator::CopyPath::cpu, 512u, 2000u);
+    recordSamples(calibrator, transferType, CopyThresholdCalibrator::CopyPath::gpu, 512u, 1000u);
+    EXPECT_EQ(511u, calibrator.getThreshold(transferType, 1024u));
+
+    CopyThresholdCalibrator calibrator2;
+    recordSamples(calibrator2, transferType, CopyThresholdCalibrator::CopyPath::cpu, 1u, 2000u);
+    recordSamples(calibrator2, transferType, CopyThresholdCalibrator::CopyPath::gpu, 1u, 1000u);
+    EXPECT_EQ(0u, calibrator2.getThreshold(transferType, 1024u));
+}
+
+TEST(CopyThresholdCalibratorTest, givenBucketsAroundThresholdWhenCheckingExplorationThenOnlyBucketsWithinWindowLackingSamplesAreExplored) {
+    CopyThresholdCalibrator calibrator;
+    auto transferType = HOST_USM_TO_DEVICE_USM;
+    size_t threshold = 64 * 1024u;
+
+    EXPECT_TRUE(calibrator.isExplorationNeeded(transferType, CopyThresholdCalibrator::CopyPath::gpu, threshold, threshold));
+    EXPECT_TRUE(calibrator.isExplorationNeeded(transferType, CopyThresholdCalibrator::CopyPath::cpu, threshold << CopyThresholdCalibrator::explorationWindow, threshold));
+    EXPECT_TRUE(calibrator.isExplorationNeeded(transferType, CopyThresholdCalibrator::CopyPath::gpu, threshold >> CopyThresholdCalibrator::explorationWindow, threshold));
+    EXPECT_FALSE(calibrator.isExplorationNeeded(transferType, CopyThresholdCalibrator::CopyPath::cpu, threshold << (CopyThresholdCalibrator::explorationWindow + 1), threshold));
+    EXPECT_FALSE(calibrator.isExplorationNeeded(transferType, CopyThresholdCalibrator::CopyPath::gpu, threshold >> (CopyThresholdCalibrator::explorationWindow + 1), threshold));
+
+    recordSamples(calibrator, transferType, CopyThresholdCalibrator::CopyPath::gpu, threshold, 1000u);
+    EXPECT_FALSE(calibrator.isExplorationNeeded(transferType, CopyThresholdCalibrator::CopyPath::gpu, threshold, threshold));
+    EXPECT_TRUE(calibrator.isExplorationNeeded(transferType, CopyThresholdCalibrator::CopyPath::cpu, threshold, threshold));
+}
+
+TEST(CopyThresholdCalibratorTest, givenManySamplesInBucketWhenRecordingThenOlderSamplesAreDecayed) {
+    struct CalibratorWhitebox : public CopyThresholdCalibrator {
+        using CopyThresholdCalibrator::statistics;
+    };
+    CalibratorWhitebox calibrator;
+    for (uint32_t i = 0u; i < CopyThresholdCalibrator::maxSamplesPerBucket; i++) {
+        calibrator.recordSample(HOST_USM_TO_DEVICE_USM, CopyThresholdCalibrator::CopyPath::cpu, 1024u, 10u);
+    }
+    auto &bucket = calibrator.statistics[HOST_USM_TO_DEVICE_USM][0][10];
+    EXPECT_EQ(CopyThresholdCalibrator::maxSamplesPerBucket / 2, bucket.samples);
+    EXPECT_EQ(10u * CopyThresholdCalibrator::maxSamplesPerBucket / 2, bucket.totalNanoseconds);
+    EXPECT_EQ(1024u * CopyThresholdCalibrator::maxSamplesPerBucket / 2, bucket.totalBytes);
+}
+
+TEST(CopyThresholdCalibratorTest, givenCalibratedDataWhenSerializedAndDeserializedThenThresholdsAreRestored) {
+    CopyThresholdCalibrator calibrator;
+    auto transferType = HOST_NON_USM_TO_DEVICE_USM;
+    recordSamples(calibrator, transferType, CopyThresholdCalibrator::CopyPath::cpu, 1024u, 100u);
+    recordSamples(calibrator, transferType, CopyThresholdCalibrator::CopyPath::gpu, 1024u, 10000u);
+    recordSamples(calibrator, DEVICE_USM_TO_HOST_USM, CopyThresholdCalibrator::CopyPath::cpu, 16u, 100u);
+
+    auto data = calibrator.serialize();
+    EXPECT_NE(std::string::npos, data.find("threshold 2 2047\n"));
+    EXPECT_NE(std::string::npos, data.find("bucket 2 1 10 4 40000 4096\n"));
+
+    CopyThresholdCalibrator restored;
+    EXPECT_TRUE(restored.deserialize(data));
+    EXPECT_FALSE(restored.isDirty());
+    EXPECT_EQ(2047u, restored.getThreshold(transferType, 0u));
+    EXPECT_FALSE(restored.isCalibrated(DEVICE_USM_TO_HOST_USM));
+    EXPECT_EQ(data, restored.serialize());
+}
+
+TEST(CopyThresholdCalibratorTest, givenMalformedDataWhenDeserializingThenFalseIsReturnedAndStateIsUnchanged) {
+    CopyThresholdCalibrator calibrator;
+    recordSamples(calibrator, HOST_NON_USM_TO_DEVICE_USM, CopyThresholdCalibrator::CopyPath::cpu, 1024u, 100u);
+    recordSamples(calibrator, HOST_NON_USM_TO_DEVICE_USM, CopyThresholdCalibrator::CopyPath::gpu, 1024u, 10000u);
+
+    EXPECT_FALSE(calibrator.deserialize("bucket 2 1\n"));
+    EXPECT_FALSE(calibrator.deserialize("bucket 100 0 0 1 1 1\n"));
+    EXPECT_FALSE(calibrator.deserialize("bucket 2 2 0 1 1 1\n"));
+    EXPECT_FALSE(calibrator.deserialize("bucket 2 0 32 1 1 1\n"));
+    EXPECT_FALSE(calibrator.deserialize("unknown 2 0 0 1 1 1\n"));
+    EXPECT_EQ(2047u, calibrator.getThreshold(HOST_NON_USM_TO_DEVICE_USM, 0u));
+}
+
+TEST(CopyThresholdCalibratorTest, givenNonExistingFileWhenLoadingThenFalseIsReturned) {
+    CopyThresholdCalibrator calibrator;
+    EXPECT_FALSE(calibrator.loadFromFile("non_existing_copy_thresholds_file.txt"));
+}
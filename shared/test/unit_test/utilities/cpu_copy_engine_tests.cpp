@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/streaming_copy.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+struct MockCpuCopyEngine : public CpuCopyEngine {
+    using CpuCopyEngine::CpuCopyEngine;
+    using CpuCopyEngine::streamingEnabled;
+};
+
+void fillPattern(std::vector<uint8_t> &buffer) {
+    for (size_t i = 0; i < buffer.size(); i++) {
+        buffer[i] = static_cast<uint8_t>((i * 7 + i / 251) & 0xFF);
+    }
+}
+
+void verifyRegionCopy(CpuCopyEngine &engine, size_t rowSize, size_t rowCount, size_t sliceCount,
+                      size_t dstRowPitch, size_t dstSlicePitch, size_t srcRowPitch, size_t srcSlicePitch) {
+    std::vector<uint8_t> src(srcSlicePitch * sliceCount + srcRowPitch * rowCount + rowSize);
+    std::vector<uint8_t> dst(dstSlicePitch * sliceCount + dstRowPitch * rowCount + rowSize, 0xCD);
+    auto expectedDst = dst;
+    fillPattern(src);
+
+    for (size_t slice = 0; slice < sliceCount; slice++) {
+        for (size_t row = 0; row < rowCount; row++) {
+            memcpy(expectedDst.data() + slice * dstSlicePitch + row * dstRowPitch, src.data() + slice * srcSlicePitch + row * srcRowPitch, rowSize);
+        }
+    }
+    engine.copyRegion(dst.data(), dstRowPitch, dstSlicePitch, src.data(), srcRowPitch, srcSlicePitch, rowSize, rowCount, sliceCount);
+    EXPECT_EQ(0, memcmp(dst.data(), expectedDst.data(), dst.size()));
+}
+
+void verifyCopyFunction(StreamingCopy::CopyFunctionT copyFunction) {
+    constexpr size_t sizes[] = {0u, 1u, 15u, 16u, 31u, 64u, 127u, 4096u, 4099u, 65536u + 33u};
+    constexpr size_t offsets[] = {0u, 1u, 7u, 16u, 33u};
+    for (auto size : sizes) {
+        for (auto srcOffset : offsets) {
+            for (auto dstOffset : offsets) {
+                std::vector<uint8_t> src(size + srcOffset);
+                std::vector<uint8_t> dst(size + dstOffset + 64u, 0xCD);
+                fillPattern(src);
+
+                copyFunction(dst.data() + dstOffset, src.data() + srcOffset, size);
+
+                EXPECT_EQ(0, memcmp(dst.data() + dstOffset, src.data() + srcOffset, size)) << "size: " << size << " srcOffset: " << srcOffset << " dstOffset: " << dstOffset;
+                for (size_t i = 0; i < dstOffset; i++) {
+                    EXPECT_EQ(0xCD, dst[i]);
+                }
+                for (size_t i = dstOffset + size; i < dst.size(); i++) {
+                    EXPECT_EQ(0xCD, dst[i]);
+                }
+            }
+        }
+    }
+}
+} // namespace
+
+TEST(StreamingCopyTest, givenSse4StreamingCopyToUncachedWhenCopyingMisalignedBuffersThenDataIsCopied) {
+    verifyCopyFunction(StreamingCopy::copyToUncachedSse4);
+}
+
+TEST(StreamingCopyTest, givenSse4StreamingCopyFromUncachedWhenCopyingMisalignedBuffersThenDataIsCopied) {
+    verifyCopyFunction(StreamingCopy::copyFromUncachedSse4);
+}
+
+TEST(StreamingCopyTest, givenSelectedStreamingCopyWhenCopyingMisalignedBuffersThenDataIsCopied) {
+    ASSERT_NE(nullptr, StreamingCopy::copyToUncached);
+    ASSERT_NE(nullptr, StreamingCopy::copyFromUncached);
+    verifyCopyFunction(StreamingCopy::copyToUncached);
+    verifyCopyFunction(StreamingCopy::copyFromUncached);
+}
+
+TEST(CpuCopyEngineTest, givenDebugFlagsWhenCreatingEngineThenFlagsAreRespected) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CpuCopyEngineWorkerCount.set(5);
+    DebugManager.flags.CpuCopyEngineSplitThreshold.set(static_cast<int32_t>(8 * MemoryConstants::megaByte));
+    DebugManager.flags.EnableStreamingCpuCopy.set(0);
+
+    MockCpuCopyEngine engine;
+    EXPECT_EQ(5u, engine.getWorkerCount());
+    EXPECT_EQ(8 * MemoryConstants::megaByte, engine.getSplitThreshold());
+    EXPECT_FALSE(engine.streamingEnabled);
+}
+
+TEST(CpuCopyEngineTest, givenDefaultEngineWhenCreatedThenStreamingIsEnabledAndNoWorkersAreStarted) {
+    MockCpuCopyEngine engine;
+    EXPECT_LE(engine.getWorkerCount(), CpuCopyEngine::defaultWorkerCount);
+    EXPECT_EQ(CpuCopyEngine::defaultSplitThreshold, engine.getSplitThreshold());
+    EXPECT_TRUE(engine.streamingEnabled);
+    EXPECT_EQ(0u, engine.getNumStartedWorkers());
+}
+
+TEST(CpuCopyEngineTest, givenSplitThresholdBelowMinChunkSizeWhenCreatingEngineThenMinChunkSizeIsUsed) {
+    CpuCopyEngine engine(2u, 1u, true);
+    EXPECT_EQ(CpuCopyEngine::minChunkSize, engine.getSplitThreshold());
+}
+
+TEST(CpuCopyEngineTest, givenCopyBelowSplitThresholdWhenCopyingThenNoWorkersAreStarted) {
+    CpuCopyEngine engine(2u, 2 * MemoryConstants::megaByte, true);
+    std::vector<uint8_t> src(MemoryConstants::megaByte + 3u);
+    std::vector<uint8_t> dst(src.size());
+    fillPattern(src);
+
+    engine.copy(dst.data(), src.data(), src.size(), true, false);
+    EXPECT_EQ(0, memcmp(dst.data(), src.data(), src.size()));
+    EXPECT_EQ(0u, engine.getNumStartedWorkers());
+}
+
+TEST(CpuCopyEngineTest, givenNoWorkersWhenCopyingAboveSplitThresholdThenCopyIsDoneByCallingThread) {
+    CpuCopyEngine engine(0u, MemoryConstants::megaByte, true);
+    std::vector<uint8_t> src(3 * MemoryConstants::megaByte + 5u);
+    std::vector<uint8_t> dst(src.size());
+    fillPattern(src);
+
+    engine.copy(dst.data(), src.data(), src.size(), false, true);
+    EXPECT_EQ(0, memcmp(dst.data(), src.data(), src.size()));
+    EXPECT_EQ(0u, engine.getNumStartedWorkers());
+}
+
+TEST(CpuCopyEngineTest, givenCopyAboveSplitThresholdWhenCopyingThenWorkersAreStartedOnceAndDataIsCopied) {
+    CpuCopyEngine engine(3u, MemoryConstants::megaByte, true);
+    std::vector<uint8_t> src(5 * MemoryConstants::megaByte + 17u);
+    fillPattern(src);
+
+    bool uncachedFlags[][2] = {{false, false}, {true, false}, {false, true}, {true, true}};
+    for (auto &flags : uncachedFlags) {
+        std::vector<uint8_t> dst(src.size() + 1u, 0u);
+        engine.copy(dst.data() + 1u, src.data(), src.size(), flags[0], flags[1]);
+        EXPECT_EQ(0, memcmp(dst.data() + 1u, src.data(), src.size()));
+        EXPECT_EQ(3u, engine.getNumStartedWorkers());
+    }
+}
+
+TEST(CpuCopyEngineTest, givenStreamingDisabledWhenCopyingToUncachedMemoryThenDataIsCopied) {
+    CpuCopyEngine engine(1u, MemoryConstants::megaByte, false);
+    std::vector<uint8_t> src(2 * MemoryConstants::megaByte + 1u);
+    std::vector<uint8_t> dst(src.size());
+    fillPattern(src);
+
+    engine.copy(dst.data(), src.data(), src.size(), true, false);
+    EXPECT_EQ(0, memcmp(dst.data(), src.data(), src.size()));
+}
+
+TEST(CpuCopyEngineTest, givenSmallPitchedRegionWhenCopyingRegionThenOnlyRegionRowsAreCopiedWithoutWorkers) {
+    CpuCopyEngine engine(2u, MemoryConstants::megaByte, true);
+    verifyRegionCopy(engine, 60u, 7u, 3u, 64u, 64u * 8u, 100u, 100u * 9u);
+    verifyRegionCopy(engine, 60u, 1u, 1u, 64u, 0u, 128u, 0u);
+    verifyRegionCopy(engine, 0u, 7u, 3u, 64u, 64u * 8u, 100u, 100u * 9u);
+    EXPECT_EQ(0u, engine.getNumStartedWorkers());
+}
+
+TEST(CpuCopyEngineTest, givenContiguousRowsAndSlicesWhenCopyingRegionThenRegionIsCopiedAsOneBlock) {
+    CpuCopyEngine engine(2u, MemoryConstants::megaByte, true);
+    verifyRegionCopy(engine, 4096u, 64u, 8u, 4096u, 4096u * 64u, 4096u, 4096u * 64u);
+    EXPECT_EQ(2u, engine.getNumStartedWorkers());
+
+    CpuCopyEngine rowsOnlyEngine(2u, MemoryConstants::megaByte, true);
+    verifyRegionCopy(rowsOnlyEngine, 1024u, 16u, 4u, 1024u, 1024u * 20u, 1024u, 1024u * 17u);
+    EXPECT_EQ(0u, rowsOnlyEngine.getNumStartedWorkers());
+}
+
+TEST(CpuCopyEngineTest, givenLargePitchedRegionWhenCopyingRegionThenSlicesOrRowsAreSplitAcrossWorkers) {
+    CpuCopyEngine engine(3u, MemoryConstants::megaByte, true);
+    verifyRegionCopy(engine, 4000u, 128u, 5u, 4096u, 4096u * 130u, 4100u, 4100u * 129u);
+    EXPECT_EQ(3u, engine.getNumStartedWorkers());
+
+    verifyRegionCopy(engine, 4000u, 700u, 1u, 4096u, 0u, 4100u, 0u);
+    EXPECT_EQ(3u, engine.getNumStartedWorkers());
+}
+
+TEST(CpuCopyEngineTest, givenRegionAboveStreamingStoreThresholdWhenCopyingRegionThenDataIsCopied) {
+    CpuCopyEngine engine(0u, MemoryConstants::megaByte, true);
+    verifyRegionCopy(engine, 4100u, 2048u, 1u, 4160u, 0u, 4100u, 0u);
+    verifyRegionCopy(engine, CpuCopyEngine::regionStreamingStoreThreshold + 3u, 1u, 1u, 0u, 0u, 0u, 0u);
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/latency_histogram.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+TEST(LatencyHistogramTest, givenSmallValuesWhenGettingBucketIndexThenValueIsUsedAsIndex) {
+    for (uint64_t value = 0u; value < LatencyHistogram::subBucketCount; value++) {
+        EXPECT_EQ(value, LatencyHistogram::getBucketIndex(value));
+        EXPECT_EQ(value, LatencyHistogram::getBucketUpperBound(static_cast<uint32_t>(value)));
+    }
+}
+
+TEST(LatencyHistogramTest, givenAnyValueWhenGettingBucketThenValueFitsInBucketRangeWithBoundedError) {
+    const uint64_t values[] = {16u, 17u, 31u, 32u, 33u, 1000u, 1023u, 1024u, 123456789u, 1ull << 40, std::numeric_limits<uint64_t>::max()};
+    for (auto value : values) {
+        auto index = LatencyHistogram::getBucketIndex(value);
+        ASSERT_LT(index, LatencyHistogram::bucketCount);
+        auto upperBound = LatencyHistogram::getBucketUpperBound(index);
+        EXPECT_GE(upperBound, value);
+        EXPECT_LE(upperBound - value, value / LatencyHistogram::subBucketCount);
+        if (index > 0u) {
+            EXPECT_LT(LatencyHistogram::getBucketUpperBound(index - 1), value);
+        }
+    }
+    EXPECT_EQ(LatencyHistogram::bucketCount - 1, LatencyHistogram::getBucketIndex(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(LatencyHistogramTest, givenRecordedValuesWhenGettingPercentilesThenValuesWithinBucketPrecisionAreReturned) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0u, histogram.getValueAtPercentile(50.0));
+    EXPECT_EQ(0u, histogram.getMin());
+
+    for (uint64_t value = 1u; value <= 1000u; value++) {
+        histogram.record(value * 1000u);
+    }
+
+    EXPECT_EQ(1000u, histogram.getCount());
+    EXPECT_EQ(1000u, histogram.getMin());
+    EXPECT_EQ(1000000u, histogram.getMax());
+    EXPECT_EQ(500500000u, histogram.getTotal());
+
+    auto p50 = histogram.getValueAtPercentile(50.0);
+    EXPECT_GE(p50, 500000u);
+    EXPECT_LE(p50, 500000u + 500000u / LatencyHistogram::subBucketCount);
+
+    auto p99 = histogram.getValueAtPercentile(99.0);
+    EXPECT_GE(p99, 990000u);
+    EXPECT_LE(p99, 990000u + 990000u / LatencyHistogram::subBucketCount);
+
+    EXPECT_EQ(1000000u, histogram.getValueAtPercentile(100.0));
+    EXPECT_EQ(histogram.getValueAtPercentile(0.0), histogram.getValueAtPercentile(0.01));
+}
+
+TEST(LatencyHistogramTest, givenTwoHistogramsWhenMergingThenCountsAndExtremesAreCombined) {
+    LatencyHistogram first;
+    LatencyHistogram second;
+    first.record(10u);
+    first.record(20u);
+    second.record(5u);
+    second.record(5000u);
+
+    first.merge(second);
+    EXPECT_EQ(4u, first.getCount());
+    EXPECT_EQ(5u, first.getMin());
+    EXPECT_EQ(5000u, first.getMax());
+    EXPECT_EQ(5035u, first.getTotal());
+    EXPECT_EQ(5000u, first.getValueAtPercentile(100.0));
+
+    first.reset();
+    EXPECT_EQ(0u, first.getCount());
+    EXPECT_EQ(0u, first.getMax());
+    EXPECT_EQ(0u, first.getValueAtPercentile(99.0));
+}
@@ -71,6 +71,29 @@ TEST(FileLogger, GivenEnabledDebugFunctinalityWhenLoggingApiCallsThenDumpToFile)
     }
 }
 
+TEST(FileLogger, GivenLogApiCallsBinaryWhenLoggingApiCallsThenCallsAreRedirectedToBinaryTraceLogger) {
+    DebugVariables flags;
+    flags.LogApiCalls.set(true);
+    flags.LogApiCallsBinary.set(true);
+    FullyEnabledFileLogger fileLogger(std::string(""), flags);
+
+    ASSERT_NE(nullptr, fileLogger.getBinaryTraceLogger());
+    EXPECT_TRUE(fileLogger.getBinaryTraceLogger()->getFileName().empty());
+
+    fileLogger.logApiCall("searchString", true, 0);
+    fileLogger.logApiCall("searchString", false, 0);
+
+    EXPECT_FALSE(fileLogger.wasFileCreated(fileLogger.getLogFileName()));
+}
+
+TEST(FileLogger, GivenLogApiCallsBinaryAndDisabledDebugFunctionalityWhenCreatingFileLoggerThenBinaryTraceLoggerIsNotCreated) {
+    DebugVariables flags;
+    flags.LogApiCallsBinary.set(true);
+    FullyDisabledFileLogger fileLogger(std::string(""), flags);
+
+    EXPECT_EQ(nullptr, fileLogger.getBinaryTraceLogger());
+}
+
 TEST(FileLogger, GivenDisabledDebugFunctinalityWhenLoggingApiCallsThenFileIsNotCreated) {
     DebugVariables flags;
     flags.LogApiCalls.set(true);
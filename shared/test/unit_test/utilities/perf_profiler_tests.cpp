@@ -5,7 +5,10 @@
  *
  */
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/utilities/perf_profiler.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "gtest/gtest.h"
@@ -289,3 +292,163 @@ TEST(PerfProfiler, GivenSysLogBuilderWhenReadingAndWritingThenLogIsCorrect) {
     EXPECT_EQ(timeW, timeR);
     EXPECT_EQ(idW, idR);
 }
+
+struct PerfProfilerHistogramsMock : PerfProfiler {
+    using PerfProfiler::histogramsDumpRequested;
+    using PerfProfiler::histogramsMode;
+};
+
+struct HistogramsModeBackup {
+    HistogramsModeBackup(int32_t newMode) {
+        oldMode = PerfProfilerHistogramsMock::histogramsMode.exchange(newMode);
+    }
+    ~HistogramsModeBackup() {
+        PerfProfilerHistogramsMock::histogramsMode.store(oldMode);
+        PerfProfilerHistogramsMock::histogramsDumpRequested.store(false);
+    }
+    int32_t oldMode;
+};
+
+TEST(PerfProfiler, GivenHistogramsDisabledWhenUsingHistogramWrapperThenNoProfilerIsCreated) {
+    HistogramsModeBackup histogramsModeBackup(0);
+
+    EXPECT_EQ(nullptr, PerfProfiler::getHistogramProfiler());
+    {
+        PerfProfilerHistogramWrapper wrapper("histogramsDisabled()");
+        EXPECT_EQ(nullptr, wrapper.profiler);
+    }
+    EXPECT_EQ(0, PerfProfiler::getCurrentCounter());
+}
+
+TEST(PerfProfiler, GivenHistogramsFlagNotSetWhenCheckingHistogramsThenTheyAreDisabled) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PerfProfilerHistograms.set(false);
+    HistogramsModeBackup histogramsModeBackup(-1);
+
+    EXPECT_FALSE(PerfProfiler::areHistogramsEnabled());
+    EXPECT_EQ(0, PerfProfilerHistogramsMock::histogramsMode.load());
+}
+
+TEST(PerfProfiler, GivenHistogramsEnabledWhenApiAndSystemCallsAreMadeThenLatenciesAreRecordedInHistogramsInsteadOfLogs) {
+    HistogramsModeBackup histogramsModeBackup(1);
+
+    PerfProfiler *ptr = PerfProfiler::getHistogramProfiler();
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_TRUE(ptr->isHistogramsOnly());
+    EXPECT_EQ(nullptr, ptr->getLogStream());
+    EXPECT_EQ(nullptr, ptr->getSystemLogStream());
+
+    const char *func = "histogramsEnabled()";
+    for (int i = 0; i < 3; i++) {
+        PerfProfilerHistogramWrapper wrapper(func);
+        EXPECT_EQ(ptr, wrapper.profiler);
+        ptr->systemEnter();
+        ptr->systemLeave(7u);
+    }
+
+    PerfProfiler::ApiHistograms apiHistograms;
+    PerfProfiler::SystemHistograms systemHistograms;
+    PerfProfiler::collectHistograms(apiHistograms, systemHistograms);
+    ASSERT_EQ(1u, apiHistograms.size());
+    EXPECT_EQ(3u, apiHistograms[func].getCount());
+    ASSERT_EQ(1u, systemHistograms.size());
+    EXPECT_EQ(3u, systemHistograms[7u].getCount());
+
+    std::stringstream dump;
+    PerfProfiler::dumpHistograms(dump);
+    EXPECT_NE(std::string::npos, dump.str().find("api histogramsEnabled() count=3 "));
+    EXPECT_NE(std::string::npos, dump.str().find("sys 7 count=3 "));
+
+    PerfProfiler::destroyAll();
+    EXPECT_EQ(0, PerfProfiler::getCurrentCounter());
+}
+
+TEST(PerfProfiler, GivenHistogramsDumpRequestedWhenApiCallLeavesThenRequestIsConsumed) {
+    HistogramsModeBackup histogramsModeBackup(1);
+
+    PerfProfiler *ptr = PerfProfiler::getHistogramProfiler();
+    ASSERT_NE(nullptr, ptr);
+
+    PerfProfiler::requestHistogramsDump();
+    EXPECT_TRUE(PerfProfilerHistogramsMock::histogramsDumpRequested.load());
+
+    ptr->apiEnter();
+    ptr->apiLeave("dumpRequested()");
+    EXPECT_FALSE(PerfProfilerHistogramsMock::histogramsDumpRequested.load());
+    EXPECT_TRUE(fileExists(PerfProfiler::histogramsFileName));
+
+    PerfProfiler::destroyAll();
+}
+
+TEST(PerfProfiler, GivenHistogramsEnabledWhenApiCallIsMadeFromAnotherApiCallThenLatencyOfOuterCallIncludesWholeCall) {
+    HistogramsModeBackup histogramsModeBackup(1);
+
+    const char *outerFunc = "outerCall()";
+    const char *innerFunc = "innerCall()";
+    {
+        PerfProfilerHistogramWrapper outerWrapper(outerFunc);
+        ASSERT_NE(nullptr, outerWrapper.profiler);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        PerfProfilerHistogramWrapper innerWrapper(innerFunc);
+    }
+
+    PerfProfiler::ApiHistograms apiHistograms;
+    PerfProfiler::SystemHistograms systemHistograms;
+    PerfProfiler::collectHistograms(apiHistograms, systemHistograms);
+    EXPECT_EQ(1u, apiHistograms[innerFunc].getCount());
+    EXPECT_EQ(1u, apiHistograms[outerFunc].getCount());
+    EXPECT_LE(1000000u, apiHistograms[outerFunc].getMax());
+    EXPECT_GT(apiHistograms[outerFunc].getMax(), apiHistograms[innerFunc].getMax());
+
+    PerfProfiler::destroyAll();
+}
+
+TEST(PerfProfiler, GivenHistogramsEnabledWhenThreadsExitThenTheirProfilersAreReleasedAndHistogramsAreKept) {
+    HistogramsModeBackup histogramsModeBackup(1);
+
+    const char *func = "threadCall()";
+    for (int i = 0; i < 3; i++) {
+        std::thread thread([func]() {
+            PerfProfilerHistogramWrapper wrapper(func);
+            EXPECT_NE(nullptr, wrapper.profiler);
+            EXPECT_EQ(wrapper.profiler, PerfProfiler::getObject(0));
+        });
+        thread.join();
+        EXPECT_EQ(nullptr, PerfProfiler::getObject(0));
+    }
+    EXPECT_EQ(1, PerfProfiler::getCurrentCounter());
+
+    PerfProfiler::ApiHistograms apiHistograms;
+    PerfProfiler::SystemHistograms systemHistograms;
+    PerfProfiler::collectHistograms(apiHistograms, systemHistograms);
+    EXPECT_EQ(3u, apiHistograms[func].getCount());
+
+    PerfProfiler::destroyAll();
+    apiHistograms.clear();
+    PerfProfiler::collectHistograms(apiHistograms, systemHistograms);
+    EXPECT_EQ(0u, apiHistograms[func].getCount());
+}
+
+TEST(PerfProfiler, GivenAllSlotsTakenWhenCreatingProfilerThenProfilerIsNotListedAndReleasedOnThreadExit) {
+    struct PerfProfilerSlotsMock : PerfProfiler {
+        using PerfProfiler::counter;
+    };
+    HistogramsModeBackup histogramsModeBackup(1);
+    PerfProfilerSlotsMock::counter = static_cast<int>(PerfProfiler::objectsNumber);
+
+    const char *func = "unlistedThreadCall()";
+    std::thread thread([func]() {
+        PerfProfilerHistogramWrapper wrapper(func);
+        EXPECT_NE(nullptr, wrapper.profiler);
+    });
+    thread.join();
+    EXPECT_EQ(static_cast<int>(PerfProfiler::objectsNumber), PerfProfiler::getCurrentCounter());
+
+    PerfProfiler::ApiHistograms apiHistograms;
+    PerfProfiler::SystemHistograms systemHistograms;
+    PerfProfiler::collectHistograms(apiHistograms, systemHistograms);
+    EXPECT_EQ(1u, apiHistograms[func].getCount());
+
+    PerfProfiler::destroyAll();
+    EXPECT_EQ(0, PerfProfiler::getCurrentCounter());
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/utilities/pool_chunk_allocator.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+constexpr size_t poolSize = 64 * MemoryConstants::kiloByte;
+constexpr size_t chunkAlignment = 512u;
+
+TEST(PoolChunkAllocatorTest, whenAllocatingChunksThenOffsetsAreWithinPoolAlignedAndDisjoint) {
+    PoolChunkAllocator allocator(poolSize, chunkAlignment);
+    size_t offset0 = 0u, size0 = 0u;
+    size_t offset1 = 0u, size1 = 0u;
+    ASSERT_TRUE(allocator.allocate(100u, 0u, offset0, size0));
+    ASSERT_TRUE(allocator.allocate(600u, 0u, offset1, size1));
+
+    EXPECT_EQ(chunkAlignment, size0);
+    EXPECT_EQ(2 * chunkAlignment, size1);
+    EXPECT_TRUE(isAligned(offset0, chunkAlignment));
+    EXPECT_TRUE(isAligned(offset1, chunkAlignment));
+    EXPECT_LE(offset0 + size0, poolSize);
+    EXPECT_LE(offset1 + size1, poolSize);
+    EXPECT_TRUE(offset0 + size0 <= offset1 || offset1 + size1 <= offset0);
+    EXPECT_EQ(size0 + size1, allocator.getUsedSize());
+
+    allocator.free(offset0, size0);
+    allocator.free(offset1, size1);
+    EXPECT_EQ(0u, allocator.getUsedSize());
+}
+
+TEST(PoolChunkAllocatorTest, givenCustomAlignmentWhenAllocatingThenOffsetIsAlignedOrAllocationFailsAboveMaxAlignment) {
+    PoolChunkAllocator allocator(poolSize, chunkAlignment);
+    size_t offset = 0u, size = 0u;
+    ASSERT_TRUE(allocator.allocate(100u, 0u, offset, size));
+    ASSERT_TRUE(allocator.allocate(100u, MemoryConstants::pageSize, offset, size));
+    EXPECT_TRUE(isAligned(offset, MemoryConstants::pageSize));
+
+    EXPECT_FALSE(allocator.allocate(100u, 2 * PoolChunkAllocator::maxChunkAlignment, offset, size));
+    EXPECT_EQ(1u, allocator.getStatistics().failedAllocations);
+}
+
+TEST(PoolChunkAllocatorTest, givenExhaustedPoolWhenAllocatingThenFailureIsReturned) {
+    PoolChunkAllocator allocator(poolSize, chunkAlignment);
+    size_t offset = 0u, size = 0u;
+    EXPECT_TRUE(allocator.allocate(poolSize, 0u, offset, size));
+    EXPECT_EQ(0u, offset);
+    EXPECT_FALSE(allocator.allocate(1u, 0u, offset, size));
+}
+
+TEST(PoolChunkAllocatorTest, givenDeferredFreesWhenReleasingDeferredChunksThenChunksAreReturnedToPool) {
+    PoolChunkAllocator allocator(poolSize, chunkAlignment);
+    size_t offset = 0u, size = 0u;
+    ASSERT_TRUE(allocator.allocate(chunkAlignment, 0u, offset, size));
+
+    allocator.deferFree(offset, size);
+    EXPECT_TRUE(allocator.hasDeferredChunks());
+    EXPECT_EQ(chunkAlignment, allocator.getUsedSize());
+
+    allocator.releaseDeferredChunks();
+    EXPECT_FALSE(allocator.hasDeferredChunks());
+    EXPECT_EQ(0u, allocator.getUsedSize());
+}
+
+TEST(PoolChunkAllocatorTest, whenAllocatingAndFreeingThenStatisticsAreTracked) {
+    PoolChunkAllocator allocator(poolSize, chunkAlignment);
+    size_t offset0 = 0u, size0 = 0u;
+    size_t offset1 = 0u, size1 = 0u;
+    ASSERT_TRUE(allocator.allocate(chunkAlignment, 0u, offset0, size0));
+    ASSERT_TRUE(allocator.allocate(chunkAlignment, 0u, offset1, size1));
+    allocator.free(offset0, size0);
+
+    auto &statistics = allocator.getStatistics();
+    EXPECT_EQ(1u, statistics.allocationsInUse);
+    EXPECT_EQ(2u, statistics.totalAllocations);
+    EXPECT_EQ(0u, statistics.failedAllocations);
+    EXPECT_EQ(2 * chunkAlignment, statistics.peakUsedSize);
+    EXPECT_EQ(poolSize, allocator.getPoolSize());
+}
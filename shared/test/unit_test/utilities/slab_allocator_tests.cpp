@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/utilities/slab_allocator.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+#include <vector>
+
+using namespace NEO;
+
+using TestSlabAllocator = SlabAllocator<4 * MemoryConstants::cacheLineSize>;
+
+class MockSlabAllocator : public TestSlabAllocator {
+  public:
+    void *allocateSlabMemory(size_t size) override {
+        if (failSlabAllocation) {
+            return nullptr;
+        }
+        return TestSlabAllocator::allocateSlabMemory(size);
+    }
+
+    bool failSlabAllocation = false;
+};
+
+TEST(SlabAllocatorTest, givenObjectSizeWhenCheckingSizeClassThenSizesAreRoundedUpToCacheLines) {
+    EXPECT_EQ(0u, TestSlabAllocator::getSizeClass(1u));
+    EXPECT_EQ(0u, TestSlabAllocator::getSizeClass(MemoryConstants::cacheLineSize));
+    EXPECT_EQ(1u, TestSlabAllocator::getSizeClass(MemoryConstants::cacheLineSize + 1));
+    EXPECT_EQ(3u, TestSlabAllocator::getSizeClass(4 * MemoryConstants::cacheLineSize));
+
+    EXPECT_FALSE(TestSlabAllocator::isSlabAllocation(0u));
+    EXPECT_TRUE(TestSlabAllocator::isSlabAllocation(4 * MemoryConstants::cacheLineSize));
+    EXPECT_FALSE(TestSlabAllocator::isSlabAllocation(4 * MemoryConstants::cacheLineSize + 1));
+}
+
+TEST(SlabAllocatorTest, whenAllocatingObjectsThenSlotsAreCacheLineAlignedAndDisjoint) {
+    TestSlabAllocator allocator;
+    constexpr size_t objectSize = 100u;
+    constexpr size_t slotSize = 2 * MemoryConstants::cacheLineSize;
+
+    std::vector<void *> objects;
+    for (int i = 0; i < 16; i++) {
+        auto object = allocator.allocate(objectSize);
+        ASSERT_NE(nullptr, object);
+        EXPECT_TRUE(isAligned(reinterpret_cast<uintptr_t>(object), MemoryConstants::cacheLineSize));
+        memset(object, i, objectSize);
+        objects.push_back(object);
+    }
+    EXPECT_EQ(16u, allocator.getUsedSlotsCount());
+    EXPECT_EQ(1u, allocator.getSlabsCount());
+
+    std::set<uintptr_t> addresses;
+    for (auto object : objects) {
+        addresses.insert(reinterpret_cast<uintptr_t>(object));
+    }
+    ASSERT_EQ(objects.size(), addresses.size());
+    auto previous = *addresses.begin();
+    for (auto it = std::next(addresses.begin()); it != addresses.end(); it++) {
+        EXPECT_GE(*it - previous, slotSize);
+        previous = *it;
+    }
+
+    for (auto object : objects) {
+        allocator.deallocate(object, objectSize);
+    }
+    EXPECT_EQ(0u, allocator.getUsedSlotsCount());
+}
+
+TEST(SlabAllocatorTest, givenReleasedObjectWhenAllocatingObjectOfSameSizeClassThenSlotIsReused) {
+    TestSlabAllocator allocator;
+
+    auto object = allocator.allocate(MemoryConstants::cacheLineSize + 8);
+    allocator.deallocate(object, MemoryConstants::cacheLineSize + 8);
+
+    auto reusedObject = allocator.allocate(2 * MemoryConstants::cacheLineSize);
+    EXPECT_EQ(object, reusedObject);
+
+    auto otherSizeClassObject = allocator.allocate(MemoryConstants::cacheLineSize);
+    EXPECT_NE(object, otherSizeClassObject);
+    EXPECT_EQ(2u, allocator.getSlabsCount());
+
+    allocator.deallocate(reusedObject, 2 * MemoryConstants::cacheLineSize);
+    allocator.deallocate(otherSizeClassObject, MemoryConstants::cacheLineSize);
+    EXPECT_EQ(0u, allocator.getUsedSlotsCount());
+}
+
+TEST(SlabAllocatorTest, givenExhaustedSlabWhenAllocatingThenNextSlabIsAllocated) {
+    TestSlabAllocator allocator;
+    constexpr size_t objectSize = 4 * MemoryConstants::cacheLineSize;
+    constexpr size_t slotsPerSlab = TestSlabAllocator::slabSize / objectSize;
+
+    std::vector<void *> objects;
+    for (size_t i = 0; i < slotsPerSlab; i++) {
+        objects.push_back(allocator.allocate(objectSize));
+    }
+    EXPECT_EQ(1u, allocator.getSlabsCount());
+
+    objects.push_back(allocator.allocate(objectSize));
+    EXPECT_EQ(2u, allocator.getSlabsCount());
+
+    for (auto object : objects) {
+        allocator.deallocate(object, objectSize);
+    }
+    EXPECT_EQ(0u, allocator.getUsedSlotsCount());
+    EXPECT_EQ(2u, allocator.getSlabsCount());
+}
+
+TEST(SlabAllocatorTest, givenObjectLargerThanSlotWhenAllocatingThenGlobalAllocationIsUsed) {
+    TestSlabAllocator allocator;
+    constexpr size_t objectSize = 4 * MemoryConstants::cacheLineSize + 1;
+
+    auto object = allocator.allocate(objectSize);
+    ASSERT_NE(nullptr, object);
+    EXPECT_EQ(0u, allocator.getUsedSlotsCount());
+    EXPECT_EQ(0u, allocator.getSlabsCount());
+
+    allocator.deallocate(object, objectSize);
+    allocator.deallocate(nullptr, MemoryConstants::cacheLineSize);
+    EXPECT_EQ(0u, allocator.getUsedSlotsCount());
+}
+
+TEST(SlabAllocatorTest, givenMoreEmptySlabsThanReserveWhenReleasingObjectsThenEmptySlabsAboveReserveAreFreed) {
+    TestSlabAllocator allocator;
+    constexpr size_t objectSize = 4 * MemoryConstants::cacheLineSize;
+    constexpr size_t slotsPerSlab = TestSlabAllocator::slabSize / objectSize;
+    constexpr size_t slabsToAllocate = TestSlabAllocator::emptySlabsReserve + 2;
+
+    std::vector<void *> objects;
+    for (size_t i = 0; i < slotsPerSlab * slabsToAllocate; i++) {
+        objects.push_back(allocator.allocate(objectSize));
+    }
+    EXPECT_EQ(slabsToAllocate, allocator.getSlabsCount());
+    EXPECT_EQ(0u, allocator.getEmptySlabsCount());
+
+    for (auto object : objects) {
+        allocator.deallocate(object, objectSize);
+    }
+    EXPECT_EQ(0u, allocator.getUsedSlotsCount());
+    EXPECT_EQ(TestSlabAllocator::emptySlabsReserve, allocator.getSlabsCount());
+    EXPECT_EQ(TestSlabAllocator::emptySlabsReserve, allocator.getEmptySlabsCount());
+
+    auto object = allocator.allocate(objectSize);
+    EXPECT_EQ(TestSlabAllocator::emptySlabsReserve, allocator.getSlabsCount());
+    EXPECT_EQ(TestSlabAllocator::emptySlabsReserve - 1, allocator.getEmptySlabsCount());
+    allocator.deallocate(object, objectSize);
+}
+
+TEST(SlabAllocatorTest, givenObjectReleasedFromFullSlabWhenAllocatingThenItsSlotIsReusedWithoutNewSlab) {
+    TestSlabAllocator allocator;
+    constexpr size_t objectSize = 4 * MemoryConstants::cacheLineSize;
+    constexpr size_t slotsPerSlab = TestSlabAllocator::slabSize / objectSize;
+
+    std::vector<void *> objects;
+    for (size_t i = 0; i < 2 * slotsPerSlab; i++) {
+        objects.push_back(allocator.allocate(objectSize));
+    }
+    EXPECT_EQ(2u, allocator.getSlabsCount());
+
+    allocator.deallocate(objects[0], objectSize);
+    auto object = allocator.allocate(objectSize);
+    EXPECT_EQ(objects[0], object);
+    EXPECT_EQ(2u, allocator.getSlabsCount());
+
+    for (auto object : objects) {
+        allocator.deallocate(object, objectSize);
+    }
+    EXPECT_EQ(0u, allocator.getUsedSlotsCount());
+}
+
+TEST(SlabAllocatorTest, givenSlabMemoryAllocationFailureWhenAllocatingThenBadAllocIsThrownAndAllocatorStaysUsable) {
+    MockSlabAllocator allocator;
+    allocator.failSlabAllocation = true;
+    EXPECT_THROW(allocator.allocate(MemoryConstants::cacheLineSize), std::bad_alloc);
+    EXPECT_EQ(0u, allocator.getSlabsCount());
+    EXPECT_EQ(0u, allocator.getUsedSlotsCount());
+
+    allocator.failSlabAllocation = false;
+    auto object = allocator.allocate(MemoryConstants::cacheLineSize);
+    ASSERT_NE(nullptr, object);
+    EXPECT_EQ(1u, allocator.getSlabsCount());
+    allocator.deallocate(object, MemoryConstants::cacheLineSize);
+    EXPECT_EQ(0u, allocator.getUsedSlotsCount());
+}